@@ -52,6 +52,8 @@ namespace hpx { namespace plugins { namespace parcel
             get_counter_type average_time_between_parcels;
             get_counter_values_creator_type time_between_parcels_histogram_creator;
             std::int64_t min_boundary, max_boundary, num_buckets;
+            get_counter_type num_messages_limit;
+            get_counter_type flush_interval;
         };
 
         typedef std::unordered_map<
@@ -66,7 +68,9 @@ namespace hpx { namespace plugins { namespace parcel
             get_counter_type num_parcels, get_counter_type num_messages,
             get_counter_type time_between_parcels,
             get_counter_type average_time_between_parcels,
-            get_counter_values_creator_type time_between_parcels_histogram_creator);
+            get_counter_values_creator_type time_between_parcels_histogram_creator,
+            get_counter_type num_messages_limit,
+            get_counter_type flush_interval);
 
         get_counter_type get_parcels_counter(std::string const& name) const;
         get_counter_type get_messages_counter(std::string const& name) const;
@@ -74,6 +78,10 @@ namespace hpx { namespace plugins { namespace parcel
             std::string const& name) const;
         get_counter_type get_average_time_between_parcels_counter(
             std::string const& name) const;
+        get_counter_type get_num_messages_limit_counter(
+            std::string const& name) const;
+        get_counter_type get_flush_interval_counter(
+            std::string const& name) const;
         get_counter_values_type get_time_between_parcels_histogram_counter(
             std::string const& name, std::int64_t min_boundary,
             std::int64_t max_boundary, std::int64_t num_buckets);
@@ -19,6 +19,7 @@
 
 #include <hpx/plugins/parcel/message_buffer.hpp>
 
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <memory>
@@ -66,6 +67,8 @@ namespace hpx { namespace plugins { namespace parcel
             std::int64_t min_boundary, std::int64_t max_boundary,
             std::int64_t num_buckets,
             util::function_nonser<std::vector<std::int64_t>(bool)>& result);
+        std::int64_t get_num_messages_limit(bool reset);
+        std::int64_t get_flush_interval(bool reset);
 
         // register the given action
         static void register_action(char const* action, error_code& ec);
@@ -78,6 +81,11 @@ namespace hpx { namespace plugins { namespace parcel
 
         void update_num_messages();
         void update_interval();
+        void update_adaptive();
+
+        // adjust the batch size and flush interval to the observed traffic
+        void adapt(std::int64_t time_since_last_parcel);
+        void message_written(std::int64_t started_at);
 
     private:
         mutable mutex_type mtx_;
@@ -90,6 +98,16 @@ namespace hpx { namespace plugins { namespace parcel
         bool allow_background_flush_;
         std::string action_name_;
 
+        // The adaptive mode treats the configured number of messages and
+        // interval as upper bounds only. The values actually used are derived
+        // from the average time between parcels and the average time it takes
+        // to write a message.
+        bool adaptive_;
+        std::size_t adaptive_num_messages_;
+        std::size_t adaptive_interval_;
+        std::int64_t average_time_between_parcels_;
+        std::atomic<std::int64_t> average_write_time_;
+
         // performance counter data
         std::int64_t num_parcels_;
         std::int64_t reset_num_parcels_;
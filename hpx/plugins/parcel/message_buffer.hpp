@@ -19,6 +19,7 @@
 #include <hpx/threading_base/register_thread.hpp>
 
 #include <cstddef>
+#include <system_error>
 #include <utility>
 #include <vector>
 
@@ -121,6 +122,22 @@ namespace hpx { namespace plugins { namespace parcel { namespace detail
             return message_buffer_append_state(result);
         }
 
+        // invoke the given function once the message has been written
+        template <typename F>
+        void on_written(F&& f)
+        {
+            HPX_ASSERT(!handlers_.empty());
+
+            parcelset::write_handler_type& h = handlers_.back();
+            h = [handler = std::move(h), f = std::forward<F>(f)](
+                    std::error_code const& ec,
+                    parcelset::parcel const& p) mutable {
+                f(ec);
+                if (handler)
+                    handler(ec, p);
+            };
+        }
+
         bool empty() const
         {
             HPX_ASSERT(messages_.size() == handlers_.size());
@@ -63,6 +63,8 @@ namespace hpx { namespace parcelset { namespace policies { namespace mpi
             data.time_ = timer_.elapsed_nanoseconds();
             data.bytes_ = static_cast<std::size_t>(header_.numbytes());
 
+            pp_.get_buffer_pool().acquire(
+                buffer_.data_, static_cast<std::size_t>(header_.size()));
             buffer_.data_.resize(static_cast<std::size_t>(header_.size()));
             buffer_.num_chunks_ = header_.num_chunks();
         }
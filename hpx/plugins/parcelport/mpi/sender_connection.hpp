@@ -260,6 +260,7 @@ namespace hpx { namespace parcelset { namespace policies { namespace mpi
             buffer_.data_point_.time_ =
                 hpx::chrono::high_resolution_clock::now() - buffer_.data_point_.time_;
             pp_->add_sent_data(buffer_.data_point_);
+            pp_->get_buffer_pool().release(buffer_.data_);
             buffer_.clear();
 
             state_ = initialized;
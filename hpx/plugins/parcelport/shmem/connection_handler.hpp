@@ -0,0 +1,118 @@
+//  Copyright (c) 2020 STE||AR Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+
+#include <hpx/plugins/parcelport/shmem/locality.hpp>
+#include <hpx/plugins/parcelport/shmem/receiver.hpp>
+#include <hpx/plugins/parcelport/shmem/sender.hpp>
+#include <hpx/runtime/parcelset/locality.hpp>
+#include <hpx/runtime/parcelset/parcelport_impl.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <type_traits>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx { namespace parcelset
+{
+    namespace policies { namespace shmem
+    {
+        class HPX_EXPORT connection_handler;
+    }}
+
+    template <>
+    struct connection_handler_traits<policies::shmem::connection_handler>
+    {
+        typedef policies::shmem::sender_connection connection_type;
+        typedef std::false_type send_early_parcel;
+        typedef std::true_type  do_background_work;
+        typedef std::false_type send_immediate_parcels;
+
+        static const char * type()
+        {
+            return "shmem";
+        }
+
+        static const char * pool_name()
+        {
+            return "parcel-pool-shmem";
+        }
+
+        static const char * pool_name_postfix()
+        {
+            return "-shmem";
+        }
+    };
+
+    namespace policies { namespace shmem
+    {
+        // The shared memory parcelport is used for all destinations which
+        // run on the same host as this locality. It can't be used for
+        // bootstrapping, all other destinations are handled by the
+        // parcelports with lower priority (usually TCP).
+        class HPX_EXPORT connection_handler
+          : public parcelport_impl<connection_handler>
+        {
+            typedef parcelport_impl<connection_handler> base_type;
+
+        public:
+            connection_handler(util::runtime_configuration const& ini,
+                threads::policies::callback_notifier const& notifier);
+
+            ~connection_handler();
+
+            /// Start the handling of connections.
+            bool do_run();
+
+            /// Stop the handling of connections.
+            void do_stop();
+
+            /// Return the name of this locality
+            std::string get_locality_name() const override;
+
+            /// Only localities on the same host can be reached
+            bool can_connect(parcelset::locality const& dest,
+                bool use_alternative_parcelport) override;
+
+            std::shared_ptr<sender_connection> create_connection(
+                parcelset::locality const& l, error_code& ec);
+
+            parcelset::locality agas_locality(
+                util::runtime_configuration const& ini) const override;
+
+            parcelset::locality create_locality() const override;
+
+            bool background_work(
+                std::size_t num_thread, parcelport_background_mode mode);
+
+        private:
+            std::atomic<bool> stopped_;
+
+            sender sender_;
+            receiver<connection_handler> receiver_;
+
+            // whether the inbox of the localities on this host could be
+            // opened, the result is cached for each process id
+            lcos::local::spinlock reachable_mtx_;
+            std::map<std::int32_t, bool> reachable_;
+        };
+    }}
+}}
+
+#include <hpx/config/warnings_suffix.hpp>
+
+#endif
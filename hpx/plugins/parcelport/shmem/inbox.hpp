@@ -0,0 +1,49 @@
+//  Copyright (c) 2020 STE||AR Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace hpx { namespace parcelset { namespace policies { namespace shmem
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // The list of new connections which have not been picked up by the
+    // receiving locality yet. It lives in a shared memory object created by
+    // the receiving locality, all sending localities on the same host append
+    // to it. The list is protected by a spinlock which works across process
+    // boundaries, all critical sections are very short.
+    struct inbox
+    {
+        static constexpr std::size_t capacity = 256;
+
+        // Add the connection with the given sequence number created by the
+        // given process, returns false if the inbox is full.
+        bool announce(std::int32_t src, std::uint32_t seq);
+
+        // Remove all announced connections, returns their number.
+        std::size_t take(std::int32_t* src, std::uint32_t* seq);
+
+        // Check for new connections without acquiring the lock.
+        bool empty() const noexcept
+        {
+            return count_.load(std::memory_order_relaxed) == 0;
+        }
+
+        std::atomic<std::uint32_t> lock_;
+        std::atomic<std::uint32_t> count_;
+        std::int32_t src_[capacity];
+        std::uint32_t seq_[capacity];
+    };
+}}}}
+
+#endif
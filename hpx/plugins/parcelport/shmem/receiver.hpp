@@ -0,0 +1,344 @@
+//  Copyright (c) 2020 STE||AR Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+
+#include <hpx/assert.hpp>
+#include <hpx/plugins/parcelport/shmem/inbox.hpp>
+#include <hpx/plugins/parcelport/shmem/ring_buffer.hpp>
+#include <hpx/plugins/parcelport/shmem/shared_memory.hpp>
+#include <hpx/runtime/parcelset/decode_parcels.hpp>
+#include <hpx/runtime/parcelset/parcel_buffer.hpp>
+#include <hpx/serialization/serialize_buffer.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+#include <hpx/timing/high_resolution_timer.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace parcelset { namespace policies { namespace shmem
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // An incoming connection from a locality on the same host, reads the
+    // messages from the ring buffer created by the sending locality.
+    template <typename Parcelport>
+    class receiver_connection
+    {
+        enum connection_state
+        {
+            initialized
+          , rcvd_header
+          , rcvd_transmission_chunks
+          , rcvd_data
+        };
+
+        typedef std::vector<char> data_type;
+        typedef serialization::serialize_buffer<char> chunk_type;
+        typedef parcel_buffer<data_type, chunk_type> buffer_type;
+
+    public:
+        receiver_connection(ring_buffer&& ring, Parcelport& pp)
+          : state_(initialized)
+          , ring_(std::move(ring))
+          , offset_(0)
+          , chunks_idx_(0)
+          , pp_(pp)
+        {
+        }
+
+        // Read as much of the current message as is available, decode the
+        // message once it has been received completely. Returns whether any
+        // data was read.
+        bool receive(std::size_t num_thread = -1)
+        {
+            bool progress = false;
+
+            if (state_ == initialized)
+            {
+                if (!read(header_, sizeof(header_), progress))
+                    return progress;
+
+                start_message();
+                state_ = rcvd_header;
+            }
+
+            if (state_ == rcvd_header)
+            {
+                std::vector<buffer_type::transmission_chunk_type>& chunks =
+                    buffer_.transmission_chunks_;
+                if (!chunks.empty() &&
+                    !read(chunks.data(), chunks.size() *
+                        sizeof(buffer_type::transmission_chunk_type), progress))
+                {
+                    return progress;
+                }
+
+                // add appropriately sized chunk buffers for the zero-copy
+                // data
+                std::size_t num_zero_copy_chunks =
+                    static_cast<std::size_t>(
+                        static_cast<std::uint32_t>(buffer_.num_chunks_.first));
+
+                // the chunks are handed over to the de-serialized objects
+                buffer_.chunks_.resize(num_zero_copy_chunks);
+                for (std::size_t i = 0; i != num_zero_copy_chunks; ++i)
+                {
+                    buffer_.chunks_[i] = chunk_type(static_cast<std::size_t>(
+                        buffer_.transmission_chunks_[i].second));
+                }
+                chunks_idx_ = 0;
+
+                state_ = rcvd_transmission_chunks;
+            }
+
+            if (state_ == rcvd_transmission_chunks)
+            {
+                if (!read(buffer_.data_.data(), buffer_.data_.size(),
+                        progress))
+                {
+                    return progress;
+                }
+                state_ = rcvd_data;
+            }
+
+            HPX_ASSERT(state_ == rcvd_data);
+            while (chunks_idx_ != buffer_.chunks_.size())
+            {
+                chunk_type& c = buffer_.chunks_[chunks_idx_];
+                if (!read(c.data(), c.size(), progress))
+                    return progress;
+                ++chunks_idx_;
+            }
+
+            // complete data point and pass it along
+            buffer_.data_point_.time_ =
+                timer_.elapsed_nanoseconds() - buffer_.data_point_.time_;
+
+            // decode the received parcels.
+            decode_parcels(pp_, std::move(buffer_), num_thread);
+            buffer_ = buffer_type();
+
+            state_ = initialized;
+            return true;
+        }
+
+        // Return whether the sending locality has closed the connection and
+        // all of its messages have been received.
+        bool done() const
+        {
+            return state_ == initialized && offset_ == 0 && ring_.drained();
+        }
+
+    private:
+        bool read(void* data, std::size_t size, bool& progress)
+        {
+            std::size_t count =
+                ring_.read(static_cast<char*>(data) + offset_, size - offset_);
+            if (count != 0)
+            {
+                progress = true;
+                offset_ += count;
+            }
+            if (offset_ != size)
+                return false;
+
+            offset_ = 0;
+            return true;
+        }
+
+        void start_message()
+        {
+            performance_counters::parcels::data_point& data =
+                buffer_.data_point_;
+            data.time_ = timer_.elapsed_nanoseconds();
+            data.bytes_ = static_cast<std::size_t>(header_[0]);
+
+            buffer_.size_ = header_[0];
+            buffer_.data_size_ = header_[1];
+            buffer_.num_chunks_ = buffer_type::count_chunks_type(
+                static_cast<std::uint32_t>(header_[2]),
+                static_cast<std::uint32_t>(header_[2] >> 32));
+
+            // the transmission chunks are sent only if there is at least one
+            // zero-copy chunk
+            if (buffer_.num_chunks_.first != 0)
+            {
+                buffer_.transmission_chunks_.resize(
+                    static_cast<std::size_t>(buffer_.num_chunks_.first) +
+                    static_cast<std::size_t>(buffer_.num_chunks_.second));
+            }
+
+            buffer_.data_.resize(static_cast<std::size_t>(buffer_.size_));
+        }
+
+        hpx::chrono::high_resolution_timer timer_;
+
+        connection_state state_;
+        ring_buffer ring_;
+
+        // size_, data_size_, and the number of chunks of the current message
+        std::uint64_t header_[3];
+        buffer_type buffer_;
+
+        std::size_t offset_;        // bytes read of the current piece
+        std::size_t chunks_idx_;
+
+        Parcelport& pp_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Owns the inbox other localities on the same host use to announce new
+    // connections and all accepted incoming connections.
+    template <typename Parcelport>
+    class receiver
+    {
+        typedef hpx::lcos::local::spinlock mutex_type;
+        typedef receiver_connection<Parcelport> connection_type;
+        typedef std::shared_ptr<connection_type> connection_ptr;
+        typedef std::deque<connection_ptr> connection_list;
+
+    public:
+        receiver(Parcelport& pp, std::int32_t pid)
+          : pp_(pp)
+          , pid_(pid)
+          , inbox_(nullptr)
+        {}
+
+        ~receiver()
+        {
+            stop();
+        }
+
+        // Create the inbox, returns false if it can't be created.
+        bool run()
+        {
+            // a shared memory object using our id is a leftover of a
+            // previous process which was not shut down cleanly
+            std::string name = inbox_name(pid_);
+            shared_memory::unlink(name);
+
+            if (!segment_.create(name, sizeof(inbox)))
+                return false;
+
+            inbox_ = new (segment_.data()) inbox();
+            inbox_->lock_.store(0, std::memory_order_relaxed);
+            inbox_->count_.store(0, std::memory_order_relaxed);
+            return true;
+        }
+
+        void stop()
+        {
+            std::lock_guard<mutex_type> l(inbox_mtx_);
+            if (inbox_ != nullptr)
+            {
+                shared_memory::unlink(inbox_name(pid_));
+
+                // nobody else removes the ring buffers of connections which
+                // were announced but not accepted
+                std::int32_t src[inbox::capacity];
+                std::uint32_t seq[inbox::capacity];
+                std::size_t count = inbox_->take(src, seq);
+                for (std::size_t i = 0; i != count; ++i)
+                {
+                    shared_memory::unlink(ring_name(pid_, src[i], seq[i]));
+                }
+
+                inbox_ = nullptr;
+                segment_.close();
+            }
+        }
+
+        bool background_work(std::size_t num_thread)
+        {
+            // We first try to accept new connections
+            bool has_work = accept();
+
+            connection_ptr connection;
+            {
+                std::unique_lock<mutex_type> l(
+                    connections_mtx_, std::try_to_lock);
+                if (l && !connections_.empty())
+                {
+                    connection = std::move(connections_.front());
+                    connections_.pop_front();
+                }
+            }
+
+            if (connection)
+            {
+                has_work = connection->receive(num_thread) || has_work;
+
+                // drop the connection if the sender has gone away
+                if (!connection->done())
+                {
+                    std::unique_lock<mutex_type> l(connections_mtx_);
+                    connections_.push_back(std::move(connection));
+                }
+            }
+
+            return has_work;
+        }
+
+    private:
+        bool accept()
+        {
+            std::unique_lock<mutex_type> l(inbox_mtx_, std::try_to_lock);
+            if (!l || inbox_ == nullptr || inbox_->empty())
+                return false;
+
+            std::int32_t src[inbox::capacity];
+            std::uint32_t seq[inbox::capacity];
+            std::size_t count = inbox_->take(src, seq);
+
+            for (std::size_t i = 0; i != count; ++i)
+            {
+                // Once mapped, the ring buffer stays alive until both sides
+                // have closed it. The sender creates the ring buffer before
+                // announcing it and doesn't remove its name as long as this
+                // process exists, this is the only place doing so.
+                std::string name = ring_name(pid_, src[i], seq[i]);
+                shared_memory segment;
+                if (!segment.open(name))
+                    continue;
+                shared_memory::unlink(name);
+
+                ring_buffer ring = ring_buffer::attach(std::move(segment));
+                if (!ring)
+                    continue;
+
+                connection_ptr connection =
+                    std::make_shared<connection_type>(std::move(ring), pp_);
+
+                std::unique_lock<mutex_type> lc(connections_mtx_);
+                connections_.push_back(std::move(connection));
+            }
+            return count != 0;
+        }
+
+        Parcelport& pp_;
+        std::int32_t const pid_;
+
+        mutex_type inbox_mtx_;
+        shared_memory segment_;
+        inbox* inbox_;
+
+        mutex_type connections_mtx_;
+        connection_list connections_;
+    };
+}}}}
+
+#endif
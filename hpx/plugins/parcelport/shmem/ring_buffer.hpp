@@ -0,0 +1,221 @@
+//  Copyright (c) 2020 STE||AR Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+
+#include <hpx/assert.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
+#include <hpx/plugins/parcelport/shmem/shared_memory.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <utility>
+
+namespace hpx { namespace parcelset { namespace policies { namespace shmem
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // A single producer, single consumer byte queue living in a shared
+    // memory object. The sending locality creates the object and writes to
+    // it, the receiving locality maps it after having been told about it and
+    // reads from it.
+    class ring_buffer
+    {
+        static_assert(ATOMIC_LLONG_LOCK_FREE == 2 && ATOMIC_INT_LOCK_FREE == 2,
+            "the shmem parcelport requires lock-free atomics which can be "
+            "shared between processes");
+
+        struct header
+        {
+            // number of bytes written so far, updated by the producer only
+            hpx::util::cache_line_data<std::atomic<std::uint64_t>> head_;
+
+            // number of bytes read so far, updated by the consumer only
+            hpx::util::cache_line_data<std::atomic<std::uint64_t>> tail_;
+
+            std::uint64_t capacity_;
+
+            // set by the producer after it has written its last byte
+            std::atomic<std::uint32_t> closed_;
+
+            // set by the consumer once it has mapped the ring buffer, from
+            // then on the consumer is responsible for removing its name
+            std::atomic<std::uint32_t> attached_;
+        };
+
+    public:
+        ring_buffer() noexcept
+          : header_(nullptr), buffer_(nullptr), capacity_(0)
+        {}
+
+        ring_buffer(ring_buffer&& rhs) noexcept
+          : segment_(std::move(rhs.segment_))
+          , header_(rhs.header_)
+          , buffer_(rhs.buffer_)
+          , capacity_(rhs.capacity_)
+        {
+            rhs.header_ = nullptr;
+            rhs.buffer_ = nullptr;
+            rhs.capacity_ = 0;
+        }
+
+        ring_buffer& operator=(ring_buffer&& rhs) noexcept
+        {
+            if (this != &rhs)
+            {
+                segment_ = std::move(rhs.segment_);
+                header_ = rhs.header_;
+                buffer_ = rhs.buffer_;
+                capacity_ = rhs.capacity_;
+                rhs.header_ = nullptr;
+                rhs.buffer_ = nullptr;
+                rhs.capacity_ = 0;
+            }
+            return *this;
+        }
+
+        // The size of the shared memory object needed for a ring buffer with
+        // the given capacity (which must be a power of two).
+        static std::size_t segment_size(std::size_t capacity)
+        {
+            return sizeof(header) + capacity;
+        }
+
+        // Initialize a newly created shared memory object (producer side).
+        explicit ring_buffer(shared_memory&& segment)
+          : segment_(std::move(segment))
+          , header_(new (segment_.data()) header())
+          , buffer_(static_cast<char*>(segment_.data()) + sizeof(header))
+          , capacity_(segment_.size() - sizeof(header))
+        {
+            HPX_ASSERT((capacity_ & (capacity_ - 1)) == 0);
+
+            header_->head_.data_.store(0, std::memory_order_relaxed);
+            header_->tail_.data_.store(0, std::memory_order_relaxed);
+            header_->capacity_ = capacity_;
+            header_->attached_.store(0, std::memory_order_relaxed);
+            header_->closed_.store(0, std::memory_order_release);
+        }
+
+        // Attach to a shared memory object initialized by the producer
+        // (consumer side).
+        static ring_buffer attach(shared_memory&& segment)
+        {
+            ring_buffer ring;
+            if (segment.size() <= sizeof(header))
+                return ring;
+
+            header* h = static_cast<header*>(segment.data());
+            if (h->capacity_ != segment.size() - sizeof(header))
+                return ring;
+
+            h->attached_.store(1, std::memory_order_release);
+
+            ring.header_ = h;
+            ring.buffer_ = static_cast<char*>(segment.data()) + sizeof(header);
+            ring.capacity_ = h->capacity_;
+            ring.segment_ = std::move(segment);
+            return ring;
+        }
+
+        explicit operator bool() const noexcept
+        {
+            return header_ != nullptr;
+        }
+
+        // Copy as many bytes as there is space for, returns the number of
+        // bytes written.
+        std::size_t write(void const* data, std::size_t size) noexcept
+        {
+            std::uint64_t head =
+                header_->head_.data_.load(std::memory_order_relaxed);
+            std::uint64_t tail =
+                header_->tail_.data_.load(std::memory_order_acquire);
+
+            std::size_t count = (std::min)(
+                size, static_cast<std::size_t>(capacity_ - (head - tail)));
+            if (count == 0)
+                return 0;
+
+            std::size_t offset = static_cast<std::size_t>(head) &
+                static_cast<std::size_t>(capacity_ - 1);
+            std::size_t first = (std::min)(count, capacity_ - offset);
+
+            char const* src = static_cast<char const*>(data);
+            std::memcpy(buffer_ + offset, src, first);
+            std::memcpy(buffer_, src + first, count - first);
+
+            header_->head_.data_.store(head + count, std::memory_order_release);
+            return count;
+        }
+
+        // Copy as many bytes as are available, returns the number of bytes
+        // read.
+        std::size_t read(void* data, std::size_t size) noexcept
+        {
+            std::uint64_t tail =
+                header_->tail_.data_.load(std::memory_order_relaxed);
+            std::uint64_t head =
+                header_->head_.data_.load(std::memory_order_acquire);
+
+            std::size_t count =
+                (std::min)(size, static_cast<std::size_t>(head - tail));
+            if (count == 0)
+                return 0;
+
+            std::size_t offset = static_cast<std::size_t>(tail) &
+                static_cast<std::size_t>(capacity_ - 1);
+            std::size_t first = (std::min)(count, capacity_ - offset);
+
+            char* dest = static_cast<char*>(data);
+            std::memcpy(dest, buffer_ + offset, first);
+            std::memcpy(dest + first, buffer_, count - first);
+
+            header_->tail_.data_.store(tail + count, std::memory_order_release);
+            return count;
+        }
+
+        // Tell the consumer that no more data will be written.
+        void close() noexcept
+        {
+            if (header_ != nullptr)
+                header_->closed_.store(1, std::memory_order_release);
+        }
+
+        // Return whether the consumer has mapped the ring buffer.
+        bool attached() const noexcept
+        {
+            return header_ != nullptr &&
+                header_->attached_.load(std::memory_order_acquire) != 0;
+        }
+
+        // Return whether the producer has gone away after having written all
+        // of its data and all of the data has been read.
+        bool drained() const noexcept
+        {
+            if (header_->closed_.load(std::memory_order_acquire) == 0)
+                return false;
+
+            return header_->head_.data_.load(std::memory_order_acquire) ==
+                header_->tail_.data_.load(std::memory_order_relaxed);
+        }
+
+    private:
+        shared_memory segment_;
+        header* header_;
+        char* buffer_;
+        std::size_t capacity_;
+    };
+}}}}
+
+#endif
@@ -0,0 +1,369 @@
+//  Copyright (c) 2020 STE||AR Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+
+#include <hpx/assert.hpp>
+#include <hpx/functional/unique_function.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/plugins/parcelport/shmem/locality.hpp>
+#include <hpx/plugins/parcelport/shmem/ring_buffer.hpp>
+#include <hpx/plugins/parcelport/shmem/shared_memory.hpp>
+#include <hpx/runtime/parcelset/locality.hpp>
+#include <hpx/runtime/parcelset/parcelport.hpp>
+#include <hpx/runtime/parcelset/parcelport_connection.hpp>
+#include <hpx/serialization/serialization_chunk.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+#include <hpx/timing/high_resolution_timer.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace parcelset { namespace policies { namespace shmem
+{
+    class sender;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // An outgoing connection to a locality on the same host. All messages
+    // are copied into a ring buffer shared with the receiving locality,
+    // directly from the serialization buffer and from the memory referenced
+    // by the zero-copy chunks. Messages larger than the ring buffer are
+    // streamed, progress is made from the background work of the
+    // parcelport. If the ring buffer stays full, the receiving process is
+    // checked periodically and the message fails once it has gone away.
+    class sender_connection
+      : public parcelset::parcelport_connection<
+            sender_connection
+          , std::vector<char>
+        >
+    {
+        enum connection_state
+        {
+            initialized
+          , sent_header
+          , sent_transmission_chunks
+          , sent_data
+          , sent_chunks
+        };
+
+        // the number of unsuccessful attempts to write to a full ring buffer
+        // after which the receiving process is checked
+        static constexpr std::size_t peer_check_interval = 128;
+
+    public:
+        sender_connection(sender* s, ring_buffer&& ring, std::string name,
+            parcelset::locality const& there, parcelset::parcelport* pp)
+          : state_(initialized)
+          , sender_(s)
+          , ring_(std::move(ring))
+          , name_(std::move(name))
+          , offset_(0)
+          , chunks_idx_(0)
+          , stalled_(0)
+          , pp_(pp)
+          , there_(there)
+        {
+        }
+
+        ~sender_connection()
+        {
+            ring_.close();
+
+            // The receiver removes the name after having mapped the ring
+            // buffer, it may still do so later if it is alive. Otherwise
+            // nobody else will.
+            if (!ring_.attached() &&
+                !process_exists(there_.get<locality>().pid()))
+            {
+                shared_memory::unlink(name_);
+            }
+        }
+
+        parcelset::locality const& destination() const
+        {
+            return there_;
+        }
+
+        void verify_(parcelset::locality const& /* parcel_locality_id */) const
+        {
+        }
+
+        template <typename Handler, typename ParcelPostprocess>
+        void async_write(Handler && handler,
+            ParcelPostprocess && parcel_postprocess);
+
+        // Write as much of the current message as fits into the ring
+        // buffer, returns true if the message was sent completely or if it
+        // failed because the receiving process has gone away.
+        bool send()
+        {
+            if (write_message())
+                return done(std::error_code());
+
+            if (!peer_gone())
+                return false;
+
+            return done(std::make_error_code(std::errc::connection_reset));
+        }
+
+        util::unique_function_nonser<
+            void(
+                std::error_code const&
+              , parcelset::locality const&
+              , std::shared_ptr<sender_connection>
+            )
+        > postprocess_handler_;
+
+        std::error_code const& error() const
+        {
+            return ec_;
+        }
+
+    private:
+        bool write_message()
+        {
+            if (state_ == initialized)
+            {
+                if (!write(header_, sizeof(header_)))
+                    return false;
+                state_ = sent_header;
+            }
+
+            if (state_ == sent_header)
+            {
+                std::vector<parcel_buffer_type::transmission_chunk_type>&
+                    chunks = buffer_.transmission_chunks_;
+                if (!chunks.empty() &&
+                    !write(chunks.data(), chunks.size() *
+                        sizeof(parcel_buffer_type::transmission_chunk_type)))
+                {
+                    return false;
+                }
+                state_ = sent_transmission_chunks;
+            }
+
+            if (state_ == sent_transmission_chunks)
+            {
+                if (!write(buffer_.data_.data(), buffer_.data_.size()))
+                    return false;
+                state_ = sent_data;
+            }
+
+            if (state_ == sent_data)
+            {
+                // now send the chunks, those hold zero-copy serialized data
+                while (chunks_idx_ != buffer_.chunks_.size())
+                {
+                    serialization::serialization_chunk& c =
+                        buffer_.chunks_[chunks_idx_];
+                    if (c.type_ == serialization::chunk_type_pointer &&
+                        !write(c.data_.cpos_, c.size_))
+                    {
+                        return false;
+                    }
+                    ++chunks_idx_;
+                }
+                state_ = sent_chunks;
+            }
+
+            return true;
+        }
+
+        bool write(void const* data, std::size_t size)
+        {
+            std::size_t count = ring_.write(
+                static_cast<char const*>(data) + offset_, size - offset_);
+            if (count != 0)
+            {
+                offset_ += count;
+                stalled_ = 0;
+            }
+            else
+            {
+                ++stalled_;
+            }
+
+            if (offset_ != size)
+                return false;
+
+            offset_ = 0;
+            return true;
+        }
+
+        // The ring buffer has been full for a while, check whether the
+        // receiving process still exists.
+        bool peer_gone() const
+        {
+            return stalled_ != 0 && stalled_ % peer_check_interval == 0 &&
+                !process_exists(there_.get<locality>().pid());
+        }
+
+        bool done(std::error_code const& ec)
+        {
+            HPX_ASSERT(state_ == sent_chunks || ec);
+
+            ec_ = ec;
+            handler_(ec);
+            handler_.reset();
+
+            if (!ec)
+            {
+                buffer_.data_point_.time_ =
+                    timer_.elapsed_nanoseconds() - buffer_.data_point_.time_;
+                pp_->add_sent_data(buffer_.data_point_);
+            }
+            buffer_.clear();
+
+            state_ = initialized;
+            return true;
+        }
+
+        connection_state state_;
+        sender* sender_;
+        ring_buffer ring_;
+        std::string name_;
+
+        // size_, data_size_, and the number of chunks of the current message
+        std::uint64_t header_[3];
+
+        std::size_t offset_;        // bytes written of the current piece
+        std::size_t chunks_idx_;
+        std::size_t stalled_;       // attempts without progress
+        std::error_code ec_;
+
+        util::unique_function_nonser<void(std::error_code const&)> handler_;
+
+        hpx::chrono::high_resolution_timer timer_;
+        parcelset::parcelport* pp_;
+        parcelset::locality there_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Creates the outgoing connections and keeps track of all connections
+    // which have messages in flight.
+    class sender
+    {
+    public:
+        typedef sender_connection connection_type;
+        typedef std::shared_ptr<connection_type> connection_ptr;
+        typedef std::deque<connection_ptr> connection_list;
+
+        typedef hpx::lcos::local::spinlock mutex_type;
+
+        sender(std::int32_t pid, std::size_t ring_size)
+          : pid_(pid)
+          , ring_size_(ring_size)
+          , next_seq_(0)
+        {
+        }
+
+        connection_ptr create_connection(parcelset::locality const& dest,
+            parcelset::parcelport* pp, error_code& ec);
+
+        void add(connection_ptr const& ptr)
+        {
+            std::unique_lock<mutex_type> l(connections_mtx_);
+            connections_.push_back(ptr);
+        }
+
+        bool background_work()
+        {
+            connection_ptr connection;
+            {
+                std::unique_lock<mutex_type> l(
+                    connections_mtx_, std::try_to_lock);
+                if (l && !connections_.empty())
+                {
+                    connection = std::move(connections_.front());
+                    connections_.pop_front();
+                }
+            }
+
+            if (!connection)
+                return false;
+
+            // Check if sending has been completed....
+            if (connection->send())
+            {
+                util::unique_function_nonser<
+                    void(
+                        std::error_code const&
+                      , parcelset::locality const&
+                      , connection_ptr
+                    )
+                > postprocess_handler;
+                std::swap(
+                    postprocess_handler, connection->postprocess_handler_);
+                postprocess_handler(connection->error(),
+                    connection->destination(), connection);
+            }
+            else
+            {
+                add(connection);
+            }
+            return true;
+        }
+
+    private:
+        std::int32_t const pid_;
+        std::size_t const ring_size_;
+        std::atomic<std::uint32_t> next_seq_;
+
+        mutex_type connections_mtx_;
+        connection_list connections_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Handler, typename ParcelPostprocess>
+    void sender_connection::async_write(Handler && handler,
+        ParcelPostprocess && parcel_postprocess)
+    {
+        HPX_ASSERT(!handler_);
+        HPX_ASSERT(!postprocess_handler_);
+        HPX_ASSERT(!buffer_.data_.empty());
+
+        buffer_.data_point_.time_ = timer_.elapsed_nanoseconds();
+
+        header_[0] = buffer_.size_;
+        header_[1] = buffer_.data_size_;
+        header_[2] = static_cast<std::uint64_t>(buffer_.num_chunks_.first) |
+            (static_cast<std::uint64_t>(buffer_.num_chunks_.second) << 32);
+
+        state_ = initialized;
+        offset_ = 0;
+        chunks_idx_ = 0;
+        stalled_ = 0;
+        ec_ = std::error_code();
+
+        handler_ = std::forward<Handler>(handler);
+
+        if (!send())
+        {
+            postprocess_handler_ =
+                std::forward<ParcelPostprocess>(parcel_postprocess);
+            sender_->add(shared_from_this());
+        }
+        else
+        {
+            HPX_ASSERT(!handler_);
+            parcel_postprocess(ec_, there_, shared_from_this());
+        }
+    }
+}}}}
+
+#endif
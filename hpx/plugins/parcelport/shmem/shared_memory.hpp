@@ -0,0 +1,105 @@
+//  Copyright (c) 2020 STE||AR Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace hpx { namespace parcelset { namespace policies { namespace shmem
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // The name of the shared memory object a locality uses to receive the
+    // announcements of new incoming connections.
+    std::string inbox_name(std::int32_t pid);
+
+    // The name of the shared memory object holding the ring buffer of the
+    // connection with the given sequence number from src to dst.
+    std::string ring_name(
+        std::int32_t dst, std::int32_t src, std::uint32_t seq);
+
+    // Return whether the process with the given id still exists.
+    bool process_exists(std::int32_t pid) noexcept;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // A mapping of a POSIX shared memory object into the address space of
+    // this process.
+    class shared_memory
+    {
+    public:
+        shared_memory() noexcept
+          : data_(nullptr), size_(0)
+        {}
+
+        ~shared_memory()
+        {
+            close();
+        }
+
+        shared_memory(shared_memory const&) = delete;
+        shared_memory& operator=(shared_memory const&) = delete;
+
+        shared_memory(shared_memory&& rhs) noexcept
+          : data_(rhs.data_), size_(rhs.size_)
+        {
+            rhs.data_ = nullptr;
+            rhs.size_ = 0;
+        }
+
+        shared_memory& operator=(shared_memory&& rhs) noexcept
+        {
+            if (this != &rhs)
+            {
+                close();
+                data_ = rhs.data_;
+                size_ = rhs.size_;
+                rhs.data_ = nullptr;
+                rhs.size_ = 0;
+            }
+            return *this;
+        }
+
+        // Create a new shared memory object of the given size and map it.
+        // This fails if an object with the same name exists already.
+        bool create(std::string const& name, std::size_t size);
+
+        // Map an existing shared memory object.
+        bool open(std::string const& name);
+
+        // Unmap the shared memory object.
+        void close() noexcept;
+
+        // Remove the name of a shared memory object. The object itself is
+        // destroyed as soon as all processes have closed their mappings.
+        static void unlink(std::string const& name) noexcept;
+
+        void* data() const noexcept
+        {
+            return data_;
+        }
+
+        std::size_t size() const noexcept
+        {
+            return size_;
+        }
+
+        explicit operator bool() const noexcept
+        {
+            return data_ != nullptr;
+        }
+
+    private:
+        void* data_;
+        std::size_t size_;
+    };
+}}}}
+
+#endif
@@ -21,8 +21,13 @@
 
 #include <boost/asio/ip/host_name.hpp>
 #include <boost/asio/ip/tcp.hpp>
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+#include <boost/asio/posix/stream_descriptor.hpp>
+#endif
 
+#include <atomic>
 #include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <set>
 #include <string>
@@ -38,6 +43,7 @@ namespace hpx { namespace parcelset
     {
         class receiver;
         class sender;
+        class io_uring_service;
         class HPX_EXPORT connection_handler;
     }}
 
@@ -46,7 +52,7 @@ namespace hpx { namespace parcelset
     {
         typedef policies::tcp::sender connection_type;
         typedef std::true_type  send_early_parcel;
-        typedef std::false_type do_background_work;
+        typedef std::true_type  do_background_work;
         typedef std::false_type send_immediate_parcels;
 
         static const char * type()
@@ -107,7 +113,16 @@ namespace hpx { namespace parcelset
 
             parcelset::locality create_locality() const;
 
+            /// Reap the completed operations if the io_uring backend is used
+            bool background_work(
+                std::size_t num_thread, parcelport_background_mode mode);
+
         private:
+            io_uring_service* get_io_uring() const;
+            void start_io_uring_wait();
+            void wait_for_io_uring();
+            void handle_io_uring_event(std::error_code const& e);
+
             void handle_accept(std::error_code const & e,
                 std::shared_ptr<receiver> receiver_conn);
             void handle_read_completion(std::error_code const& e,
@@ -126,6 +141,21 @@ namespace hpx { namespace parcelset
             typedef std::set<boost::weak_ptr<sender> > write_connections_set;
             write_connections_set write_connections_;
 #endif
+
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+            /// Transfers the data instead of asio if hpx.parcel.tcp.backend
+            /// is set to io_uring
+            std::unique_ptr<io_uring_service> uring_;
+
+            /// Waits for the completions of the io_uring instance on the
+            /// io_service while HPX is starting up or shutting down
+            lcos::local::spinlock uring_event_mtx_;
+            std::unique_ptr<boost::asio::posix::stream_descriptor>
+                uring_event_;
+            std::uint64_t uring_event_value_;
+            std::atomic<bool> uring_waiting_;
+#endif
+            std::atomic<bool> stopped_;
         };
     }}
 }}
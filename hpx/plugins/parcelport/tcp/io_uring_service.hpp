@@ -0,0 +1,189 @@
+//  Copyright (c) 2020 STE||AR Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_PARCELPORT_TCP) &&                                        \
+    defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+
+#include <hpx/config/asio.hpp>
+#include <hpx/functional/unique_function.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+
+#include <boost/asio/buffer.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <system_error>
+#include <vector>
+
+#include <sys/uio.h>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx { namespace parcelset { namespace policies { namespace tcp
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // Drives the data transfer of the TCP connections through a Linux
+    // io_uring instance instead of the asio reactor. Operations are queued
+    // by the connections and are submitted in batches, the completions are
+    // reaped from the background work of the parcelport, i.e. by the HPX
+    // scheduler. The completions are signalled on an eventfd which allows
+    // to wait for them while the scheduler is not running. Connections are
+    // still established using asio.
+    class HPX_EXPORT io_uring_service
+    {
+    public:
+        typedef util::unique_function_nonser<
+            void(std::error_code const&, std::size_t)
+        > handler_type;
+
+        explicit io_uring_service(std::size_t entries);
+        ~io_uring_service();
+
+        io_uring_service(io_uring_service const&) = delete;
+        io_uring_service& operator=(io_uring_service const&) = delete;
+
+        // Return whether the io_uring instance could be created, the kernel
+        // might not support io_uring (or not all of the needed features).
+        bool valid() const
+        {
+            return ring_fd_ >= 0;
+        }
+
+        // Send all of the given buffers, the handler is invoked once all
+        // data has been sent or an error occurred.
+        void async_send(int fd, std::vector<iovec>&& buffers,
+            handler_type&& handler);
+
+        // Fill all of the given buffers, the handler is invoked once all
+        // data has been received or an error occurred.
+        void async_receive(int fd, std::vector<iovec>&& buffers,
+            handler_type&& handler);
+
+        // Submit all queued operations and invoke the handlers of the
+        // completed ones. Returns whether any progress was made.
+        bool poll();
+
+        // Abort all operations for the given file descriptor which have not
+        // been handed to the kernel yet, operations in flight are not
+        // resubmitted anymore. This has to be called before the file
+        // descriptor is closed as the number might be reused afterwards.
+        void cancel(int fd);
+
+        // Return the eventfd which is signalled whenever operations have
+        // completed.
+        int event_fd() const
+        {
+            return event_fd_;
+        }
+
+        // Additionally signal the eventfd whenever an operation is queued,
+        // this is used while the queue is not handled by the scheduler.
+        void notify_on_enqueue(bool notify)
+        {
+            notify_.store(notify, std::memory_order_release);
+        }
+
+        // Return the number of operations which have not completed yet.
+        std::size_t outstanding() const
+        {
+            return outstanding_.load(std::memory_order_acquire);
+        }
+
+    private:
+        struct operation;
+
+        void release();
+        void enqueue(operation* op);
+        void link(operation* op);
+        void unlink(operation* op);
+        std::size_t submit();
+        std::size_t reap(std::vector<operation*>& completed);
+
+        typedef hpx::lcos::local::spinlock mutex_type;
+
+        int ring_fd_;
+        int event_fd_;
+
+        // the memory shared with the kernel
+        void* sq_ring_;
+        std::size_t sq_ring_size_;
+        void* cq_ring_;
+        std::size_t cq_ring_size_;
+        void* sqes_;
+        std::size_t sqes_size_;
+
+        unsigned* sq_head_;
+        unsigned* sq_tail_;
+        unsigned sq_mask_;
+        unsigned* sq_array_;
+        unsigned sq_entries_;
+
+        unsigned* cq_head_;
+        unsigned* cq_tail_;
+        unsigned cq_mask_;
+        void* cqes_;
+        unsigned cq_entries_;
+
+        // operations waiting to be submitted and cancelled operations
+        // waiting for their handlers to be invoked
+        mutex_type pending_mtx_;
+        std::vector<operation*> pending_;
+        std::vector<operation*> aborted_;
+
+        // only one thread at a time submits and reaps, the operations in
+        // flight are linked into a list
+        mutex_type poll_mtx_;
+        std::size_t in_flight_;
+        operation* in_flight_ops_;
+
+        std::atomic<std::size_t> outstanding_;
+        std::atomic<bool> notify_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    inline iovec to_iovec(boost::asio::const_buffer const& b)
+    {
+        iovec v;
+        v.iov_base =
+            const_cast<void*>(boost::asio::buffer_cast<void const*>(b));
+        v.iov_len = boost::asio::buffer_size(b);
+        return v;
+    }
+
+    inline iovec to_iovec(boost::asio::mutable_buffer const& b)
+    {
+        iovec v;
+        v.iov_base = boost::asio::buffer_cast<void*>(b);
+        v.iov_len = boost::asio::buffer_size(b);
+        return v;
+    }
+
+    template <typename Buffer>
+    std::vector<iovec> to_iovecs(std::vector<Buffer> const& buffers)
+    {
+        std::vector<iovec> result;
+        result.reserve(buffers.size());
+        for (Buffer const& b : buffers)
+        {
+            result.push_back(to_iovec(b));
+        }
+        return result;
+    }
+
+    template <typename Buffer>
+    std::vector<iovec> to_iovecs(Buffer const& buffer)
+    {
+        return std::vector<iovec>(1, to_iovec(buffer));
+    }
+}}}}
+
+#include <hpx/config/warnings_suffix.hpp>
+
+#endif
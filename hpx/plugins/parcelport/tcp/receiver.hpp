@@ -24,10 +24,12 @@
 #include <hpx/execution_base/this_thread.hpp>
 #include <hpx/functional/bind.hpp>
 #include <hpx/functional/protect.hpp>
+#include <hpx/plugins/parcelport/tcp/io_uring_service.hpp>
 #include <hpx/runtime/parcelset/decode_parcels.hpp>
 #include <hpx/runtime/parcelset/detail/data_point.hpp>
 #include <hpx/runtime/parcelset/detail/gatherer.hpp>
 #include <hpx/runtime/parcelset/parcelport_connection.hpp>
+#include <hpx/serialization/serialize_buffer.hpp>
 #include <hpx/timing/high_resolution_timer.hpp>
 
 #include <boost/asio/buffer.hpp>
@@ -56,14 +58,19 @@
 namespace hpx { namespace parcelset { namespace policies { namespace tcp
 {
     class connection_handler;
+    class io_uring_service;
 
+    // The zero-copy chunks are received into buffers with shared ownership,
+    // those are handed over to the de-serialized serialize_buffer objects
+    // without copying the data again.
     class receiver
-      : public parcelport_connection<receiver, std::vector<char>, std::vector<char> >
+      : public parcelport_connection<receiver, std::vector<char>,
+            serialization::serialize_buffer<char> >
     {
         typedef hpx::lcos::local::spinlock mutex_type;
     public:
         receiver(boost::asio::io_service& io_service, std::uint64_t max_inbound_size,
-            connection_handler& parcelport)
+            connection_handler& parcelport, io_uring_service* uring = nullptr)
           : socket_(io_service)
           , max_inbound_size_(max_inbound_size)
           , ack_(0)
@@ -71,6 +78,7 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
           , timer_()
           , mtx_()
           , operation_in_flight_(0)
+          , uring_(uring)
         {}
 
         ~receiver()
@@ -124,7 +132,7 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
                         std::size_t, Handler)
                     = &receiver::handle_read_header<Handler>;
 
-                boost::asio::async_read(socket_, buffers,
+                async_read_buffers(buffers,
                     util::bind(f, shared_from_this(),
                         boost::asio::placeholders::error,
                         boost::asio::placeholders::bytes_transferred,
@@ -139,15 +147,55 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
             boost::system::error_code ec;
             if (socket_.is_open()) {
                 socket_.shutdown(boost::asio::ip::tcp::socket::shutdown_both, ec);
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+                // the descriptor may be reused once the socket is closed
+                if (uring_ != nullptr)
+                    uring_->cancel(socket_.native_handle());
+#endif
                 socket_.close(ec);    // close the socket to give it back to the OS
             }
 
+            // the operations still in flight are completed by the background
+            // work of the parcelport if the io_uring backend is used
+            if (uring_ != nullptr)
+                return;
+
             hpx::util::yield_while(
                 [this]() { return operation_in_flight_ != 0; },
                 "tcp::reveiver::shutdown");
         }
 
     private:
+        template <typename Buffers, typename Handler>
+        void async_read_buffers(Buffers const& buffers, Handler&& handler)
+        {
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+            if (uring_ != nullptr)
+            {
+                uring_->async_receive(socket_.native_handle(),
+                    to_iovecs(buffers), std::forward<Handler>(handler));
+                return;
+            }
+#endif
+            boost::asio::async_read(
+                socket_, buffers, std::forward<Handler>(handler));
+        }
+
+        template <typename Buffers, typename Handler>
+        void async_write_buffers(Buffers const& buffers, Handler&& handler)
+        {
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+            if (uring_ != nullptr)
+            {
+                uring_->async_send(socket_.native_handle(),
+                    to_iovecs(buffers), std::forward<Handler>(handler));
+                return;
+            }
+#endif
+            boost::asio::async_write(
+                socket_, buffers, std::forward<Handler>(handler));
+        }
+
         /// Handle a completed read of the message size from the
         /// message header.
         template <typename Handler>
@@ -205,6 +253,8 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
                             sizeof(transmission_chunk_type)));
 
                     // add main buffer holding data which was serialized normally
+                    parcelport_.get_buffer_pool().acquire(buffer_.data_,
+                        static_cast<std::size_t>(inbound_size));
                     buffer_.data_.resize(static_cast<std::size_t>(inbound_size));
                     buffers.push_back(boost::asio::buffer(buffer_.data_));
 
@@ -213,6 +263,8 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
                 }
                 else {
                     // add main buffer holding data which was serialized normally
+                    parcelport_.get_buffer_pool().acquire(buffer_.data_,
+                        static_cast<std::size_t>(inbound_size));
                     buffer_.data_.resize(static_cast<std::size_t>(inbound_size));
                     buffers.push_back(boost::asio::buffer(buffer_.data_));
 
@@ -235,7 +287,7 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
                         IPPROTO_TCP, TCP_QUICKACK> quickack(true);
                     socket_.set_option(quickack);
 #endif
-                    boost::asio::async_read(socket_, buffers,
+                    async_read_buffers(buffers,
                         util::bind(f, shared_from_this(),
                             boost::asio::placeholders::error,
                             util::protect(handler)));
@@ -269,7 +321,8 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
                 {
                     std::size_t chunk_size = static_cast<std::size_t>(
                         buffer_.transmission_chunks_[i].second);
-                    buffer_.chunks_[i].resize(chunk_size);
+                    buffer_.chunks_[i] =
+                        serialization::serialize_buffer<char>(chunk_size);
                     buffers.push_back(
                         boost::asio::buffer(buffer_.chunks_[i].data(), chunk_size));
                 }
@@ -294,7 +347,7 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
                         IPPROTO_TCP, TCP_QUICKACK> quickack(true);
                     socket_.set_option(quickack);
 #endif
-                    boost::asio::async_read(socket_, buffers,
+                    async_read_buffers(buffers,
                         util::bind(f, shared_from_this(),
                             boost::asio::placeholders::error,
                             util::protect(handler)));
@@ -339,7 +392,7 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
                             boost::asio::error::not_connected));
                         return;
                     }
-                    boost::asio::async_write(socket_,
+                    async_write_buffers(
                         boost::asio::buffer(&ack_, sizeof(ack_)),
                         util::bind(f, shared_from_this(),
                             boost::asio::placeholders::error,
@@ -380,6 +433,9 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
 
         mutex_type mtx_;
         hpx::util::atomic_count operation_in_flight_;
+
+        /// Transfers the data if the io_uring backend is used
+        io_uring_service* uring_;
     };
 }}}}
 
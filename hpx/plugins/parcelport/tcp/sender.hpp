@@ -22,6 +22,7 @@
 #include <hpx/functional/bind.hpp>
 #include <hpx/functional/deferred_call.hpp>
 #include <hpx/functional/unique_function.hpp>
+#include <hpx/plugins/parcelport/tcp/io_uring_service.hpp>
 #include <hpx/plugins/parcelport/tcp/locality.hpp>
 #include <hpx/runtime/parcelset/detail/data_point.hpp>
 #include <hpx/runtime/parcelset/detail/gatherer.hpp>
@@ -54,6 +55,8 @@
 
 namespace hpx { namespace parcelset { namespace policies { namespace tcp
 {
+    class io_uring_service;
+
     class sender
       : public parcelset::parcelport_connection<sender, std::vector<char> >
     {
@@ -62,14 +65,18 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
 
     public:
         /// Construct a sending parcelport_connection with the given io_service.
+        /// If an io_uring instance is given it is used to transfer the data
+        /// instead of the io_service.
         sender(boost::asio::io_service& io_service,
                 parcelset::locality const& locality_id,
-                parcelset::parcelport* pp)
+                parcelset::parcelport* pp,
+                io_uring_service* uring = nullptr)
           : socket_(io_service)
           , ack_(0)
           , there_(locality_id)
           , timer_()
           , pp_(pp)
+          , uring_(uring)
         {
         }
 
@@ -79,6 +86,11 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
             if (socket_.is_open()) {
                 boost::system::error_code ec;
                 socket_.shutdown(boost::asio::ip::tcp::socket::shutdown_both, ec);
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+                // the descriptor may be reused once the socket is closed
+                if (uring_ != nullptr)
+                    uring_->cancel(socket_.native_handle());
+#endif
                 socket_.close(ec);    // close the socket to give it back to the OS
             }
         }
@@ -178,11 +190,41 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
 
             using util::placeholders::_1;
             using util::placeholders::_2;
-            boost::asio::async_write(socket_, buffers,
+            async_write_buffers(buffers,
                 util::bind(f, shared_from_this(), _1, _2));
         }
 
     private:
+        template <typename Buffers, typename Handler>
+        void async_write_buffers(Buffers const& buffers, Handler&& handler)
+        {
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+            if (uring_ != nullptr)
+            {
+                uring_->async_send(socket_.native_handle(),
+                    to_iovecs(buffers), std::forward<Handler>(handler));
+                return;
+            }
+#endif
+            boost::asio::async_write(
+                socket_, buffers, std::forward<Handler>(handler));
+        }
+
+        template <typename Buffers, typename Handler>
+        void async_read_buffers(Buffers const& buffers, Handler&& handler)
+        {
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+            if (uring_ != nullptr)
+            {
+                uring_->async_receive(socket_.native_handle(),
+                    to_iovecs(buffers), std::forward<Handler>(handler));
+                return;
+            }
+#endif
+            boost::asio::async_read(
+                socket_, buffers, std::forward<Handler>(handler));
+        }
+
         static void reset_handler(postprocess_handler_type handler)
         {
             handler.reset();
@@ -246,8 +288,7 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
                 = &sender::handle_read_ack;
 
             using util::placeholders::_1;
-            boost::asio::async_read(socket_,
-                boost::asio::buffer(&ack_, sizeof(ack_)),
+            async_read_buffers(boost::asio::buffer(&ack_, sizeof(ack_)),
                 util::bind(f, shared_from_this(), _1));
         }
 
@@ -256,6 +297,7 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
 #if defined(HPX_TRACK_STATE_OF_OUTGOING_TCP_CONNECTION)
             state_ = state_handle_read_ack;
 #endif
+            pp_->get_buffer_pool().release(buffer_.data_);
             buffer_.clear();
             // Call post-processing handler, which will send remaining pending
             // parcels. Pass along the connection so it can be reused if more
@@ -283,6 +325,9 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
         hpx::chrono::high_resolution_timer timer_;
         parcelset::parcelport* pp_;
 
+        /// Transfers the data if the io_uring backend is used
+        io_uring_service* uring_;
+
         postprocess_handler_type handler_;
         util::unique_function_nonser<
             void(
@@ -102,6 +102,15 @@ namespace hpx { namespace plugins {
             fillini.emplace_back("max_outbound_message_size =  ${HPX_PARCEL_" +
                 name_uc + "_MAX_OUTBOUND_MESSAGE_SIZE" +
                 ":$[hpx.parcel.max_outbound_message_size]}");
+            fillini.emplace_back("max_pending_outbound_size =  ${HPX_PARCEL_" +
+                name_uc + "_MAX_PENDING_OUTBOUND_SIZE" +
+                ":$[hpx.parcel.max_pending_outbound_size]}");
+            fillini.emplace_back("buffer_pool_size =  ${HPX_PARCEL_" +
+                name_uc + "_BUFFER_POOL_SIZE" +
+                ":$[hpx.parcel.buffer_pool_size]}");
+            fillini.emplace_back("latency_histograms = ${HPX_PARCEL_" +
+                name_uc +
+                "_LATENCY_HISTOGRAMS:$[hpx.parcel.latency_histograms]}");
             fillini.emplace_back("array_optimization = ${HPX_PARCEL_" +
                 name_uc +
                 "_ARRAY_OPTIMIZATION:$[hpx.parcel.array_optimization]}");
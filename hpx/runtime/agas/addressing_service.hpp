@@ -15,15 +15,15 @@
 #include <hpx/agas/agas_fwd.hpp>
 #include <hpx/agas/gva.hpp>
 #include <hpx/agas/primary_namespace.hpp>
-#include <hpx/cache/lru_cache.hpp>
-#include <hpx/cache/statistics/local_full_statistics.hpp>
 #include <hpx/components_base/pinned_ptr.hpp>
+#include <hpx/datastructures/tuple.hpp>
 #include <hpx/functional/function.hpp>
 #include <hpx/modules/errors.hpp>
 #include <hpx/modules/runtime_configuration.hpp>
 #include <hpx/naming_base/address.hpp>
 #include <hpx/naming_base/id_type.hpp>
 #include <hpx/runtime/agas/component_namespace.hpp>
+#include <hpx/runtime/agas/detail/gva_cache.hpp>
 #include <hpx/runtime/agas/locality_namespace.hpp>
 #include <hpx/runtime/agas/symbol_namespace.hpp>
 #include <hpx/runtime/parcelset_fwd.hpp>
@@ -72,35 +72,39 @@ public:
     // }}}
 
     // {{{ gva cache
-    struct gva_cache_key;
-
-    typedef hpx::util::cache::lru_cache<
-        gva_cache_key
-      , gva
-      , hpx::util::cache::statistics::local_full_statistics
-    > gva_cache_type;
+    typedef detail::gva_cache gva_cache_type;
     // }}}
 
     typedef std::set<naming::gid_type> migrated_objects_table_type;
     typedef std::map<naming::gid_type, std::int64_t> refcnt_requests_type;
 
-    mutable mutex_type gva_cache_mtx_;
     std::shared_ptr<gva_cache_type> gva_cache_;
 
     mutable mutex_type migrated_objects_mtx_;
     migrated_objects_table_type migrated_objects_table_;
 
+    // number of entries in the migrated objects table, allows to skip
+    // acquiring the lock if no object is being (or was) migrated
+    std::atomic<std::size_t> migrated_objects_count_;
+
     mutable mutex_type console_cache_mtx_;
     std::uint32_t console_cache_;
 
     std::size_t const max_refcnt_requests_;
+    std::int64_t const max_refcnt_requests_delay_;    // [ns]
 
     mutex_type refcnt_requests_mtx_;
     std::size_t refcnt_requests_count_;
+    std::int64_t refcnt_requests_start_time_;    // time of oldest request
     bool enable_refcnt_caching_;
 
     std::shared_ptr<refcnt_requests_type> refcnt_requests_;
 
+    // statistics about the buffered reference counting requests
+    std::atomic<std::int64_t> refcnt_requests_cancelled_;
+    std::atomic<std::int64_t> refcnt_requests_coalesced_;
+    std::atomic<std::int64_t> refcnt_requests_sent_;
+
     service_mode const service_type;
     runtime_mode const runtime_type;
 
@@ -208,6 +212,13 @@ public:
         error_code& ec = throws
         );
 
+    /// Send the buffered reference counting requests if the oldest of them
+    /// is pending for longer than the configured delay. This is invoked
+    /// periodically from the background work of the scheduler.
+    void garbage_collect_if_due(
+        error_code& ec = throws
+        );
+
     std::int64_t synchronize_with_async_incref(
         hpx::future<std::int64_t> fut
       , naming::id_type const& id
@@ -249,6 +260,10 @@ protected:
         naming::gid_type const& id
       , future<primary_namespace::resolved_type> f
         );
+    naming::address resolved_address_postproc(
+        naming::gid_type const& id
+      , primary_namespace::resolved_type const& rep
+        );
     bool bind_postproc(
         naming::gid_type const& id
       , gva const& g
@@ -285,6 +300,25 @@ private:
       , error_code& ec
         );
 
+    typedef std::map<
+            naming::id_type
+          , std::vector<
+                hpx::tuple<std::int64_t, naming::gid_type, naming::gid_type>
+            >
+        > refcnt_requests_per_locality_type;
+
+    /// Group the given requests by the locality responsible for them,
+    /// requests for consecutive GIDs with the same credit are coalesced
+    /// into a single range.
+    refcnt_requests_per_locality_type collect_refcnt_requests(
+        refcnt_requests_type const& requests
+        );
+
+    // Helper functions to access the reference counting statistics
+    std::uint64_t get_refcnt_requests_cancelled(bool);
+    std::uint64_t get_refcnt_requests_coalesced(bool);
+    std::uint64_t get_refcnt_requests_sent(bool);
+
     // Helper functions to access the current cache statistics
     std::uint64_t get_cache_entries(bool);
     std::uint64_t get_cache_hits(bool);
@@ -625,6 +659,28 @@ public:
         return bind_range_async(id, 1, addr, 0, locality);
     }
 
+    /// \brief Bind the given global ids to the given local addresses
+    ///
+    /// This is the bulk version of \a bind_async. The global ids are
+    /// grouped by the AGAS service instance managing them, each group is
+    /// bound using a single request. The returned vector holds the result
+    /// of binding each of the global ids.
+    hpx::future<std::vector<bool>> bind_async(
+        std::vector<naming::gid_type> const& ids
+      , std::vector<naming::address> const& addrs
+      , naming::gid_type const& locality
+        );
+
+    hpx::future<std::vector<bool>> bind_async(
+        std::vector<naming::gid_type> const& ids
+      , std::vector<naming::address> const& addrs
+      , std::uint32_t locality_id
+        )
+    {
+        return bind_async(ids, addrs,
+            naming::get_gid_from_locality_id(locality_id));
+    }
+
     /// \brief Bind unique range of global ids to given base address
     ///
     /// Every locality needs to be able to bind global ids to different
@@ -1013,6 +1069,16 @@ public:
         return resolve_async(id.get_gid());
     }
 
+    /// \brief Resolve the given global ids to their local addresses
+    ///
+    /// This is the bulk version of \a resolve_async. All global ids which
+    /// can't be resolved from the cache are grouped by the AGAS service
+    /// instance managing them, each group is resolved using a single
+    /// request. The answers are used to update the cache.
+    hpx::future<std::vector<naming::address>> resolve_async(
+        std::vector<naming::gid_type> const& ids
+        );
+
     ///////////////////////////////////////////////////////////////////////////
     hpx::future<naming::id_type> get_colocation_id_async(
         naming::id_type const& id
@@ -1249,6 +1315,16 @@ public:
       , naming::id_type const& id
         );
 
+    /// \brief Register the given global ids with the given names
+    ///
+    /// This is the bulk version of \a register_name_async. The names are
+    /// grouped by the AGAS service instance responsible for them, each
+    /// group is registered using a single request.
+    lcos::future<std::vector<bool>> register_names_async(
+        std::vector<std::string> const& names
+      , std::vector<naming::id_type> const& ids
+        );
+
     bool register_name(
         std::string const& name
         , naming::id_type const& id
@@ -1315,6 +1391,15 @@ public:
         std::string const& name
         );
 
+    /// \brief Resolve the given names to global ids
+    ///
+    /// This is the bulk version of \a resolve_name_async. Names bound on
+    /// other localities are served from the local name cache if possible,
+    /// all others are resolved using one request per AGAS service instance.
+    lcos::future<std::vector<naming::id_type>> resolve_names_async(
+        std::vector<std::string> const& names
+        );
+
     naming::id_type resolve_name(
         std::string const& name
       , error_code& ec = throws
@@ -1415,6 +1500,13 @@ public:
     /// Remove the given object from the table of migrated objects
     void unmark_as_migrated(naming::gid_type const& gid);
 
+    /// Return whether the table of migrated objects holds any entries, the
+    /// pinning of migratable objects has to go through the table otherwise
+    bool has_migrated_objects() const
+    {
+        return migrated_objects_count_.load(std::memory_order_acquire) != 0;
+    }
+
     // Pre-cache locality endpoints in hosted locality namespace
     void pre_cache_endpoints(std::vector<parcelset::endpoints_type> const&);
 };
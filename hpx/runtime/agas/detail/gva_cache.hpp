@@ -0,0 +1,149 @@
+//  Copyright (c) 2020 STE||AR Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/agas/gva.hpp>
+#include <hpx/naming_base/gid_type.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx { namespace agas { namespace detail
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // The cache of global virtual addresses used by the addressing service.
+    //
+    // Entries are keyed by ranges of (stripped) GIDs and are distributed over
+    // a fixed number of shards. Looking up an entry does not acquire any
+    // lock: the entries of a shard are guarded by a sequence counter which
+    // allows readers to validate the data they have read, while writers
+    // serialize on a per-shard spinlock. Entries are evicted using the CLOCK
+    // (second chance) algorithm, a cache hit only sets the referenced flag of
+    // the entry.
+    class HPX_EXPORT gva_cache
+    {
+    public:
+        // max_size is the overall number of entries the cache may hold, zero
+        // means no limit
+        explicit gva_cache(std::size_t max_size = 0);
+        ~gva_cache();
+
+        gva_cache(gva_cache const&) = delete;
+        gva_cache& operator=(gva_cache const&) = delete;
+
+        // Return the number of entries held by the cache
+        std::size_t size() const;
+
+        // Return the maximum number of entries the cache may hold
+        std::size_t capacity() const
+        {
+            return max_size_.load(std::memory_order_relaxed);
+        }
+
+        // Change the maximum number of entries the cache may hold
+        void reserve(std::size_t max_size);
+
+        // Look up the entry for the given GID, returns the base GID of the
+        // range the entry was registered for and the (unresolved) address.
+        bool get_entry(naming::gid_type const& gid, naming::gid_type& idbase,
+            gva& g);
+
+        // Insert the entry for the given range of GIDs or update an existing
+        // entry for the same range. Returns false if the range collides with
+        // a different entry.
+        bool update_if(naming::gid_type const& gid, std::uint64_t count,
+            gva const& g);
+
+        // Remove the entry registered for the range starting at the given GID
+        std::size_t erase(naming::gid_type const& gid);
+
+        // Remove all entries
+        std::size_t clear();
+
+        ///////////////////////////////////////////////////////////////////////
+        // The counters collected by the cache, all functions return the sum
+        // over all shards
+        class HPX_EXPORT statistics
+        {
+        public:
+            explicit statistics(gva_cache& cache)
+              : cache_(cache)
+            {
+            }
+
+            std::int64_t hits(bool reset);
+            std::int64_t misses(bool reset);
+            std::int64_t evictions(bool reset);
+            std::int64_t insertions(bool reset);
+
+            std::int64_t get_get_entry_count(bool reset);
+            std::int64_t get_insert_entry_count(bool reset);
+            std::int64_t get_update_entry_count(bool reset);
+            std::int64_t get_erase_entry_count(bool reset);
+
+            std::int64_t get_get_entry_time(bool reset);
+            std::int64_t get_insert_entry_time(bool reset);
+            std::int64_t get_update_entry_time(bool reset);
+            std::int64_t get_erase_entry_time(bool reset);
+
+        private:
+            gva_cache& cache_;
+        };
+
+        statistics get_statistics()
+        {
+            return statistics(*this);
+        }
+
+    private:
+        struct entry;
+        struct slot;
+        struct slot_array;
+        struct shard_data;
+        struct shard;
+        class update_on_exit;
+
+        enum counter
+        {
+            counter_hits = 0,
+            counter_misses,
+            counter_evictions,
+            counter_insertions,
+            counter_get_entry_count,
+            counter_insert_entry_count,
+            counter_update_entry_count,
+            counter_erase_entry_count,
+            counter_get_entry_time,
+            counter_insert_entry_time,
+            counter_update_entry_time,
+            counter_erase_entry_time,
+            num_counters
+        };
+
+        std::int64_t get_counter(counter c, bool reset);
+
+        std::size_t get_shard_index(naming::gid_type const& gid) const;
+        std::size_t get_shard_capacity() const;
+
+        bool find(shard& s, naming::gid_type const& gid, entry& e);
+        bool insert_or_update(shard& s, entry const& e);
+        void evict(shard& s, std::size_t& pos);
+        static void resize(shard& s, std::size_t capacity);
+
+        static constexpr std::size_t num_shards = 16;
+
+        std::unique_ptr<shard[]> shards_;
+        std::atomic<std::size_t> max_size_;
+    };
+}}}
+
+#include <hpx/config/warnings_suffix.hpp>
@@ -316,6 +316,8 @@ HPX_EXPORT std::pair<bool, components::pinned_ptr>
 
 HPX_EXPORT void unmark_as_migrated(naming::gid_type const& gid);
 
+HPX_EXPORT bool has_migrated_objects();
+
 HPX_EXPORT hpx::future<std::map<std::string, hpx::id_type> >
     find_symbols(std::string const& pattern = "*");
 HPX_EXPORT std::map<std::string, hpx::id_type> find_symbols(
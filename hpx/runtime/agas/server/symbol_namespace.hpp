@@ -24,6 +24,7 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -49,10 +50,18 @@ struct HPX_EXPORT symbol_namespace
     typedef components::fixed_component_base<symbol_namespace> base_type;
     typedef std::map<std::string, naming::gid_type> iterate_names_return_type;
 
-    typedef std::map<std::string, std::shared_ptr<naming::gid_type> >
+    typedef std::unordered_map<std::string,
+            std::shared_ptr<naming::gid_type> >
         gid_table_type;
 
     typedef std::multimap<std::string, hpx::id_type> on_event_data_map_type;
+
+    // localities which hold a binding in their name cache
+    typedef std::unordered_map<std::string, std::vector<std::uint32_t> >
+        cached_by_table_type;
+
+    typedef std::unordered_map<std::string, naming::id_type>
+        name_cache_type;
     // }}}
 
   private:
@@ -60,6 +69,14 @@ struct HPX_EXPORT symbol_namespace
     gid_table_type gids_;
     std::string instance_name_;
     on_event_data_map_type on_event_data_;
+    cached_by_table_type cached_by_;
+
+    // The cache of names resolved on behalf of this locality by other
+    // symbol namespace instances. Entries are removed by the instance
+    // holding the binding (see invalidate) before the name is unbound.
+    mutable mutex_type cache_mutex_;
+    name_cache_type name_cache_;
+    std::uint64_t cache_generation_ = 0;
 
     // data structure holding all counters for the omponent_namespace component
     struct counter_data
@@ -156,6 +173,29 @@ struct HPX_EXPORT symbol_namespace
 
     naming::gid_type unbind(std::string const& key);
 
+    // Bind the given names to the given gids, returns the result for each
+    // of the names
+    std::vector<bool> bind_names(
+        std::vector<std::string> const& keys
+      , std::vector<naming::gid_type> const& gids
+        );
+
+    // Resolve the given names, the locality with the given id (if valid)
+    // will cache the results and is notified before a name is unbound
+    std::vector<naming::gid_type> resolve_names(
+        std::vector<std::string> const& keys
+      , std::uint32_t cache_locality_id
+        );
+
+    // Remove the given names from the name cache of this locality
+    void invalidate(std::vector<std::string> const& keys);
+
+    // Access the name cache of this locality
+    bool get_cached_name(std::string const& key, naming::id_type& id) const;
+    std::uint64_t get_cache_generation() const;
+    void cache_names(std::vector<std::string> const& keys,
+        std::vector<naming::id_type> const& ids, std::uint64_t generation);
+
     iterate_names_return_type iterate(std::string const& pattern);
 
     bool on_event(
@@ -172,6 +212,15 @@ struct HPX_EXPORT symbol_namespace
     HPX_DEFINE_COMPONENT_ACTION(symbol_namespace, iterate);
     HPX_DEFINE_COMPONENT_ACTION(symbol_namespace, on_event);
     HPX_DEFINE_COMPONENT_ACTION(symbol_namespace, statistics_counter);
+    HPX_DEFINE_COMPONENT_ACTION(symbol_namespace, bind_names);
+    HPX_DEFINE_COMPONENT_ACTION(symbol_namespace, resolve_names);
+    HPX_DEFINE_COMPONENT_ACTION(symbol_namespace, invalidate);
+
+  private:
+    // notify all localities caching the given name, expects the lock to be
+    // held on entry
+    void invalidate_cached_name(std::unique_lock<mutex_type>& l,
+        std::string const& key);
 };
 
 }}}
@@ -218,6 +267,27 @@ HPX_REGISTER_ACTION_DECLARATION(
     hpx::agas::server::symbol_namespace::statistics_counter_action,
     symbol_namespace_statistics_counter_action)
 
+HPX_ACTION_USES_MEDIUM_STACK(
+    hpx::agas::server::symbol_namespace::bind_names_action)
+
+HPX_REGISTER_ACTION_DECLARATION(
+    hpx::agas::server::symbol_namespace::bind_names_action,
+    symbol_namespace_bind_names_action)
+
+HPX_ACTION_USES_MEDIUM_STACK(
+    hpx::agas::server::symbol_namespace::resolve_names_action)
+
+HPX_REGISTER_ACTION_DECLARATION(
+    hpx::agas::server::symbol_namespace::resolve_names_action,
+    symbol_namespace_resolve_names_action)
+
+HPX_ACTION_HAS_HIGH_PRIORITY(
+    hpx::agas::server::symbol_namespace::invalidate_action)
+
+HPX_REGISTER_ACTION_DECLARATION(
+    hpx::agas::server::symbol_namespace::invalidate_action,
+    symbol_namespace_invalidate_action)
+
 #include <hpx/config/warnings_suffix.hpp>
 
 
@@ -66,6 +66,14 @@ struct symbol_namespace
     hpx::future<naming::id_type> resolve_async(std::string key) const;
     naming::id_type resolve(std::string key) const;
 
+    // Bind or resolve many names at once, the names are grouped by the
+    // symbol namespace instance responsible for them and each group is
+    // handled by a single request.
+    hpx::future<std::vector<bool>> bind_async(
+        std::vector<std::string> keys, std::vector<naming::gid_type> gids);
+    hpx::future<std::vector<naming::id_type>> resolve_async(
+        std::vector<std::string> keys) const;
+
     hpx::future<naming::id_type> unbind_async(std::string key);
     naming::id_type unbind(std::string key);
 
@@ -79,11 +87,20 @@ struct symbol_namespace
         std::string const& pattern) const;
     iterate_names_return_type iterate(std::string const& pattern) const;
 
+    // Access the cache of names bound on other localities
+    bool get_cached_name(std::string const& key, naming::id_type& id) const;
+    std::uint64_t get_cache_generation() const;
+    void cache_name(std::string const& key, naming::id_type const& id,
+        std::uint64_t generation);
+
     void register_counter_types();
     void register_server_instance(std::uint32_t locality_id);
     void unregister_server_instance(error_code& ec);
 
 private:
+    hpx::future<std::vector<naming::id_type>> resolve_remote_async(
+        naming::id_type dest, std::vector<std::string> keys) const;
+
     std::unique_ptr<server_type> server_;
 };
 
@@ -17,6 +17,7 @@
 #include <hpx/synchronization/spinlock.hpp>
 #include <hpx/traits/action_decorate_function.hpp>
 
+#include <atomic>
 #include <cstdint>
 #include <mutex>
 #include <type_traits>
@@ -34,6 +35,17 @@ namespace hpx { namespace components
         using base_type = BaseComponent;
         using this_component_type = typename base_type::this_component_type;
 
+        // The pin count holds this bit while a migration of the object is
+        // pending or in progress, all pinning operations have to acquire the
+        // lock (and possibly go through AGAS) while it is set. A pin count of
+        // ~0x0u marks the object as migrated.
+        static constexpr std::uint32_t migration_pending = 0x80000000u;
+
+        static constexpr std::uint32_t get_count(std::uint32_t value)
+        {
+            return value == ~0x0u ? value : value & ~migration_pending;
+        }
+
     public:
         template <typename ...Arg>
         migration_support(Arg &&... arg)
@@ -46,7 +58,7 @@ namespace hpx { namespace components
         {
             // prevent base destructor from unregistering the gid if this
             // instance has been migrated
-            if (pin_count_ == ~0x0u)
+            if (pin_count_.load(std::memory_order_relaxed) == ~0x0u)
                 this->gid_ = naming::invalid_gid;
         }
 
@@ -74,6 +86,9 @@ namespace hpx { namespace components
         // Pinning functionality
         void pin()
         {
+            if (try_pin())
+                return;
+
             std::lock_guard<mutex_type> l(mtx_);
             HPX_ASSERT(pin_count_ != ~0x0u);
             if (pin_count_ != ~0x0u)
@@ -81,6 +96,20 @@ namespace hpx { namespace components
         }
         bool unpin()
         {
+            // no need to lock or to go through AGAS if no migration of this
+            // object is pending (unpin will be called for each action run on
+            // this object)
+            std::uint32_t value = pin_count_.load(std::memory_order_acquire);
+            while (!(value & migration_pending))
+            {
+                HPX_ASSERT(value != 0);
+                if (pin_count_.compare_exchange_weak(value, value - 1,
+                        std::memory_order_acq_rel))
+                {
+                    return false;
+                }
+            }
+
             using lock_type = std::unique_lock<mutex_type>;
 
             {
@@ -88,18 +117,18 @@ namespace hpx { namespace components
                 // more than once
                 lock_type l(this->mtx_);
 
-                if (pin_count_ != ~0x0u && pin_count_ > 1)
+                std::uint32_t count = get_count(pin_count_);
+                if (count != ~0x0u && count > 1)
                 {
                     --pin_count_;
                     return false;
                 }
 
                 // no need to go through AGAS either if this object is not
-                // currently being migrated (unpin will be called for each
-                // action run on this object)
+                // currently being migrated
                 if (!was_marked_for_migration_)
                 {
-                    if (pin_count_ != ~0x0u)
+                    if (count != ~0x0u)
                         --pin_count_;
                     return false;
                 }
@@ -115,11 +144,12 @@ namespace hpx { namespace components
                     // avoid locking errors while handling asserts below
                     util::ignore_while_checking<lock_type> il(&l);
 
-                    was_migrated = this->pin_count_ == ~0x0u;
-                    HPX_ASSERT(this->pin_count_ != 0);
-                    if (this->pin_count_ != ~0x0u)
+                    std::uint32_t count = get_count(this->pin_count_);
+                    was_migrated = count == ~0x0u;
+                    HPX_ASSERT(count != 0);
+                    if (count != ~0x0u)
                     {
-                        if (--this->pin_count_ == 0)
+                        if (get_count(--this->pin_count_) == 0)
                         {
                             // trigger pending migration if this was the last
                             // unpin and a migration operation is pending
@@ -146,8 +176,7 @@ namespace hpx { namespace components
 
         std::uint32_t pin_count() const
         {
-            std::lock_guard<mutex_type> l(mtx_);
-            return pin_count_;
+            return get_count(pin_count_.load(std::memory_order_acquire));
         }
         void mark_as_migrated()
         {
@@ -156,7 +185,7 @@ namespace hpx { namespace components
 
             // avoid locking errors while handling asserts below
             util::ignore_while_checking<lock_type> il(&l);
-            HPX_ASSERT(1 == pin_count_);
+            HPX_ASSERT(1 == get_count(pin_count_));
 
             pin_count_ = ~0x0u;
         }
@@ -182,7 +211,13 @@ namespace hpx { namespace components
                             ));
                     }
 
-                    if (1 == pin_count_)
+                    // from now on, all pinning operations have to go
+                    // through the AGAS table of migrated objects
+                    std::uint32_t count = get_count(
+                        pin_count_.fetch_or(migration_pending) |
+                        migration_pending);
+
+                    if (1 == count)
                     {
                         // all is well, migration can be triggered now
                         return std::make_pair(true, make_ready_future());
@@ -227,9 +262,24 @@ namespace hpx { namespace components
         was_object_migrated(hpx::naming::gid_type const& id,
             naming::address_type lva)
         {
+            // no need to consult AGAS if no object on this locality is
+            // being (or was) migrated, a migration of the object can't
+            // start while it is pinned
+            if (!agas::has_migrated_objects() &&
+                get_lva<this_component_type>::call(lva)->try_pin())
+            {
+                return std::make_pair(false,
+                    components::pinned_ptr::create_pinned<
+                        this_component_type>(lva));
+            }
+
             return agas::was_object_migrated(id,
                 [lva]() -> components::pinned_ptr
                 {
+                    // the object is not in the AGAS table of migrated
+                    // objects (which is locked), no migration is pending
+                    get_lva<this_component_type>::call(lva)
+                        ->clear_migration_pending();
                     return components::pinned_ptr::create<this_component_type>(lva);
                 });
         }
@@ -245,8 +295,34 @@ namespace hpx { namespace components
         }
 
     private:
+        // Pin the object if no migration is pending, this doesn't need to
+        // acquire any lock
+        bool try_pin()
+        {
+            std::uint32_t value = pin_count_.load(std::memory_order_acquire);
+            while (!(value & migration_pending))
+            {
+                if (pin_count_.compare_exchange_weak(value, value + 1,
+                        std::memory_order_acq_rel))
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        // Re-enable the lock-free pinning after a migration was cancelled,
+        // has to be called while the AGAS table of migrated objects is locked
+        void clear_migration_pending()
+        {
+            std::lock_guard<mutex_type> l(mtx_);
+            std::uint32_t value = pin_count_.load(std::memory_order_relaxed);
+            if (value != ~0x0u && !was_marked_for_migration_)
+                pin_count_.fetch_and(~migration_pending);
+        }
+
         mutable mutex_type mtx_;
-        std::uint32_t pin_count_;
+        std::atomic<std::uint32_t> pin_count_;
         hpx::lcos::local::promise<void> trigger_migration_;
         bool was_marked_for_migration_;
     };
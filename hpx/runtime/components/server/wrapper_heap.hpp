@@ -17,6 +17,7 @@
 #include <hpx/util/generate_unique_ids.hpp>
 #include <hpx/util/wrapper_heap_base.hpp>
 
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <memory>
@@ -121,7 +122,10 @@ namespace hpx { namespace components { namespace detail
         char* pool_;
         char* first_free_;
         heap_parameters const parameters_;
-        std::size_t free_size_;
+
+        // the number of free elements may be increased without holding the
+        // lock
+        std::atomic<std::size_t> free_size_;
 
         // these values are used for AGAS registration of all elements of this
         // managed_component heap
@@ -133,7 +137,7 @@ namespace hpx { namespace components { namespace detail
         std::string const class_name_;
 #if defined(HPX_DEBUG)
         std::size_t alloc_count_;
-        std::size_t free_count_;
+        std::atomic<std::size_t> free_count_;
         std::size_t heap_count_;
 #endif
 
@@ -20,10 +20,13 @@
 #include <hpx/naming_base/id_type.hpp>
 #include <hpx/runtime/naming/resolver_client.hpp>
 #include <hpx/runtime/parcelset/detail/data_point.hpp>
+#include <hpx/runtime/parcelset/detail/latency_histogram.hpp>
 #include <hpx/runtime/parcelset/detail/parcel_route_handler.hpp>
 #include <hpx/runtime/parcelset/parcel.hpp>
 #include <hpx/runtime_fwd.hpp>
 #include <hpx/serialization/serialize.hpp>
+#include <hpx/serialization/serialize_buffer.hpp>
+#include <hpx/timing/high_resolution_clock.hpp>
 #include <hpx/timing/high_resolution_timer.hpp>
 
 #if BOOST_ASIO_HAS_BOOST_THROW_EXCEPTION != 0
@@ -35,6 +38,7 @@
 #include <cstdint>
 #include <exception>
 #include <functional>
+#include <memory>
 #include <sstream>
 #include <utility>
 #include <vector>
@@ -109,6 +113,74 @@ namespace hpx { namespace parcelset
         return chunks;
     }
 
+    namespace detail
+    {
+        // The received zero-copy chunks can be handed over to the
+        // de-serialized objects only if the parcelport stores them in
+        // buffers with shared ownership.
+        template <typename Chunk>
+        std::shared_ptr<void> chunk_owner(Chunk&)
+        {
+            return std::shared_ptr<void>();
+        }
+
+        template <typename T>
+        std::shared_ptr<void> chunk_owner(
+            serialization::serialize_buffer<T>& chunk)
+        {
+            return std::shared_ptr<void>(chunk.data(), [chunk](void*) {});
+        }
+    }
+
+    // Return the owners of the memory of the zero-copy chunks, placed at
+    // the same spots as the chunks returned by decode_chunks.
+    template <typename Buffer>
+    std::vector<std::shared_ptr<void>> decode_chunk_owners(Buffer & buffer)
+    {
+        std::vector<std::shared_ptr<void>> owners;
+
+        std::size_t num_zero_copy_chunks =
+            static_cast<std::size_t>(
+                static_cast<std::uint32_t>(buffer.num_chunks_.first));
+
+        if (num_zero_copy_chunks != 0)
+        {
+            std::size_t num_non_zero_copy_chunks =
+                static_cast<std::size_t>(
+                    static_cast<std::uint32_t>(buffer.num_chunks_.second));
+
+            owners.resize(num_zero_copy_chunks + num_non_zero_copy_chunks);
+
+            for (std::size_t i = 0; i != num_zero_copy_chunks; ++i)
+            {
+                std::size_t first = static_cast<std::size_t>(
+                    static_cast<std::uint64_t>(
+                        buffer.transmission_chunks_[i].first));
+
+                owners[first] = detail::chunk_owner(buffer.chunks_[i]);
+            }
+        }
+
+        return owners;
+    }
+
+    namespace detail
+    {
+        template <typename Parcelport>
+        void schedule_parcel(
+            Parcelport& pp, parcel& p, std::size_t num_thread)
+        {
+            // account for the time the parcel waited for being scheduled
+            if (pp.collect_latency_data())
+            {
+                pp.add_latency_data(latency_stage::schedule,
+                    p.source_locality_id(), p,
+                    hpx::chrono::high_resolution_clock::now());
+            }
+            p.schedule_action(num_thread);
+        }
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     template <typename Parcelport, typename Buffer>
     void decode_message_with_chunks(
@@ -117,11 +189,17 @@ namespace hpx { namespace parcelset
       , std::size_t parcel_count
       , std::vector<serialization::serialization_chunk> &chunks
       , std::size_t num_thread = -1
+      , std::vector<std::shared_ptr<void>> const* chunk_owners = nullptr
     )
     {
         std::size_t inbound_data_size = static_cast<std::size_t>(
             static_cast<std::uint64_t>(buffer.data_size_));
 
+        // the time spent decoding the parcels is measured from here
+        bool const collect_latency_data = pp.collect_latency_data();
+        std::int64_t const decode_start_time = collect_latency_data ?
+            hpx::chrono::high_resolution_clock::now() : 0;
+
         // protect from un-handled exceptions bubbling up
         try {
             try {
@@ -135,7 +213,7 @@ namespace hpx { namespace parcelset
                     std::vector<parcel> deferred_parcels;
                     // De-serialize the parcel data
                     serialization::input_archive archive(buffer.data_,
-                        inbound_data_size, &chunks);
+                        inbound_data_size, &chunks, chunk_owners);
 
                     if(parcel_count == 0)
                     {
@@ -164,6 +242,15 @@ namespace hpx { namespace parcelset
 
                         std::int64_t add_parcel_time = timer.elapsed_nanoseconds();
 
+                        if (collect_latency_data)
+                        {
+                            p.stage_time() = decode_start_time;
+                            pp.add_latency_data(
+                                detail::latency_stage::deserialization,
+                                p.source_locality_id(), p,
+                                hpx::chrono::high_resolution_clock::now());
+                        }
+
 #if defined(HPX_HAVE_PARCELPORT_ACTION_COUNTERS)
                         performance_counters::parcels::data_point action_data;
                         action_data.bytes_ = archive.current_pos() - archive_pos;
@@ -220,8 +307,9 @@ namespace hpx { namespace parcelset
                             hpx::threads::thread_init_data data(
                                 hpx::threads::make_thread_function_nullary(
                                     util::deferred_call(
-                                        [num_thread](parcel&& p) {
-                                            p.schedule_action(num_thread);
+                                        [&pp, num_thread](parcel&& p) {
+                                            detail::schedule_parcel(
+                                                pp, p, num_thread);
                                         },
                                         std::move(deferred_parcels[i]))),
                                 "schedule_parcel",
@@ -234,7 +322,8 @@ namespace hpx { namespace parcelset
                         }
                         // If we are the first deferred parcel, we don't need to spin
                         // a new thread...
-                        deferred_parcels[0].schedule_action(num_thread);
+                        detail::schedule_parcel(
+                            pp, deferred_parcels[0], num_thread);
                     }
                 }
 
@@ -276,6 +365,9 @@ namespace hpx { namespace parcelset
                 << "decode_message: caught unknown exception.";
             hpx::report_error(std::current_exception());
         }
+
+        // all parcels have been decoded, the message buffer can be reused
+        pp.get_buffer_pool().release(buffer.data_);
     }
 
     ///////////////////////////////////////////////////////////////////////////
@@ -289,8 +381,10 @@ namespace hpx { namespace parcelset
     {
         std::vector<serialization::serialization_chunk>
             chunks(decode_chunks(buffer));
+        std::vector<std::shared_ptr<void>>
+            chunk_owners(decode_chunk_owners(buffer));
         decode_message_with_chunks(pp, std::move(buffer),
-            parcel_count, chunks, num_thread);
+            parcel_count, chunks, num_thread, &chunk_owners);
     }
 
     template <typename Parcelport, typename Buffer>
@@ -11,9 +11,12 @@
 
 #if defined(HPX_HAVE_NETWORKING)
 #include <hpx/assert.hpp>
+#include <hpx/runtime/parcelset/detail/latency_histogram.hpp>
 #include <hpx/runtime/parcelset/parcelport.hpp>
+#include <hpx/timing/high_resolution_clock.hpp>
 
 #include <cstddef>
+#include <cstdint>
 #include <system_error>
 #include <utility>
 #include <vector>
@@ -30,21 +33,26 @@ namespace hpx { namespace parcelset
             typedef std::vector<parcel> parcels_type;
             handlers_type handlers_;
             parcels_type parcels_;
+            parcelport* pp_;
 
-            call_for_each(handlers_type&& handlers, parcels_type&& parcels)
+            call_for_each(handlers_type&& handlers, parcels_type&& parcels,
+                    parcelport* pp = nullptr)
               : handlers_(std::move(handlers))
               , parcels_(std::move(parcels))
+              , pp_(pp)
             {}
 
             call_for_each(call_for_each&& other)
               : handlers_(std::move(other.handlers_))
               , parcels_(std::move(other.parcels_))
+              , pp_(other.pp_)
             {}
 
             call_for_each& operator=(call_for_each&& other)
             {
                 handlers_ = std::move(other.handlers_);
                 parcels_ = std::move(other.parcels_);
+                pp_ = other.pp_;
 
                 return *this;
             }
@@ -52,6 +60,17 @@ namespace hpx { namespace parcelset
             void operator()(std::error_code const& e)
             {
                 HPX_ASSERT(parcels_.size() == handlers_.size());
+                if (pp_ != nullptr && !e && pp_->collect_latency_data())
+                {
+                    // the parcels have been sent
+                    std::int64_t now =
+                        hpx::chrono::high_resolution_clock::now();
+                    for (parcel& p : parcels_)
+                    {
+                        pp_->add_latency_data(detail::latency_stage::send,
+                            p.destination_locality_id(), p, now);
+                    }
+                }
                 for(std::size_t i = 0; i < parcels_.size(); ++i)
                 {
                     handlers_[i](e, parcels_[i]);
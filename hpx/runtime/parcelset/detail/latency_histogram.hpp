@@ -0,0 +1,134 @@
+//  Copyright (c) 2020 STE||AR Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING)
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx { namespace parcelset { namespace detail
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // The processing stages of a parcel the latencies are collected for
+    enum class latency_stage
+    {
+        queue = 0,          // from put_parcel until serialization starts
+        serialization,      // serialization of the message
+        send,               // from serialization until the write completed
+        deserialization,    // from the start of decoding until decoded
+        schedule,           // from decoding until the action was scheduled
+        num_stages
+    };
+
+    // Return the name of the given stage as used in the counter names
+    HPX_EXPORT char const* get_latency_stage_name(latency_stage stage);
+
+    ///////////////////////////////////////////////////////////////////////////
+    // A histogram of latencies (nanoseconds) using buckets of exponentially
+    // growing width (four buckets per power of two), which keeps the
+    // relative error of each sample below 25% over the full range of
+    // values. Samples are added without locking.
+    class HPX_EXPORT latency_histogram
+    {
+    public:
+        latency_histogram();
+
+        void add(std::int64_t value);
+
+        // Return the collected data distributed over num_buckets linear
+        // buckets between min_boundary and max_boundary (plus one bucket
+        // each for the values below and above that range). The result
+        // holds the three parameters followed by the value for each bucket
+        // in units of 0.1% of all samples.
+        std::vector<std::int64_t> get(std::int64_t min_boundary,
+            std::int64_t max_boundary, std::int64_t num_buckets, bool reset);
+
+    private:
+        static constexpr std::size_t max_exponent = 40;
+        static constexpr std::size_t bucket_count = 4 * (max_exponent - 1);
+
+        static std::size_t get_bucket(std::int64_t value);
+        static std::int64_t get_bucket_midpoint(std::size_t bucket);
+
+        std::array<std::atomic<std::int64_t>, bucket_count> counts_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The latency histograms for all stages, collected overall, for each
+    // remote locality, and (if enabled) for each action. The histograms of
+    // a locality or an action are created on first use and are never
+    // removed, all samples are added without locking.
+    class HPX_EXPORT latency_histograms
+    {
+        typedef std::array<latency_histogram,
+            static_cast<std::size_t>(latency_stage::num_stages)>
+            stage_histograms;
+
+        // Maps small integral keys (locality and action ids) to their
+        // histograms. The entries are stored in blocks which are allocated
+        // on demand, keys beyond the capacity of the table are ignored.
+        class histogram_table
+        {
+        public:
+            histogram_table();
+            ~histogram_table();
+
+            histogram_table(histogram_table const&) = delete;
+            histogram_table& operator=(histogram_table const&) = delete;
+
+            // Return the histograms for the given key, those are created if
+            // needed. Returns nullptr if the key is out of range.
+            stage_histograms* get(std::uint32_t key);
+
+        private:
+            static constexpr std::size_t block_size = 256;
+            static constexpr std::size_t num_blocks = 256;
+
+            typedef std::atomic<stage_histograms*> entry_type;
+
+            std::array<std::atomic<entry_type*>, num_blocks> blocks_;
+        };
+
+    public:
+        latency_histograms();
+        ~latency_histograms();
+
+        latency_histograms(latency_histograms const&) = delete;
+        latency_histograms& operator=(latency_histograms const&) = delete;
+
+        // add the latency measured for a parcel exchanged with the given
+        // locality, the action id is ignored if per-action counters are not
+        // enabled
+        void add(latency_stage stage, std::uint32_t locality_id,
+            std::uint32_t action_id, std::int64_t value);
+
+        // The filter is either empty (all parcels), a locality
+        // ('locality#<id>'), or the name of an action.
+        std::vector<std::int64_t> get(latency_stage stage,
+            std::string const& filter, std::int64_t min_boundary,
+            std::int64_t max_boundary, std::int64_t num_buckets, bool reset);
+
+    private:
+        stage_histograms overall_;
+        histogram_table per_locality_;
+#if defined(HPX_HAVE_PARCELPORT_ACTION_COUNTERS)
+        histogram_table per_action_;
+#endif
+    };
+}}}
+
+#include <hpx/config/warnings_suffix.hpp>
+
+#endif
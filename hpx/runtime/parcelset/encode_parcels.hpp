@@ -22,12 +22,14 @@
 #include <hpx/modules/logging.hpp>
 #include <hpx/naming/detail/preprocess_gid_types.hpp>
 #include <hpx/naming/split_gid.hpp>
+#include <hpx/runtime/parcelset/detail/latency_histogram.hpp>
 #include <hpx/runtime/parcelset/parcel.hpp>
 #include <hpx/runtime/parcelset/parcel_buffer.hpp>
 #include <hpx/runtime/parcelset/parcelport.hpp>
 #include <hpx/runtime/parcelset_fwd.hpp>
 #include <hpx/runtime_fwd.hpp>
 #include <hpx/serialization/serialize.hpp>
+#include <hpx/timing/high_resolution_clock.hpp>
 #include <hpx/timing/high_resolution_timer.hpp>
 #if defined(HPX_HAVE_PARCELPORT_ACTION_COUNTERS)
 #include <hpx/actions/base_action.hpp>
@@ -141,7 +143,7 @@ namespace hpx
         template <typename Buffer>
         std::size_t
         encode_parcels(parcelport& pp,
-            parcel const * ps, std::size_t num_parcels, Buffer & buffer,
+            parcel * ps, std::size_t num_parcels, Buffer & buffer,
             int archive_flags_, std::uint64_t max_outbound_size)
         {
             HPX_ASSERT(buffer.data_.empty());
@@ -177,10 +179,24 @@ namespace hpx
                         num_chunks += ps[parcels_sent].num_chunks();
                     }
 
-                    buffer.data_.reserve(arg_size);
+                    pp.get_buffer_pool().acquire(buffer.data_, arg_size);
 
                     buffer.chunks_.reserve(num_chunks);
 
+                    // the parcels have left the queue of pending parcels
+                    bool const collect_latency_data =
+                        pp.collect_latency_data();
+                    if (collect_latency_data)
+                    {
+                        std::int64_t now =
+                            hpx::chrono::high_resolution_clock::now();
+                        for (std::size_t i = 0; i != parcels_sent; ++i)
+                        {
+                            pp.add_latency_data(detail::latency_stage::queue,
+                                ps[i].destination_locality_id(), ps[i], now);
+                        }
+                    }
+
                     // mark start of serialization
                     hpx::chrono::high_resolution_timer timer;
 
@@ -226,8 +242,6 @@ namespace hpx
                             pp.add_sent_data(
                                 ps[i].get_action()->get_action_name(),
                                 action_data);
-#else
-                            HPX_UNUSED(pp);
 #endif
                         }
                         archive.flush();
@@ -237,6 +251,18 @@ namespace hpx
                     // store the time required for serialization
                     buffer.data_point_.serialization_time_ =
                         timer.elapsed_nanoseconds();
+
+                    if (collect_latency_data)
+                    {
+                        std::int64_t now =
+                            hpx::chrono::high_resolution_clock::now();
+                        for (std::size_t i = 0; i != parcels_sent; ++i)
+                        {
+                            pp.add_latency_data(
+                                detail::latency_stage::serialization,
+                                ps[i].destination_locality_id(), ps[i], now);
+                        }
+                    }
                 }
                 catch (hpx::exception const& e) {
                     LPT_(fatal)
@@ -122,6 +122,8 @@ namespace hpx { namespace parcelset
 
         naming::gid_type const& destination_locality() const;
 
+        std::uint32_t source_locality_id() const;
+
         double start_time() const;
 
         void set_start_time(double time);
@@ -130,6 +132,10 @@ namespace hpx { namespace parcelset
 
         threads::thread_priority get_thread_priority() const;
 
+        // Parcels for high priority actions are sent through a separate lane
+        // of the parcelports, bypassing any pending (bulk) parcels
+        bool is_high_priority() const;
+
 #if defined(HPX_HAVE_PARCEL_PROFILING)
         naming::gid_type const parcel_id() const;
 
@@ -155,6 +161,13 @@ namespace hpx { namespace parcelset
 
         std::size_t & size();
 
+        // The time stamp (nanoseconds) of the most recently completed
+        // processing stage of this parcel, this is used for collecting the
+        // parcel latency histograms only and is not serialized
+        std::int64_t const& stage_time() const;
+
+        std::int64_t & stage_time();
+
         void schedule_action(std::size_t num_thread = std::size_t(-1));
 
         // returns true if parcel was migrated, false if scheduled locally
@@ -182,6 +195,7 @@ namespace hpx { namespace parcelset
         mutable split_gids_type split_gids_;
         std::size_t size_;
         std::size_t num_chunks_;
+        std::int64_t stage_time_;
     };
 
     HPX_EXPORT std::string dump_parcel(parcel const& p);
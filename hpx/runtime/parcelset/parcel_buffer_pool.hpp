@@ -0,0 +1,83 @@
+//  Copyright (c) 2020 STE||AR Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING)
+#include <hpx/synchronization/spinlock.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx { namespace parcelset
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // A pool of the buffers used for sending and receiving messages. The
+    // buffers are sorted into size classes (powers of two), separately for
+    // each NUMA domain. Buffers handed back to the pool are kept as long as
+    // the overall amount of cached memory stays below the configured high
+    // watermark. Only buffers of type std::vector<char> are pooled, all
+    // other buffer types are managed by their own allocators.
+    class HPX_EXPORT parcel_buffer_pool
+    {
+    public:
+        // max_size is the high watermark (in bytes), zero disables pooling
+        explicit parcel_buffer_pool(std::size_t max_size = 0);
+        ~parcel_buffer_pool();
+
+        parcel_buffer_pool(parcel_buffer_pool const&) = delete;
+        parcel_buffer_pool& operator=(parcel_buffer_pool const&) = delete;
+
+        // Make sure the given (empty) buffer can hold at least size bytes
+        void acquire(std::vector<char>& buffer, std::size_t size);
+
+        template <typename Buffer>
+        void acquire(Buffer& buffer, std::size_t size)
+        {
+            buffer.reserve(size);
+        }
+
+        // Take the memory of the given buffer, the buffer is empty afterwards
+        void release(std::vector<char>& buffer);
+
+        // Buffers of other types manage their memory themselves
+        template <typename Buffer>
+        void release(Buffer&)
+        {
+        }
+
+        // Free cached buffers until at most half of the high watermark is
+        // held by the pool
+        void trim();
+
+        // Return the amount of memory currently held by the pool (bytes)
+        std::size_t cached_size() const
+        {
+            return cached_size_.load(std::memory_order_relaxed);
+        }
+
+    private:
+        struct domain;
+
+        std::size_t current_domain() const;
+
+        std::size_t const max_size_;
+        std::size_t num_domains_;
+        std::vector<std::size_t> pu_domains_;
+        std::unique_ptr<domain[]> domains_;
+        std::atomic<std::size_t> cached_size_;
+    };
+}}
+
+#include <hpx/config/warnings_suffix.hpp>
+
+#endif
@@ -342,6 +342,22 @@ namespace hpx { namespace parcelset
         std::int64_t get_buffer_allocate_time_received(
             std::string const& pp_type, bool reset) const;
 
+        // amount of data pending for any of the destinations (bytes)
+        std::int64_t get_pending_outbound_size(
+            std::string const& pp_type, bool reset) const;
+
+        // time threads were suspended because of too much pending data
+        // (nanoseconds)
+        std::int64_t get_outbound_stall_time(
+            std::string const& pp_type, bool reset) const;
+
+        // histogram of the time parcels spent in the given processing stage
+        std::vector<std::int64_t> get_latency_histogram(
+            std::string const& pp_type, detail::latency_stage stage,
+            std::string const& filter, std::int64_t min_boundary,
+            std::int64_t max_boundary, std::int64_t num_buckets,
+            bool reset) const;
+
 #if defined(HPX_HAVE_PARCELPORT_ACTION_COUNTERS)
         // same as above, just separated data for each action
         // number of parcels sent
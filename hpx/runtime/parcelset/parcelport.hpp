@@ -14,15 +14,19 @@
 
 #if defined(HPX_HAVE_NETWORKING)
 #include <hpx/async_distributed/applier_fwd.hpp>
+#include <hpx/concurrency/concurrentqueue.hpp>
 #include <hpx/datastructures/tuple.hpp>
 #include <hpx/functional/function.hpp>
 #include <hpx/modules/io_service.hpp>
 #include <hpx/modules/runtime_configuration.hpp>
 #include <hpx/runtime/parcelset/detail/data_point.hpp>
 #include <hpx/runtime/parcelset/detail/gatherer.hpp>
+#include <hpx/runtime/parcelset/detail/latency_histogram.hpp>
 #include <hpx/runtime/parcelset/detail/per_action_data_counter.hpp>
 #include <hpx/runtime/parcelset/locality.hpp>
 #include <hpx/runtime/parcelset/parcel.hpp>
+#include <hpx/runtime/parcelset/parcel_buffer_pool.hpp>
+#include <hpx/synchronization/condition_variable.hpp>
 #include <hpx/synchronization/spinlock.hpp>
 
 #include <atomic>
@@ -33,7 +37,6 @@
 #include <map>
 #include <memory>
 #include <mutex>
-#include <set>
 #include <string>
 #include <system_error>
 #include <vector>
@@ -248,6 +251,20 @@ namespace hpx { namespace parcelset
 
         std::int64_t get_pending_parcels_count(bool /*reset*/);
 
+        /// the amount of parcel data queued or in flight to any of the
+        /// destinations (bytes)
+        std::int64_t get_pending_outbound_size(bool /*reset*/);
+
+        /// the total time threads were suspended because a destination had
+        /// too much parcel data pending (nanoseconds)
+        std::int64_t get_outbound_stall_time(bool reset);
+
+        // histogram of the time parcels spent in the given processing stage
+        std::vector<std::int64_t> get_latency_histogram(
+            detail::latency_stage stage, std::string const& filter,
+            std::int64_t min_boundary, std::int64_t max_boundary,
+            std::int64_t num_buckets, bool reset);
+
 #if defined(HPX_HAVE_PARCELPORT_ACTION_COUNTERS)
         // same as above, just separated data for each action
         // number of parcels sent
@@ -298,6 +315,23 @@ namespace hpx { namespace parcelset
             performance_counters::parcels::data_point const& data);
 #endif
 
+        /// Return whether the latencies of the processing stages of the
+        /// parcels are collected (hpx.parcel.<type>.latency_histograms)
+        bool collect_latency_data() const
+        {
+            return collect_latency_data_;
+        }
+
+        /// Add the time the given parcel spent in the given processing stage
+        /// (i.e. the time elapsed since it completed its previous stage) to
+        /// the latency histograms
+        void add_latency_data(detail::latency_stage stage,
+            std::uint32_t locality_id, parcel& p, std::int64_t timestamp)
+        {
+            if (collect_latency_data_)
+                add_latency_data_impl(stage, locality_id, p, timestamp);
+        }
+
         /// Return the configured maximal allowed message data size
         std::int64_t get_max_inbound_message_size() const
         {
@@ -309,6 +343,12 @@ namespace hpx { namespace parcelset
             return max_outbound_message_size_;
         }
 
+        /// Return the pool of message buffers used by this parcelport
+        parcel_buffer_pool& get_buffer_pool()
+        {
+            return buffer_pool_;
+        }
+
         /// Return whether it is allowed to apply array optimizations
         bool allow_array_optimizations() const
         {
@@ -330,23 +370,103 @@ namespace hpx { namespace parcelset
         void early_pending_parcel_handler(std::error_code const& ec,
             parcel const & p);
 
+    private:
+        void add_latency_data_impl(detail::latency_stage stage,
+            std::uint32_t locality_id, parcel& p, std::int64_t timestamp);
+
     protected:
         /// mutex for all of the member data
         mutable lcos::local::spinlock mtx_;
 
         hpx::applier::applier *applier_;
 
-        /// The cache for pending parcels
-        typedef hpx::tuple<
-            std::vector<parcel>
-          , std::vector<write_handler_type>
-        > map_second_type;
-        typedef std::map<locality, map_second_type> pending_parcels_map;
-        pending_parcels_map pending_parcels_;
+        /// The parcels pending for a single destination. Parcels are added
+        /// to and taken from the queues without locking, the sender_active_
+        /// flag makes sure only one thread at a time drains the queues.
+        struct pending_parcels_queue
+        {
+            typedef hpx::tuple<parcel, write_handler_type> entry_type;
+            typedef hpx::concurrency::ConcurrentQueue<entry_type> lane_type;
+
+            lane_type parcels_;
+
+            /// High priority parcels are queued separately and are always
+            /// sent before any of the other pending parcels
+            lane_type high_priority_parcels_;
+
+            std::atomic<std::int64_t> count_{0};
+            std::atomic<bool> sender_active_{false};
+
+            /// The amount of data pending for this destination and the
+            /// number of threads waiting for it to go down (flow control)
+            std::atomic<std::int64_t> outbound_size_{0};
+            std::atomic<std::size_t> credits_waiters_{0};
+        };
+
+        /// Return the queue for the given destination, the queue is created
+        /// on first use and stays valid as long as the parcelport exists
+        pending_parcels_queue& get_pending_parcels_queue(
+            locality const& dest);
+
+        /// Return the queue for the given destination, if any
+        pending_parcels_queue* find_pending_parcels_queue(
+            locality const& dest) const;
+
+        /// Return the queue used for the flow control of the given
+        /// destination, nullptr if flow control is disabled
+        pending_parcels_queue* get_outbound_credits_queue(
+            locality const& dest)
+        {
+            return max_pending_outbound_size_ > 0 ?
+                &get_pending_parcels_queue(dest) :
+                nullptr;
+        }
+
+        /// Flow control: if the destination of the given parcel has too
+        /// much data pending already, suspend the calling HPX thread until
+        /// enough of it has been transferred (high priority parcels are
+        /// never held back).
+        void wait_for_outbound_credits(
+            pending_parcels_queue* q, parcel const& p);
+
+        /// Account for the given parcel being sent to its destination. The
+        /// returned write handler gives the credits back after the parcel
+        /// was sent.
+        write_handler_type acquire_outbound_credits(pending_parcels_queue* q,
+            parcel const& p, write_handler_type&& f);
+
+        void release_outbound_credits(
+            pending_parcels_queue& q, std::int64_t size);
+
+        bool has_outbound_credits(pending_parcels_queue const& q) const
+        {
+            // a single parcel is always let through, even if it is larger
+            // than the overall budget
+            std::int64_t const size = q.outbound_size_.load();
+            return size == 0 || size <= max_pending_outbound_size_;
+        }
+
+        /// Collect all destinations with pending parcels
+        void get_pending_parcels_destinations(
+            std::vector<locality>& destinations) const;
+
+        typedef std::map<locality, std::shared_ptr<pending_parcels_queue>>
+            pending_parcels_map;
+
+        /// Return the current set of destinations
+        std::shared_ptr<pending_parcels_map const>
+        get_pending_parcels_map() const
+        {
+            return std::atomic_load(&parcel_destinations_);
+        }
 
-        typedef std::set<locality> pending_parcels_destinations;
-        pending_parcels_destinations parcel_destinations_;
-        std::atomic<std::uint32_t> num_parcel_destinations_;
+        /// The cache for pending parcels, queues are registered once for
+        /// each destination and are never removed. The map is replaced by
+        /// an updated copy whenever a destination is added, readers don't
+        /// need to acquire any lock, the mutex serializes the writers.
+        lcos::local::spinlock destinations_mtx_;
+        std::shared_ptr<pending_parcels_map const> parcel_destinations_;
+        std::atomic<std::int64_t> num_pending_parcels_;
 
         /// The local locality
         locality here_;
@@ -355,6 +475,24 @@ namespace hpx { namespace parcelset
         std::int64_t const max_inbound_message_size_;
         std::int64_t const max_outbound_message_size_;
 
+        /// The maximal amount of data pending for a single destination
+        std::int64_t const max_pending_outbound_size_;
+
+        /// Threads waiting for credits are suspended on the condition
+        /// variable, the per-destination counters are kept in the
+        /// pending_parcels_queue instances
+        lcos::local::spinlock credits_mtx_;
+        lcos::local::condition_variable_any credits_cond_;
+        std::atomic<std::int64_t> total_pending_outbound_size_;
+        std::atomic<std::int64_t> outbound_stall_time_;
+
+        /// The cached message buffers
+        parcel_buffer_pool buffer_pool_;
+
+        /// The latencies of the processing stages of the parcels
+        bool const collect_latency_data_;
+        detail::latency_histograms latency_histograms_;
+
         /// Overall parcel statistics
         performance_counters::parcels::gatherer parcels_sent_;
         performance_counters::parcels::gatherer parcels_received_;
@@ -24,6 +24,7 @@
 #include <hpx/runtime/parcelset/parcelport.hpp>
 #include <hpx/modules/threading.hpp>
 #include <hpx/thread_support/atomic_count.hpp>
+#include <hpx/timing/high_resolution_clock.hpp>
 #include <hpx/util/connection_cache.hpp>
 #include <hpx/util/from_string.hpp>
 #include <hpx/util/get_entry_as.hpp>
@@ -38,6 +39,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <exception>
+#include <iterator>
 #include <limits>
 #include <memory>
 #include <mutex>
@@ -212,13 +214,27 @@ namespace hpx { namespace parcelset
         {
             HPX_ASSERT(dest.type() == type());
 
+            // apply back-pressure if too much data is pending for the
+            // destination already
+            pending_parcels_queue* q = get_outbound_credits_queue(dest);
+            wait_for_outbound_credits(q, p);
+
             // We create a shared pointer of the parcels_await object since it
             // needs to be kept alive as long as there are futures not ready
             // or GIDs to be split. This is necessary to preserve the identity
             // of the this pointer.
             detail::parcel_await_apply(std::move(p), std::move(f),
-                archive_flags_, [this, dest](parcel&& p, write_handler_type&& f)
+                archive_flags_,
+                [this, dest, q](parcel&& p, write_handler_type&& f)
                 {
+                    if (collect_latency_data())
+                    {
+                        p.stage_time() =
+                            hpx::chrono::high_resolution_clock::now();
+                    }
+
+                    f = acquire_outbound_credits(q, p, std::move(f));
+
                     if (connection_handler_traits<ConnectionHandler>::
                         send_immediate_parcels::value &&
                         can_send_immediate_impl<ConnectionHandler>())
@@ -255,15 +271,43 @@ namespace hpx { namespace parcelset
                     parcels[i].destination_locality());
             }
 #endif
+            // apply back-pressure if too much data is pending for the
+            // destination already
+            pending_parcels_queue* q = get_outbound_credits_queue(dest);
+            for (parcel const& p : parcels)
+            {
+                if (!p.is_high_priority())
+                {
+                    wait_for_outbound_credits(q, p);
+                    break;
+                }
+            }
+
             // We create a shared pointer of the parcels_await object since it
             // needs to be kept alive as long as there are futures not ready
             // or GIDs to be split. This is necessary to preserve the identity
             // of the this pointer.
             detail::parcels_await_apply(std::move(parcels),
                 std::move(handlers), archive_flags_,
-                [this, dest](std::vector<parcel>&& parcels,
+                [this, dest, q](std::vector<parcel>&& parcels,
                     std::vector<write_handler_type>&& handlers)
                 {
+                    if (collect_latency_data())
+                    {
+                        std::int64_t now =
+                            hpx::chrono::high_resolution_clock::now();
+                        for (parcel& p : parcels)
+                        {
+                            p.stage_time() = now;
+                        }
+                    }
+
+                    for (std::size_t i = 0; i != parcels.size(); ++i)
+                    {
+                        handlers[i] = acquire_outbound_credits(
+                            q, parcels[i], std::move(handlers[i]));
+                    }
+
                     if (connection_handler_traits<ConnectionHandler>::
                         send_immediate_parcels::value &&
                         can_send_immediate_impl<ConnectionHandler>())
@@ -298,7 +342,14 @@ namespace hpx { namespace parcelset
             std::size_t num_thread, parcelport_background_mode mode) override
         {
             trigger_pending_work();
-            return do_background_work_impl<ConnectionHandler>(num_thread, mode);
+            bool did_some_work =
+                do_background_work_impl<ConnectionHandler>(num_thread, mode);
+
+            // give cached message buffers back while there is nothing to do
+            if (!did_some_work)
+                get_buffer_pool().trim();
+
+            return did_some_work;
         }
 
         /// support enable_shared_from_this
@@ -543,7 +594,8 @@ namespace hpx { namespace parcelset
                             std::make_move_iterator(fs + encoded_parcels)),
                         handler_type::parcels_type(
                             std::make_move_iterator(ps),
-                            std::make_move_iterator(ps + encoded_parcels))
+                            std::make_move_iterator(ps + encoded_parcels)),
+                        &this_
                     ),
                     sender, addr,
                     encoded_buffer))
@@ -578,7 +630,7 @@ namespace hpx { namespace parcelset
     private:
         ///////////////////////////////////////////////////////////////////////
         std::shared_ptr<connection> get_connection(
-            locality const& l, bool /* force */, error_code& ec)
+            locality const& l, bool force, error_code& ec)
         {
             // Request new connection from connection cache.
             std::shared_ptr<connection> sender_connection;
@@ -590,7 +642,8 @@ namespace hpx { namespace parcelset
             }
             else {
                 // Get a connection or reserve space for a new connection.
-                if (!connection_cache_.get_or_reserve(l, sender_connection))
+                if (!connection_cache_.get_or_reserve(
+                        l, sender_connection, force))
                 {
                     // If no slot is available it's not a problem as the parcel
                     // will be sent out whenever the next connection is returned
@@ -615,158 +668,163 @@ namespace hpx { namespace parcelset
         void enqueue_parcel(locality const& locality_id,
             parcel&& p, write_handler_type&& f)
         {
-            using mapped_type = pending_parcels_map::mapped_type;
+            using entry_type = pending_parcels_queue::entry_type;
 
-            std::unique_lock<lcos::local::spinlock> l(mtx_);
-            // We ignore the lock here. It might happen that while enqueuing,
-            // we need to acquire a lock. This should not cause any problems
-            // (famous last words)
-            util::ignore_while_checking<
-                std::unique_lock<lcos::local::spinlock>
-            > il(&l);
+            pending_parcels_queue& q = get_pending_parcels_queue(locality_id);
+            pending_parcels_queue::lane_type& lane = p.is_high_priority() ?
+                q.high_priority_parcels_ : q.parcels_;
 
-            mapped_type& e = pending_parcels_[locality_id];
-            hpx::get<0>(e).push_back(std::move(p));
-            hpx::get<1>(e).push_back(std::move(f));
+            // the counters are updated before the parcel is queued, they may
+            // briefly claim more parcels than are available but never drop
+            // below zero as only queued parcels can be taken
+            ++q.count_;
+            ++num_pending_parcels_;
 
-            parcel_destinations_.insert(locality_id);
-            ++num_parcel_destinations_;
+            lane.enqueue(entry_type(std::move(p), std::move(f)));
         }
 
         void enqueue_parcels(locality const& locality_id,
             std::vector<parcel>&& parcels,
             std::vector<write_handler_type>&& handlers)
         {
-            using mapped_type = pending_parcels_map::mapped_type;
+            HPX_ASSERT(parcels.size() == handlers.size());
 
-            std::unique_lock<lcos::local::spinlock> l(mtx_);
-            // We ignore the lock here. It might happen that while enqueuing,
-            // we need to acquire a lock. This should not cause any problems
-            // (famous last words)
-            util::ignore_while_checking<
-                std::unique_lock<lcos::local::spinlock>
-            > il(&l);
+            pending_parcels_queue& q = get_pending_parcels_queue(locality_id);
 
-            HPX_ASSERT(parcels.size() == handlers.size());
+            std::size_t num_parcels = parcels.size();
+            q.count_ += static_cast<std::int64_t>(num_parcels);
+            num_pending_parcels_ += static_cast<std::int64_t>(num_parcels);
 
-            mapped_type& e = pending_parcels_[locality_id];
-            if (hpx::get<0>(e).empty())
-            {
-                HPX_ASSERT(hpx::get<1>(e).empty());
-                std::swap(hpx::get<0>(e), parcels);
-                std::swap(hpx::get<1>(e), handlers);
-            }
-            else
+            for (std::size_t i = 0; i != num_parcels; ++i)
             {
-                HPX_ASSERT(hpx::get<0>(e).size() == hpx::get<1>(e).size());
-                std::size_t new_size = hpx::get<0>(e).size() + parcels.size();
-                hpx::get<0>(e).reserve(new_size);
-
-                std::move(parcels.begin(), parcels.end(),
-                    std::back_inserter(hpx::get<0>(e)));
-                hpx::get<1>(e).reserve(new_size);
-                std::move(handlers.begin(), handlers.end(),
-                    std::back_inserter(hpx::get<1>(e)));
-            }
+                pending_parcels_queue::lane_type& lane =
+                    parcels[i].is_high_priority() ?
+                    q.high_priority_parcels_ : q.parcels_;
 
-            parcel_destinations_.insert(locality_id);
-            ++num_parcel_destinations_;
+                lane.enqueue(pending_parcels_queue::entry_type(
+                    std::move(parcels[i]), std::move(handlers[i])));
+            }
         }
 
-        bool dequeue_parcels(locality const& locality_id,
+        // Take the parcels currently queued in the given lane, returns the
+        // number of parcels taken.
+        static std::size_t take_pending_parcels(
+            pending_parcels_queue::lane_type& lane,
             std::vector<parcel>& parcels,
             std::vector<write_handler_type>& handlers)
         {
-            using iterator = pending_parcels_map::iterator;
+            std::size_t size = lane.size_approx();
+            if (size == 0)
+                return 0;
 
-            {
-                std::unique_lock<lcos::local::spinlock> l(mtx_, std::try_to_lock);
+            std::vector<pending_parcels_queue::entry_type> entries;
+            entries.reserve(size);
+            size = lane.try_dequeue_bulk(std::back_inserter(entries), size);
 
-                if (!l) return false;
+            HPX_ASSERT(parcels.empty() && handlers.empty());
+            parcels.reserve(size);
+            handlers.reserve(size);
+            for (pending_parcels_queue::entry_type& entry : entries)
+            {
+                parcels.push_back(std::move(hpx::get<0>(entry)));
+                handlers.push_back(std::move(hpx::get<1>(entry)));
+            }
+            return size;
+        }
 
-                iterator it = pending_parcels_.find(locality_id);
+        bool has_pending_parcels(locality const& locality_id) const
+        {
+            pending_parcels_queue* q = find_pending_parcels_queue(locality_id);
+            return q != nullptr &&
+                q->count_.load(std::memory_order_relaxed) > 0;
+        }
 
-                // do nothing if parcels have already been picked up by
-                // another thread
-                if (it != pending_parcels_.end() && !hpx::get<0>(it->second).empty())
-                {
-                    HPX_ASSERT(it->first == locality_id);
-                    HPX_ASSERT(handlers.size() == 0);
-                    HPX_ASSERT(handlers.size() == parcels.size());
-                    std::swap(parcels, hpx::get<0>(it->second));
-                    HPX_ASSERT(hpx::get<0>(it->second).size() == 0);
-                    std::swap(handlers, hpx::get<1>(it->second));
-                    HPX_ASSERT(handlers.size() == parcels.size());
-
-                    HPX_ASSERT(!handlers.empty());
-                }
-                else
-                {
-                    HPX_ASSERT(hpx::get<1>(it->second).empty());
-                    return false;
-                }
+        bool has_pending_high_priority_parcels(
+            locality const& locality_id) const
+        {
+            pending_parcels_queue* q = find_pending_parcels_queue(locality_id);
+            return q != nullptr && q->high_priority_parcels_.size_approx() != 0;
+        }
 
-                parcel_destinations_.erase(locality_id);
+        bool dequeue_parcels(locality const& locality_id,
+            std::vector<parcel>& parcels,
+            std::vector<write_handler_type>& handlers)
+        {
+            pending_parcels_queue* q = find_pending_parcels_queue(locality_id);
+            if (q == nullptr || q->count_.load(std::memory_order_relaxed) <= 0)
+                return false;
+
+            // only one thread at a time drains the queues of a destination,
+            // all others return right away (the active sender will check for
+            // more pending parcels once it is done)
+            bool expected = false;
+            if (!q->sender_active_.compare_exchange_strong(expected, true))
+                return false;
+
+            // High priority parcels are always sent first and are never
+            // combined with other parcels into the same message, this
+            // prevents them from being held up by bulk transfers.
+            std::size_t count = take_pending_parcels(
+                q->high_priority_parcels_, parcels, handlers);
+            if (count == 0)
+            {
+                count = take_pending_parcels(q->parcels_, parcels, handlers);
+            }
 
-                HPX_ASSERT(0 != num_parcel_destinations_.load());
-                --num_parcel_destinations_;
+            q->count_ -= static_cast<std::int64_t>(count);
+            num_pending_parcels_ -= static_cast<std::int64_t>(count);
 
-                return true;
-            }
+            q->sender_active_.store(false);
+            return count != 0;
         }
 
     protected:
-        bool dequeue_parcel(locality& dest, parcel& p, write_handler_type& handler)
+        bool dequeue_parcel(locality& loc, parcel& p, write_handler_type& handler)
         {
+            std::shared_ptr<pending_parcels_map const> dests =
+                get_pending_parcels_map();
+
+            for (auto const& dest : *dests)
             {
-                std::unique_lock<lcos::local::spinlock> l(mtx_, std::try_to_lock);
+                pending_parcels_queue* q = dest.second.get();
+                if (q->count_.load(std::memory_order_relaxed) <= 0)
+                    continue;
+
+                bool expected = false;
+                if (!q->sender_active_.compare_exchange_strong(expected, true))
+                    continue;
+
+                // high priority parcels are handed out first
+                pending_parcels_queue::entry_type entry;
+                bool result = q->high_priority_parcels_.try_dequeue(entry) ||
+                    q->parcels_.try_dequeue(entry);
+                if (result)
+                {
+                    --q->count_;
+                    --num_pending_parcels_;
+                }
 
-                if (!l) return false;
+                q->sender_active_.store(false);
 
-                for (auto &pending: pending_parcels_)
+                if (result)
                 {
-                    auto &parcels = hpx::get<0>(pending.second);
-                    if (!parcels.empty())
-                    {
-                        auto& handlers = hpx::get<1>(pending.second);
-                        dest = pending.first;
-                        p = std::move(parcels.back());
-                        parcels.pop_back();
-                        handler = std::move(handlers.back());
-                        handlers.pop_back();
-
-                        if (parcels.empty())
-                        {
-                            pending_parcels_.erase(dest);
-                        }
-                        return true;
-                    }
+                    loc = dest.first;
+                    p = std::move(hpx::get<0>(entry));
+                    handler = std::move(hpx::get<1>(entry));
+                    return true;
                 }
             }
             return false;
         }
 
+    protected:
         bool trigger_pending_work()
         {
-            if (0 == num_parcel_destinations_.load(std::memory_order_relaxed))
+            if (num_pending_parcels_.load(std::memory_order_relaxed) <= 0)
                 return true;
 
             std::vector<locality> destinations;
-
-            {
-                std::unique_lock<lcos::local::spinlock> l(mtx_, std::try_to_lock);
-                if(l.owns_lock())
-                {
-                    if (parcel_destinations_.empty())
-                        return true;
-
-                    destinations.reserve(parcel_destinations_.size());
-                    for (locality const& loc : parcel_destinations_)
-                    {
-                        destinations.push_back(loc);
-                    }
-                }
-            }
+            get_pending_parcels_destinations(destinations);
 
             // Create new HPX threads which send the parcels that are still
             // pending.
@@ -792,13 +850,18 @@ namespace hpx { namespace parcelset
                 return;
             }
 
-            // If one of the sending threads are in suspended state, we
-            // need to force a new connection to avoid deadlocks.
-            bool force_connection = true;
-
             error_code ec;
             std::shared_ptr<connection> sender_connection =
-                get_connection(locality_id, force_connection, ec);
+                get_connection(locality_id, false, ec);
+
+            // High priority parcels should not have to wait for one of the
+            // busy connections to become available, we force the creation of
+            // an additional connection instead.
+            if (!sender_connection && !ec &&
+                has_pending_high_priority_parcels(locality_id))
+            {
+                sender_connection = get_connection(locality_id, true, ec);
+            }
 
             if (!sender_connection)
             {
@@ -857,14 +920,9 @@ namespace hpx { namespace parcelset
                 // remove this connection from cache
                 connection_cache_.clear(locality_id, sender_connection);
             }
-            {
-                std::lock_guard<lcos::local::spinlock> l(mtx_);
-
-//                HPX_ASSERT(locality_id == sender_connection->destination());
-                pending_parcels_map::iterator it = pending_parcels_.find(locality_id);
-                if (it == pending_parcels_.end() || hpx::get<0>(it->second).empty())
-                    return;
-            }
+//            HPX_ASSERT(locality_id == sender_connection->destination());
+            if (!has_pending_parcels(locality_id))
+                return;
 
             // Create a new HPX thread which sends parcels that are still
             // pending.
@@ -898,7 +956,8 @@ namespace hpx { namespace parcelset
                 ++operations_in_flight_;
                 // send all of the parcels
                 sender_connection->async_write(
-                    call_for_each(std::move(handlers), std::move(parcels)),
+                    call_for_each(
+                        std::move(handlers), std::move(parcels), this),
                     util::bind_front(&parcelport_impl::send_pending_parcels_trampoline,
                         this));
             }
@@ -922,8 +981,8 @@ namespace hpx { namespace parcelset
 
                 // send only part of the parcels
                 sender_connection->async_write(
-                    call_for_each(
-                        std::move(handled_handlers), std::move(handled_parcels)),
+                    call_for_each(std::move(handled_handlers),
+                        std::move(handled_parcels), this),
                     util::bind_front(&parcelport_impl::send_pending_parcels_trampoline,
                         this));
 
@@ -10,8 +10,10 @@
 #include <hpx/config.hpp>
 #include <hpx/concurrency/spinlock.hpp>
 #include <hpx/naming_base/id_type.hpp>
+#include <hpx/synchronization/condition_variable.hpp>
 
 #include <cstddef>
+#include <cstdint>
 #include <mutex>
 
 #if defined(HPX_MSVC_WARNING_PRAGMA)
@@ -33,9 +35,19 @@ namespace hpx { namespace util
         /// FIXME: is this a policy?
         enum { range_delta = 0x100000 };
 
+        /// the next range is reserved as soon as fewer ids than this are
+        /// left in the current range
+        enum { range_low_watermark = range_delta / 4 };
+
+        /// after a failed reservation, the next attempt is made only after
+        /// a delay which doubles with every failure (in nanoseconds)
+        static constexpr std::uint64_t min_backoff = 1000000;
+        static constexpr std::uint64_t max_backoff = 1000000000;
+
     public:
         unique_id_ranges()
-          : mtx_(), lower_(0), upper_(0)
+          : mtx_(), lower_(0), upper_(0), next_lower_(0), next_upper_(0)
+          , reserving_(false), generation_(0), backoff_(0), retry_time_(0)
         {}
 
         /// Generate next unique component id
@@ -48,12 +60,45 @@ namespace hpx { namespace util
             std::lock_guard<mutex_type> l(mtx_);
             lower_ = lower;
             upper_ = upper;
+            next_lower_ = naming::invalid_gid;
+            next_upper_ = naming::invalid_gid;
+
+            // drop the result of a reservation still in flight
+            reserving_ = false;
+            ++generation_;
+            backoff_ = 0;
+            retry_time_ = 0;
+
+            reserved_cond_.notify_all();
         }
 
     private:
+        /// Start reserving the next range of ids in the background if the
+        /// current one is about to be exhausted
+        void reserve_next_range(std::unique_lock<mutex_type>& l);
+
+        /// Request the next range of ids from AGAS and store it, unless the
+        /// ranges were reset in the meantime
+        void fetch_next_range(std::size_t generation);
+
         /// The range of available ids for components
         naming::gid_type lower_;
         naming::gid_type upper_;
+
+        /// The range reserved ahead of time, used once the current range
+        /// is exhausted
+        naming::gid_type next_lower_;
+        naming::gid_type next_upper_;
+        bool reserving_;
+        std::size_t generation_;
+
+        /// Threads which exhausted the current range wait for a reservation
+        /// in flight to arrive
+        lcos::local::condition_variable_any reserved_cond_;
+
+        /// Back-off after failed reservations
+        std::uint64_t backoff_;
+        std::uint64_t retry_time_;
     };
 }}
 
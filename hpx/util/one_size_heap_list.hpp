@@ -9,9 +9,11 @@
 
 #include <hpx/config.hpp>
 #include <hpx/assert.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
 #include <hpx/synchronization/spinlock.hpp>
 #include <hpx/util/wrapper_heap_base.hpp>
 
+#include <atomic>
 #include <cstddef>
 #include <list>
 #include <memory>
@@ -23,6 +25,11 @@
 ///////////////////////////////////////////////////////////////////////////////
 namespace hpx { namespace util
 {
+    // The list of heaps is shared by all worker threads, however each worker
+    // thread allocates from its own heap (slab) only. The heaps themselves
+    // are never removed from the list before the list is destroyed, which
+    // allows to remember the heaps last used by a worker thread without
+    // holding the lock protecting the list.
     class HPX_EXPORT one_size_heap_list
     {
     public:
@@ -37,6 +44,25 @@ namespace hpx { namespace util
         typedef wrapper_heap_base::heap_parameters heap_parameters;
 
     private:
+        // the heaps recently used by one of the worker threads
+        struct worker_data
+        {
+            worker_data()
+              : alloc_heap_(nullptr)
+              , free_heap_(nullptr)
+            {
+            }
+
+            mutex_type mtx_;
+            util::wrapper_heap_base* alloc_heap_;
+            util::wrapper_heap_base* free_heap_;
+        };
+
+        typedef util::cache_aligned_data_derived<worker_data> worker_data_type;
+
+        static std::size_t get_num_workers();
+        worker_data_type& get_worker_data() const;
+
         template <typename Heap>
         static std::shared_ptr<util::wrapper_heap_base> create_heap(
             char const* name, std::size_t counter, heap_parameters parameters)
@@ -58,6 +84,7 @@ namespace hpx { namespace util
             , heap_count_(0)
             , max_alloc_count_(0)
 #endif
+            , num_workers_(0)
             , create_heap_(nullptr)
             , parameters_({0, 0, 0})
         {
@@ -74,6 +101,8 @@ namespace hpx { namespace util
             , heap_count_(0L)
             , max_alloc_count_(0L)
 #endif
+            , num_workers_(get_num_workers())
+            , workers_(new worker_data_type[num_workers_])
             , create_heap_(&one_size_heap_list::create_heap<Heap>)
             , parameters_(parameters)
         {}
@@ -88,6 +117,8 @@ namespace hpx { namespace util
             , heap_count_(0L)
             , max_alloc_count_(0L)
 #endif
+            , num_workers_(get_num_workers())
+            , workers_(new worker_data_type[num_workers_])
             , create_heap_(&one_size_heap_list::create_heap<Heap>)
             , parameters_(parameters)
         {}
@@ -107,6 +138,10 @@ namespace hpx { namespace util
         std::string name() const;
 
     protected:
+        // Return the heap which has allocated the given pointer, returns
+        // nullptr if the pointer was not allocated by any of the heaps
+        util::wrapper_heap_base* find_heap(void* p) const;
+
         mutable mutex_type mtx_;
         list_type heap_list_;
 
@@ -115,11 +150,17 @@ namespace hpx { namespace util
 
     public:
 #if defined(HPX_DEBUG)
-        std::size_t alloc_count_;
-        std::size_t free_count_;
+        std::atomic<std::size_t> alloc_count_;
+        std::atomic<std::size_t> free_count_;
         std::size_t heap_count_;
-        std::size_t max_alloc_count_;
+        std::atomic<std::size_t> max_alloc_count_;
 #endif
+
+    private:
+        std::size_t const num_workers_;
+        std::unique_ptr<worker_data_type[]> workers_;
+
+    public:
         std::shared_ptr<util::wrapper_heap_base> (*create_heap_)(
             char const*, std::size_t, heap_parameters);
 
@@ -150,6 +150,33 @@
 #  define HPX_PARCEL_MAX_OUTBOUND_MESSAGE_SIZE 1000000
 #endif
 
+/// This defines the maximal amount of parcel data which may be queued or in
+/// flight for a single destination locality. Threads sending more parcels to
+/// that locality are suspended until some of the data has been transferred.
+/// A value of zero disables the flow control. This value can be changed at
+/// runtime by setting the configuration parameter:
+///
+///   hpx.parcel.max_pending_outbound_size = ...
+///
+/// (or by setting the corresponding environment variable
+/// HPX_PARCEL_MAX_PENDING_OUTBOUND_SIZE).
+#if !defined(HPX_PARCEL_MAX_PENDING_OUTBOUND_SIZE)
+#  define HPX_PARCEL_MAX_PENDING_OUTBOUND_SIZE 268435456
+#endif
+
+/// This defines the maximal amount of memory (in bytes) each parcelport keeps
+/// cached in its pool of message buffers for later reuse. A value of zero
+/// disables the pooling of message buffers. This value can be changed at
+/// runtime by setting the configuration parameter:
+///
+///   hpx.parcel.buffer_pool_size = ...
+///
+/// (or by setting the corresponding environment variable
+/// HPX_PARCEL_BUFFER_POOL_SIZE).
+#if !defined(HPX_PARCEL_BUFFER_POOL_SIZE)
+#  define HPX_PARCEL_BUFFER_POOL_SIZE 67108864
+#endif
+
 ///////////////////////////////////////////////////////////////////////////////
 // This defines the number of bytes of overhead it takes to serialize a
 // parcel.
@@ -177,6 +204,12 @@
 #  define HPX_INITIAL_AGAS_MAX_PENDING_REFCNT_REQUESTS 4096
 #endif
 
+/// This defines the maximum time (in microseconds) a reference counting
+/// request is buffered before it is sent to AGAS
+#if !defined(HPX_INITIAL_AGAS_MAX_PENDING_REFCNT_DELAY)
+#  define HPX_INITIAL_AGAS_MAX_PENDING_REFCNT_DELAY 1000
+#endif
+
 ///////////////////////////////////////////////////////////////////////////////
 /// This defines the initial global reference count associated with any created
 /// object.
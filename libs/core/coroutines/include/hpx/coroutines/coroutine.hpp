@@ -79,12 +79,10 @@ namespace hpx { namespace threads { namespace coroutines {
             return impl_.get_thread_id();
         }
 
-#if defined(HPX_HAVE_THREAD_PHASE_INFORMATION)
         std::size_t get_thread_phase() const
         {
             return impl_.get_thread_phase();
         }
-#endif
 
         std::size_t get_thread_data() const
         {
@@ -78,9 +78,7 @@ namespace hpx { namespace threads { namespace coroutines { namespace detail {
           , m_state(ctx_ready)
           , m_exit_state(ctx_exit_not_requested)
           , m_exit_status(ctx_not_exited)
-#if defined(HPX_HAVE_THREAD_PHASE_INFORMATION)
           , m_phase(0)
-#endif
 #if defined(HPX_HAVE_THREAD_LOCAL_STORAGE)
           , m_thread_data(nullptr)
 #else
@@ -113,18 +111,14 @@ namespace hpx { namespace threads { namespace coroutines { namespace detail {
 
         void reset()
         {
-#if defined(HPX_HAVE_THREAD_PHASE_INFORMATION)
             m_phase = 0;
-#endif
             m_thread_id.reset();
         }
 
-#if defined(HPX_HAVE_THREAD_PHASE_INFORMATION)
         std::size_t phase() const
         {
             return m_phase;
         }
-#endif
 
         thread_id_type get_thread_id() const
         {
@@ -327,9 +321,7 @@ namespace hpx { namespace threads { namespace coroutines { namespace detail {
             m_state = ctx_ready;
             m_exit_state = ctx_exit_not_requested;
             m_exit_status = ctx_not_exited;
-#if defined(HPX_HAVE_THREAD_PHASE_INFORMATION)
             HPX_ASSERT(m_phase == 0);
-#endif
 #if defined(HPX_HAVE_THREAD_LOCAL_STORAGE)
             HPX_ASSERT(m_thread_data == nullptr);
 #else
@@ -370,9 +362,7 @@ namespace hpx { namespace threads { namespace coroutines { namespace detail {
         void do_invoke() noexcept
         {
             HPX_ASSERT(is_ready());
-#if defined(HPX_HAVE_THREAD_PHASE_INFORMATION)
             ++m_phase;
-#endif
             m_state = ctx_running;
 
 #if defined(HPX_HAVE_ADDRESS_SANITIZER)
@@ -393,9 +383,7 @@ namespace hpx { namespace threads { namespace coroutines { namespace detail {
         context_state m_state;
         context_exit_state m_exit_state;
         context_exit_status m_exit_status;
-#if defined(HPX_HAVE_THREAD_PHASE_INFORMATION)
         std::size_t m_phase;
-#endif
 #if defined(HPX_HAVE_THREAD_LOCAL_STORAGE)
         mutable detail::tss_storage* m_thread_data;
 #else
@@ -105,12 +105,10 @@ namespace hpx { namespace threads { namespace coroutines { namespace detail {
             m_arg = arg;
         }
 
-#if defined(HPX_HAVE_THREAD_PHASE_INFORMATION)
         std::size_t get_thread_phase() const
         {
             return this->phase();
         }
-#endif
 
         void reset()
         {
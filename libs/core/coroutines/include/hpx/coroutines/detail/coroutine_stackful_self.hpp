@@ -53,12 +53,8 @@ namespace hpx { namespace threads { namespace coroutines { namespace detail {
 
         std::size_t get_thread_phase() const override
         {
-#if defined(HPX_HAVE_THREAD_PHASE_INFORMATION)
             HPX_ASSERT(pimpl_);
             return pimpl_->get_thread_phase();
-#else
-            return 0;
-#endif
         }
 
         std::ptrdiff_t get_available_stack_space() override
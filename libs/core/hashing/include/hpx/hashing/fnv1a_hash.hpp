@@ -0,0 +1,49 @@
+//  Copyright (c) 2020 STE||AR Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace hpx { namespace util {
+
+    namespace detail {
+
+        HPX_STATIC_CONSTEXPR std::uint64_t fnv1a_offset_basis =
+            14695981039346656037ull;
+        HPX_STATIC_CONSTEXPR std::uint64_t fnv1a_prime = 1099511628211ull;
+    }    // namespace detail
+
+    // This function calculates the 64 bit FNV-1a hash of the given sequence
+    // of characters. The hash can be computed at compile time, it is used to
+    // derive stable identifiers from type names.
+    constexpr std::uint64_t fnv1a_hash(char const* str, std::size_t size)
+    {
+        std::uint64_t hash = detail::fnv1a_offset_basis;
+        for (std::size_t i = 0; i != size; ++i)
+        {
+            hash ^= static_cast<std::uint64_t>(
+                static_cast<unsigned char>(str[i]));
+            hash *= detail::fnv1a_prime;
+        }
+        return hash;
+    }
+
+    constexpr std::uint64_t fnv1a_hash(char const* str)
+    {
+        std::uint64_t hash = detail::fnv1a_offset_basis;
+        for (/**/; *str != '\0'; ++str)
+        {
+            hash ^= static_cast<std::uint64_t>(
+                static_cast<unsigned char>(*str));
+            hash *= detail::fnv1a_prime;
+        }
+        return hash;
+    }
+}}    // namespace hpx::util
@@ -12,6 +12,7 @@
 #include <hpx/serialization/binary_filter.hpp>
 
 #include <cstddef>
+#include <memory>
 
 namespace hpx { namespace serialization {
 
@@ -43,5 +44,14 @@ namespace hpx { namespace serialization {
         virtual void set_filter(binary_filter* filter) = 0;
         virtual void load_binary(void* address, std::size_t count) = 0;
         virtual void load_binary_chunk(void* address, std::size_t count) = 0;
+
+        // Hand out the memory of the next zero-copy chunk instead of
+        // copying it, returns an empty pointer if that is not possible.
+        virtual std::shared_ptr<void> adopt_binary_chunk(
+            std::size_t /* count */, std::size_t /* alignment */,
+            void*& /* address */)
+        {
+            return std::shared_ptr<void>();
+        }
     };
 }}    // namespace hpx::serialization
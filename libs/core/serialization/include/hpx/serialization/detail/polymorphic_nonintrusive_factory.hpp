@@ -13,6 +13,7 @@
 #include <hpx/assert.hpp>
 #include <hpx/modules/debugging.hpp>
 #include <hpx/modules/errors.hpp>
+#include <hpx/hashing/fnv1a_hash.hpp>
 #include <hpx/modules/hashing.hpp>
 #include <hpx/preprocessor/stringize.hpp>
 #include <hpx/preprocessor/strip_parens.hpp>
@@ -22,6 +23,7 @@
 #include <hpx/serialization/traits/polymorphic_traits.hpp>
 #include <hpx/type_support/static.hpp>
 
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <type_traits>
@@ -130,10 +132,18 @@ namespace hpx { namespace serialization { namespace detail {
         HPX_NON_COPYABLE(polymorphic_nonintrusive_factory);
 
     public:
-        using serializer_map_type = std::unordered_map<std::string,
-            function_bunch_type, hpx::util::jenkins_hash>;
+        // Classes are identified on the wire by the hash of their (portable)
+        // name, the name itself is kept for detecting collisions only.
+        struct serializer_entry
+        {
+            std::string name;
+            function_bunch_type bunch;
+        };
+
+        using serializer_map_type =
+            std::unordered_map<std::uint64_t, serializer_entry>;
         using serializer_typeinfo_map_type = std::unordered_map<std::string,
-            std::string, hpx::util::jenkins_hash>;
+            std::uint64_t, hpx::util::jenkins_hash>;
 
         HPX_CORE_EXPORT static polymorphic_nonintrusive_factory& instance();
 
@@ -152,13 +162,26 @@ namespace hpx { namespace serialization { namespace detail {
                     "polymorphic_nonintrusive_factory::register_class",
                     "Cannot register a factory with an empty name");
             }
-            auto it = map_.find(class_name);
-            auto jt = typeinfo_map_.find(typeinfo.name());
 
+            std::uint64_t const id =
+                util::fnv1a_hash(class_name.data(), class_name.size());
+
+            auto it = map_.find(id);
             if (it == map_.end())
-                map_[class_name] = bunch;
+            {
+                map_.emplace(id, serializer_entry{class_name, bunch});
+            }
+            else if (it->second.name != class_name)
+            {
+                HPX_THROW_EXCEPTION(serialization_error,
+                    "polymorphic_nonintrusive_factory::register_class",
+                    "The names of the classes " + it->second.name + " and " +
+                        class_name + " map to the same identifier");
+            }
+
+            auto jt = typeinfo_map_.find(typeinfo.name());
             if (jt == typeinfo_map_.end())
-                typeinfo_map_[typeinfo.name()] = class_name;
+                typeinfo_map_[typeinfo.name()] = id;
         }
 
         // the following templates are defined in *.ipp file
@@ -14,7 +14,9 @@
 #include <hpx/serialization/output_archive.hpp>
 #include <hpx/serialization/string.hpp>
 
+#include <cstdint>
 #include <string>
+#include <typeinfo>
 
 namespace hpx { namespace serialization { namespace detail {
 
@@ -22,30 +24,30 @@ namespace hpx { namespace serialization { namespace detail {
     void polymorphic_nonintrusive_factory::save(output_archive& ar, const T& t)
     {
         // It's safe to call typeid here. The typeid(t) return value is
-        // only used for local lookup to the portable string that goes over the
-        // wire
-        std::string const class_name = typeinfo_map_.at(typeid(t).name());
-        ar << class_name;
+        // only used for local lookup to the portable identifier that goes
+        // over the wire
+        std::uint64_t const id = typeinfo_map_.at(typeid(t).name());
+        ar << id;
 
-        map_.at(class_name).save_function(ar, &t);
+        map_.at(id).bunch.save_function(ar, &t);
     }
 
     template <typename T>
     void polymorphic_nonintrusive_factory::load(input_archive& ar, T& t)
     {
-        std::string class_name;
-        ar >> class_name;
+        std::uint64_t id = 0;
+        ar >> id;
 
-        map_.at(class_name).load_function(ar, &t);
+        map_.at(id).bunch.load_function(ar, &t);
     }
 
     template <typename T>
     T* polymorphic_nonintrusive_factory::load(input_archive& ar)
     {
-        std::string class_name;
-        ar >> class_name;
+        std::uint64_t id = 0;
+        ar >> id;
 
-        const function_bunch_type& bunch = map_.at(class_name);
+        const function_bunch_type& bunch = map_.at(id).bunch;
         T* t = static_cast<T*>(bunch.create_function(ar));
 
         return t;
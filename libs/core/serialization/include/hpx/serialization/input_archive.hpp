@@ -34,10 +34,11 @@ namespace hpx { namespace serialization {
 
         template <typename Container>
         input_archive(Container& buffer, std::size_t inbound_data_size = 0,
-            const std::vector<serialization_chunk>* chunks = nullptr)
+            const std::vector<serialization_chunk>* chunks = nullptr,
+            const std::vector<std::shared_ptr<void>>* chunk_owners = nullptr)
           : base_type(0U)
           , buffer_(new input_container<Container>(
-                buffer, chunks, inbound_data_size))
+                buffer, chunks, inbound_data_size, chunk_owners))
         {
             // endianness needs to be saves separately as it is needed to
             // properly interpret the flags
@@ -121,6 +122,25 @@ namespace hpx { namespace serialization {
             return basic_archive<input_archive>::current_pos();
         }
 
+        // Take over the memory of the next zero-copy chunk instead of
+        // copying it into memory allocated by the caller. This is possible
+        // only if the received chunk is exactly count bytes large, suitably
+        // aligned, and owned by a buffer with shared ownership. Returns the
+        // owner of the memory (or an empty pointer if the caller has to use
+        // load_binary_chunk).
+        std::shared_ptr<void> adopt_binary_chunk(
+            std::size_t count, std::size_t alignment, void*& address)
+        {
+            if (0 == count || disable_data_chunking())
+                return std::shared_ptr<void>();
+
+            std::shared_ptr<void> owner =
+                buffer_->adopt_binary_chunk(count, alignment, address);
+            if (owner)
+                size_ += count;
+            return owner;
+        }
+
     private:
         friend struct basic_archive<input_archive>;
 
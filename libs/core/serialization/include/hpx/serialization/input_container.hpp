@@ -58,12 +58,14 @@ namespace hpx { namespace serialization {
           , chunks_(nullptr)
           , current_chunk_(std::size_t(-1))
           , current_chunk_size_(0)
+          , chunk_owners_(nullptr)
         {
         }
 
         input_container(Container const& cont,
             std::vector<serialization_chunk> const* chunks,
-            std::size_t inbound_data_size)
+            std::size_t inbound_data_size,
+            std::vector<std::shared_ptr<void>> const* chunk_owners = nullptr)
           : cont_(cont)
           , current_(0)
           , filter_()
@@ -71,11 +73,15 @@ namespace hpx { namespace serialization {
           , chunks_(nullptr)
           , current_chunk_(std::size_t(-1))
           , current_chunk_size_(0)
+          , chunk_owners_(nullptr)
         {
             if (chunks && chunks->size() != 0)
             {
                 chunks_ = chunks;
                 current_chunk_ = 0;
+
+                if (chunk_owners && chunk_owners->size() == chunks->size())
+                    chunk_owners_ = chunk_owners;
             }
         }
 
@@ -168,15 +174,43 @@ namespace hpx { namespace serialization {
                     return;
                 }
 
-                // unfortunately we can't implement a zero copy policy on
-                // the receiving end
-                // as the memory was already allocated by the serialization code
+                // the memory was already allocated by the serialization
+                // code, see adopt_binary_chunk for avoiding this copy
                 std::memcpy(
                     address, get_chunk_data(current_chunk_).pos_, count);
                 ++current_chunk_;
             }
         }
 
+        // The parcelport may have received the zero-copy chunks into
+        // buffers with shared ownership, in this case the de-serialized
+        // object can refer to the received data directly.
+        std::shared_ptr<void> adopt_binary_chunk(std::size_t count,
+            std::size_t alignment, void*& address)    // override
+        {
+            if (chunk_owners_ == nullptr ||
+                count < HPX_ZERO_COPY_SERIALIZATION_THRESHOLD || filter_ ||
+                current_chunk_ >= get_num_chunks() ||
+                get_chunk_type(current_chunk_) != chunk_type_pointer ||
+                get_chunk_size(current_chunk_) != count)
+            {
+                return std::shared_ptr<void>();
+            }
+
+            std::shared_ptr<void> const& owner =
+                (*chunk_owners_)[current_chunk_];
+            void* pos = get_chunk_data(current_chunk_).pos_;
+            if (!owner ||
+                reinterpret_cast<std::uintptr_t>(pos) % alignment != 0)
+            {
+                return std::shared_ptr<void>();
+            }
+
+            address = pos;
+            ++current_chunk_;
+            return owner;
+        }
+
         Container const& cont_;
         std::size_t current_;
         std::unique_ptr<binary_filter> filter_;
@@ -185,5 +219,8 @@ namespace hpx { namespace serialization {
         std::vector<serialization_chunk> const* chunks_;
         std::size_t current_chunk_;
         std::size_t current_chunk_size_;
+
+        // owners of the memory referenced by the pointer chunks (optional)
+        std::vector<std::shared_ptr<void>> const* chunk_owners_;
     };
 }}    // namespace hpx::serialization
@@ -14,6 +14,9 @@
 #include <hpx/serialization/array.hpp>
 #include <hpx/serialization/serialization_fwd.hpp>
 #include <hpx/serialization/serialize.hpp>
+#include <hpx/serialization/traits/is_bitwise_serializable.hpp>
+
+#include <boost/predef/other/endian.h>
 
 #if !defined(HPX_HAVE_CXX17_SHARED_PTR_ARRAY)
 #include <boost/shared_array.hpp>
@@ -23,6 +26,7 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <memory>
 #include <type_traits>
 
 namespace hpx { namespace serialization {
@@ -301,12 +305,50 @@ namespace hpx { namespace serialization {
         }
 
         ///////////////////////////////////////////////////////////////////////
+        // Refer to the memory of a received zero-copy chunk instead of
+        // copying it. This is done only for buffers using the default
+        // allocator, a custom allocator determines the memory to use.
+        template <typename Archive>
+        bool adopt_chunk(Archive& ar, std::true_type)
+        {
+#if BOOST_ENDIAN_BIG_BYTE
+            bool archive_endianess_differs = ar.endian_little();
+#else
+            bool archive_endianess_differs = ar.endian_big();
+#endif
+            if (ar.disable_array_optimization() || archive_endianess_differs)
+                return false;
+
+            void* address = nullptr;
+            std::shared_ptr<void> owner =
+                ar.adopt_binary_chunk(size_ * sizeof(T), alignof(T), address);
+            if (!owner)
+                return false;
+
+            // keep the received data alive as long as it is referenced
+            data_ = buffer_type(static_cast<T*>(address), [owner](T*) {});
+            return true;
+        }
+
+        template <typename Archive>
+        bool adopt_chunk(Archive&, std::false_type)
+        {
+            return false;
+        }
+
         template <typename Archive>
         void load(Archive& ar, unsigned int const)
         {
             ar >> size_ >> alloc_;
             // -V128
 
+            using can_adopt = std::integral_constant<bool,
+                std::is_same<Allocator, std::allocator<T>>::value &&
+                    hpx::traits::is_bitwise_serializable<T>::value>;
+
+            if (size_ != 0 && adopt_chunk(ar, can_adopt()))
+                return;
+
             data_.reset(alloc_.allocate(size_),
                 [alloc = this->alloc_, size = this->size_](T* p) {
                     serialize_buffer::deleter<allocator_type>(p, alloc, size);
@@ -12,9 +12,13 @@
 #include <hpx/include/actions.hpp>
 #include <hpx/include/lcos.hpp>
 #include <hpx/modules/testing.hpp>
+#include <hpx/serialization/input_archive.hpp>
+#include <hpx/serialization/output_archive.hpp>
+#include <hpx/serialization/serialization_chunk.hpp>
 #include <hpx/serialization/serialize_buffer.hpp>
 
 #include <cstddef>
+#include <cstring>
 #include <memory>
 #include <vector>
 
@@ -133,6 +137,74 @@ void test_initialization_from_vector(std::size_t max_size)
     }
 }
 
+template <typename T>
+void test_adopt_received_chunks(std::size_t size)
+{
+    using buffer_type = hpx::serialization::serialize_buffer<T>;
+
+    buffer_type send_buffer(size);
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        send_buffer[i] = static_cast<T>(i);
+    }
+
+    std::vector<char> buffer;
+    std::vector<hpx::serialization::serialization_chunk> chunks;
+    hpx::serialization::output_archive oarchive(buffer, 0, &chunks);
+    oarchive << send_buffer;
+    std::size_t archive_size = oarchive.bytes_written();
+
+    // simulate a parcelport receiving the zero-copy chunks into buffers
+    // with shared ownership
+    std::vector<std::shared_ptr<void>> owners(chunks.size());
+    void const* received = nullptr;
+    for (std::size_t i = 0; i != chunks.size(); ++i)
+    {
+        hpx::serialization::serialization_chunk& c = chunks[i];
+        if (c.type_ != hpx::serialization::chunk_type_pointer)
+            continue;
+
+        hpx::serialization::serialize_buffer<char> chunk(c.size_);
+        std::memcpy(chunk.data(), c.data_.cpos_, c.size_);
+
+        c.data_.pos_ = chunk.data();
+        owners[i] = std::shared_ptr<void>(chunk.data(), [chunk](void*) {});
+        received = chunk.data();
+    }
+
+    {
+        hpx::serialization::input_archive iarchive(
+            buffer, archive_size, &chunks, &owners);
+        buffer_type recv_buffer;
+        iarchive >> recv_buffer;
+
+        HPX_TEST_EQ(recv_buffer.size(), size);
+        HPX_TEST_EQ(
+            0, std::memcmp(recv_buffer.data(), send_buffer.data(),
+                   size * sizeof(T)));
+
+        // the received chunk is used as is, if there was one
+        if (received != nullptr)
+        {
+            HPX_TEST(static_cast<void const*>(recv_buffer.data()) == received);
+        }
+    }
+
+    {
+        // without owners the data is copied
+        hpx::serialization::input_archive iarchive(
+            buffer, archive_size, &chunks);
+        buffer_type recv_buffer;
+        iarchive >> recv_buffer;
+
+        HPX_TEST_EQ(recv_buffer.size(), size);
+        HPX_TEST_EQ(
+            0, std::memcmp(recv_buffer.data(), send_buffer.data(),
+                   size * sizeof(T)));
+        HPX_TEST(static_cast<void const*>(recv_buffer.data()) != received);
+    }
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 int hpx_main()
 {
@@ -156,6 +228,9 @@ int hpx_main()
         test_fixed_size_initialization_for_persistent_buffers<char>(size);
         test_fixed_size_initialization_for_persistent_buffers<float>(size);
         test_fixed_size_initialization_for_persistent_buffers<double>(size);
+
+        test_adopt_received_chunks<char>(size);
+        test_adopt_received_chunks<double>(size);
     }
 
     return hpx::finalize();
@@ -75,12 +75,10 @@ namespace hpx { namespace threads {
             return this->thread_data::get_thread_id();
         }
 #endif
-#if defined(HPX_HAVE_THREAD_PHASE_INFORMATION)
         std::size_t get_thread_phase() const noexcept override
         {
             return coroutine_.get_thread_phase();
         }
-#endif
 
         std::size_t get_thread_data() const override
         {
@@ -9,17 +9,22 @@
 
 #include <hpx/config.hpp>
 #include <hpx/actions_base/actions_base_support.hpp>
+#include <hpx/actions_base/detail/action_execution_statistics.hpp>
 #include <hpx/actions_base/traits/action_continuation.hpp>
 #include <hpx/actions_base/traits/action_priority.hpp>
 #include <hpx/actions_base/traits/action_select_direct_execution.hpp>
 #include <hpx/actions_base/traits/action_stacksize.hpp>
 #include <hpx/async_base/launch_policy.hpp>
 #include <hpx/coroutines/thread_enums.hpp>
+#include <hpx/modules/errors.hpp>
 #include <hpx/naming_base/address.hpp>
+#include <hpx/runtime/actions/trigger.hpp>
 #include <hpx/runtime_fwd.hpp>
+#include <hpx/runtime_local/report_error.hpp>
 #include <hpx/state.hpp>
 #include <hpx/threading_base/thread_helpers.hpp>
 #include <hpx/traits/action_decorate_continuation.hpp>
+#include <hpx/traits/action_decorate_function.hpp>
 #include <hpx/traits/action_schedule_thread.hpp>
 
 #include <chrono>
@@ -148,6 +153,66 @@ namespace hpx { namespace applier { namespace detail {
         }
     }
 
+#if defined(HPX_HAVE_ADAPTIVE_DIRECT_EXECUTION)
+    ///////////////////////////////////////////////////////////////////////////
+    // Return whether an action received from a remote locality should be
+    // executed directly on the thread decoding the parcel. This is the case
+    // for actions which are known to finish quickly without suspending, as
+    // long as neither the action nor its component requires otherwise.
+    template <typename Action>
+    bool select_adaptive_direct_execution(naming::address::address_type lva)
+    {
+        if (Action::direct_execution::value ||
+            traits::action_decorate_function<Action>::value ||
+            static_cast<threads::thread_stacksize>(
+                traits::action_stacksize<Action>::value) !=
+                threads::thread_stacksize::default_)
+        {
+            return false;
+        }
+
+        return Action::get_execution_statistics().select_direct_execution() &&
+            traits::action_select_direct_execution<Action>::call(
+                launch::async, lva) == launch::async &&
+            threads::get_self_ptr() != nullptr &&
+            this_thread::has_sufficient_stack_space();
+    }
+
+    // Execute an action directly, exceptions are reported the same way as if
+    // the action was run on a separate thread.
+    template <typename Action, typename... Ts>
+    void call_adaptive_direct(naming::address::address_type lva,
+        naming::address::component_type comptype, Ts&&... vs)
+    {
+        try
+        {
+            actions::detail::action_execution_scope scope(
+                Action::get_execution_statistics());
+            call_sync<Action>(lva, comptype, std::forward<Ts>(vs)...);
+        }
+        catch (hpx::thread_interrupted const&)
+        {    //-V565
+             /* swallow this exception */
+        }
+        catch (...)
+        {
+            // report this error to the console in any case
+            hpx::report_error(std::current_exception());
+        }
+    }
+
+    template <typename Action, typename Continuation, typename... Ts>
+    void call_adaptive_direct(Continuation&& cont,
+        naming::address::address_type lva,
+        naming::address::component_type comptype, Ts&&... vs)
+    {
+        // only the action is measured, not the continuation
+        actions::trigger(std::forward<Continuation>(cont),
+            actions::detail::measured_action_invoke<Action>{lva, comptype},
+            std::forward<Ts>(vs)...);
+    }
+#endif
+
     ///////////////////////////////////////////////////////////////////////////
     template <typename Action,
         bool DirectExecute = Action::direct_execution::value>
@@ -102,6 +102,11 @@ namespace hpx { namespace actions {
             naming::gid_type&& target, naming::address_type lva,
             naming::component_type comptype, std::size_t num_thread,
             bool& deferred_schedule) override;
+
+#if defined(HPX_HAVE_ADAPTIVE_DIRECT_EXECUTION)
+    private:
+        bool execute_directly_ = false;
+#endif
     };
     /// \endcond
 
@@ -160,6 +165,19 @@ namespace hpx { namespace actions {
             target = naming::id_type(target_gid, naming::id_type::managed);
         }
 
+#if defined(HPX_HAVE_ADAPTIVE_DIRECT_EXECUTION)
+        // the decision to execute the action directly is made when the
+        // parcel is decoded, see load_schedule
+        if (execute_directly_)
+        {
+            execute_directly_ = false;
+            applier::detail::call_adaptive_direct<
+                typename base_type::derived_type>(lva, comptype,
+                std::move(hpx::get<Is>(this->arguments_))...);
+            return;
+        }
+#endif
+
         threads::thread_init_data data;
 #if defined(HPX_HAVE_THREAD_DESCRIPTION)
         data.description = actions::detail::get_action_name<Action>();
@@ -210,11 +228,22 @@ namespace hpx { namespace actions {
         // First, serialize, then schedule
         load(ar);
 
+#if defined(HPX_HAVE_ADAPTIVE_DIRECT_EXECUTION)
+        // actions known to finish quickly are executed right away, they are
+        // treated like direct actions from here on
+        execute_directly_ = applier::detail::select_adaptive_direct_execution<
+            typename base_type::derived_type>(lva);
+        bool const direct_execution =
+            base_type::direct_execution::value || execute_directly_;
+#else
+        bool const direct_execution = base_type::direct_execution::value;
+#endif
+
         if (deferred_schedule)
         {
             // If this is a direct action and deferred schedule was requested,
             // that is we are not the last parcel, return immediately
-            if (base_type::direct_execution::value)
+            if (direct_execution)
             {
                 return;
             }
@@ -172,10 +172,13 @@ namespace hpx { namespace actions {
         // construct an empty transfer_action to avoid serialization overhead
         transfer_base_action() = default;
 
-        // construct an action from its arguments
+        // construct an action from its arguments, the static priority of the
+        // action is applied right away as the parcel layer relies on it
         template <typename... Ts>
         explicit transfer_base_action(Ts&&... vs)
-          : base_action_data(threads::thread_priority::default_,
+          : base_action_data(
+                detail::thread_priority<priority_value>::call(
+                    threads::thread_priority::default_),
                 threads::thread_stacksize::default_)
           , arguments_(std::forward<Ts>(vs)...)
         {
@@ -183,7 +186,9 @@ namespace hpx { namespace actions {
 
         template <typename... Ts>
         transfer_base_action(threads::thread_priority priority, Ts&&... vs)
-          : base_action_data(priority, threads::thread_stacksize::default_)
+          : base_action_data(
+                detail::thread_priority<priority_value>::call(priority),
+                threads::thread_stacksize::default_)
           , arguments_(std::forward<Ts>(vs)...)
         {
         }
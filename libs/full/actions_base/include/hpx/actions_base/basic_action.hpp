@@ -14,6 +14,7 @@
 #include <hpx/actions_base/actions_base_fwd.hpp>
 #include <hpx/actions_base/actions_base_support.hpp>
 #include <hpx/actions_base/basic_action_fwd.hpp>
+#include <hpx/actions_base/detail/action_execution_statistics.hpp>
 #include <hpx/actions_base/detail/action_factory.hpp>
 #include <hpx/actions_base/detail/invocation_count_registry.hpp>
 #include <hpx/actions_base/detail/per_action_data_counter_registry.hpp>
@@ -106,6 +107,10 @@ namespace hpx { namespace actions {
                     LTM_(debug)
                         << "Executing " << Action::get_action_name(lva_) << ".";
 
+#if defined(HPX_HAVE_ADAPTIVE_DIRECT_EXECUTION)
+                    action_execution_scope scope(
+                        Action::get_execution_statistics());
+#endif
                     // invoke the action, ignoring the return value
                     util::invoke_fused(action_invoke<Action>{lva_, comptype_},
                         std::move(args_));
@@ -174,9 +179,16 @@ namespace hpx { namespace actions {
                 LTM_(debug) << "Executing " << Action::get_action_name(lva_)
                             << " with continuation(" << cont_.get_id() << ")";
 
+#if defined(HPX_HAVE_ADAPTIVE_DIRECT_EXECUTION)
+                actions::trigger(std::move(cont_),
+                    util::functional::invoke_fused{},
+                    measured_action_invoke<Action>{lva_, comptype_},
+                    std::move(args_));
+#else
                 actions::trigger(std::move(cont_),
                     util::functional::invoke_fused{},
                     action_invoke<Action>{lva_, comptype_}, std::move(args_));
+#endif
 
                 return threads::thread_result_type(
                     threads::thread_schedule_state::terminated,
@@ -454,8 +466,20 @@ namespace hpx { namespace actions {
             return util::get_and_reset_value(invocation_count_, reset);
         }
 
+#if defined(HPX_HAVE_ADAPTIVE_DIRECT_EXECUTION)
+        /// Access the statistics used to decide whether this action can be
+        /// executed directly when it is received from a remote locality
+        static detail::action_execution_statistics& get_execution_statistics()
+        {
+            return execution_statistics_;
+        }
+#endif
+
     private:
         static std::atomic<std::int64_t> invocation_count_;
+#if defined(HPX_HAVE_ADAPTIVE_DIRECT_EXECUTION)
+        static detail::action_execution_statistics execution_statistics_;
+#endif
 
     protected:
         static void increment_invocation_count()
@@ -469,6 +493,13 @@ namespace hpx { namespace actions {
     std::atomic<std::int64_t>
         basic_action<Component, R(Args...), Derived>::invocation_count_(0);
 
+#if defined(HPX_HAVE_ADAPTIVE_DIRECT_EXECUTION)
+    template <typename Component, typename R, typename... Args,
+        typename Derived>
+    detail::action_execution_statistics
+        basic_action<Component, R(Args...), Derived>::execution_statistics_;
+#endif
+
     namespace detail {
         template <typename Action>
         void register_local_action_invocation_count(
@@ -0,0 +1,148 @@
+//  Copyright (c) 2020 STE||AR Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_ADAPTIVE_DIRECT_EXECUTION)
+#include <hpx/naming_base/address.hpp>
+#include <hpx/threading_base/thread_data.hpp>
+#include <hpx/threading_base/thread_num_tss.hpp>
+#include <hpx/timing/high_resolution_clock.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+// Actions finishing in less than this number of nanoseconds are considered
+// for being executed directly on the thread decoding the parcel.
+#if !defined(HPX_ACTION_DIRECT_EXECUTION_THRESHOLD)
+#define HPX_ACTION_DIRECT_EXECUTION_THRESHOLD 2000
+#endif
+
+// The number of consecutive short executions required before an action is
+// executed directly.
+#if !defined(HPX_ACTION_DIRECT_EXECUTION_MIN_SAMPLES)
+#define HPX_ACTION_DIRECT_EXECUTION_MIN_SAMPLES 64
+#endif
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx { namespace actions { namespace detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Execution statistics collected for each action type, used to decide
+    // whether an action received from a remote locality can be executed
+    // directly instead of scheduling a new thread for it.
+    class action_execution_statistics
+    {
+    public:
+        constexpr action_execution_statistics() noexcept
+          : short_executions_(0)
+          , suspended_(false)
+        {
+        }
+
+        // An action is executed directly if it never suspended and if it
+        // consistently finished in less than the threshold.
+        bool select_direct_execution() const noexcept
+        {
+            return !suspended_.load(std::memory_order_relaxed) &&
+                short_executions_.load(std::memory_order_relaxed) >=
+                HPX_ACTION_DIRECT_EXECUTION_MIN_SAMPLES;
+        }
+
+        void record(std::uint64_t duration, bool suspended) noexcept
+        {
+            if (suspended)
+            {
+                // never execute actions directly which may suspend
+                suspended_.store(true, std::memory_order_relaxed);
+                short_executions_.store(0, std::memory_order_relaxed);
+            }
+            else if (duration > HPX_ACTION_DIRECT_EXECUTION_THRESHOLD)
+            {
+                short_executions_.store(0, std::memory_order_relaxed);
+            }
+            else if (short_executions_.load(std::memory_order_relaxed) <
+                HPX_ACTION_DIRECT_EXECUTION_MIN_SAMPLES)
+            {
+                short_executions_.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+
+    private:
+        std::atomic<std::uint32_t> short_executions_;
+        std::atomic<bool> suspended_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Measure the execution of an action and record it in the given
+    // statistics. An action is assumed to have suspended if the phase of the
+    // executing thread has changed or if it continued running on a different
+    // worker thread.
+    class action_execution_scope
+    {
+    public:
+        HPX_NON_COPYABLE(action_execution_scope);
+
+    public:
+        explicit action_execution_scope(
+            action_execution_statistics& stats) noexcept
+          : stats_(stats)
+          , self_(threads::get_self_id_data())
+          , phase_(get_thread_phase())
+          , worker_(hpx::get_worker_thread_num())
+          , start_(hpx::chrono::high_resolution_clock::now())
+        {
+        }
+
+        ~action_execution_scope()
+        {
+            std::uint64_t duration =
+                hpx::chrono::high_resolution_clock::now() - start_;
+            stats_.record(duration,
+                get_thread_phase() != phase_ ||
+                    hpx::get_worker_thread_num() != worker_);
+        }
+
+    private:
+        std::size_t get_thread_phase() const noexcept
+        {
+            return self_ != nullptr ? self_->get_thread_phase() : 0;
+        }
+
+        action_execution_statistics& stats_;
+        threads::thread_data* self_;
+        std::size_t phase_;
+        std::size_t worker_;
+        std::uint64_t start_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Invoke an action and record its execution. This excludes the
+    // continuation, which usually sends the result to a remote locality.
+    template <typename Action>
+    struct measured_action_invoke
+    {
+        naming::address_type lva;
+        naming::component_type comptype;
+
+        template <typename... Ts>
+        HPX_FORCEINLINE typename Action::internal_result_type operator()(
+            Ts&&... vs) const
+        {
+            action_execution_scope scope(Action::get_execution_statistics());
+            return Action::invoke(lva, comptype, std::forward<Ts>(vs)...);
+        }
+    };
+}}}    // namespace hpx::actions::detail
+
+#include <hpx/config/warnings_suffix.hpp>
+
+#endif
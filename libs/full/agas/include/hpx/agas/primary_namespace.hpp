@@ -31,6 +31,10 @@ namespace hpx { namespace agas {
         typedef hpx::tuple<naming::gid_type, gva, naming::gid_type>
             resolved_type;
 
+        // gva, id, locality
+        typedef hpx::tuple<gva, naming::gid_type, naming::gid_type>
+            bind_request_type;
+
         static naming::gid_type get_service_instance(
             std::uint32_t service_locality_id);
 
@@ -66,6 +70,11 @@ namespace hpx { namespace agas {
         future<bool> bind_gid_async(
             gva g, naming::gid_type id, naming::gid_type locality);
 
+        // Bind all given GIDs using a single request, all GIDs have to be
+        // managed by the same service instance.
+        future<std::vector<bool>> bind_gids_async(
+            std::vector<bind_request_type> requests);
+
 #if defined(HPX_HAVE_NETWORKING)
         void route(parcelset::parcel&& p,
             util::function_nonser<void(
@@ -75,6 +84,11 @@ namespace hpx { namespace agas {
         resolved_type resolve_gid(naming::gid_type const& id);
         future<resolved_type> resolve_full(naming::gid_type id);
 
+        // Resolve all given GIDs using a single request, all GIDs have to be
+        // managed by the same service instance.
+        future<std::vector<resolved_type>> resolve_full(
+            std::vector<naming::gid_type> ids);
+
         future<id_type> colocate(naming::gid_type id);
 
         naming::address unbind_gid(
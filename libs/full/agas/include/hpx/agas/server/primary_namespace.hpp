@@ -18,14 +18,17 @@
 #include <hpx/agas/agas_fwd.hpp>
 #include <hpx/agas/gva.hpp>
 #include <hpx/allocator_support/internal_allocator.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
 #include <hpx/datastructures/tuple.hpp>
 #include <hpx/lcos/base_lco_with_value.hpp>
 #include <hpx/naming_base/id_type.hpp>
 #include <hpx/runtime/components/server/fixed_component_base.hpp>
 #include <hpx/synchronization/condition_variable.hpp>
+#include <hpx/synchronization/spinlock.hpp>
 #include <hpx/traits/action_message_handler.hpp>
 #include <hpx/traits/action_serialization_filter.hpp>
 
+#include <array>
 #include <atomic>
 #include <cstddef>
 #include <cstdint>
@@ -127,24 +130,61 @@ namespace hpx { namespace agas { namespace server {
 
         typedef hpx::tuple<naming::gid_type, gva, naming::gid_type>
             resolved_type;
+
+        // gva, id, locality
+        typedef hpx::tuple<gva, naming::gid_type, naming::gid_type>
+            bind_request_type;
         // }}}
 
     private:
-        // REVIEW: Separate mutexes might reduce contention here. This has to be
-        // investigated carefully.
-        mutex_type mutex_;
-
-        gva_table_type gvas_;
-        refcnt_table_type refcnts_;
         typedef std::map<naming::gid_type,
             hpx::tuple<bool, std::size_t,
                 lcos::local::detail::condition_variable>>
             migration_table_type;
 
+        // The tables are partitioned into shards, each guarded by its own
+        // mutex. A GID is assigned to a shard based on its (stripped) MSB
+        // and the block of 2^shard_block_bits consecutive LSBs it belongs
+        // to, consecutive blocks are assigned to consecutive shards. The
+        // reference count and the migration state of a GID are stored in
+        // its shard only. A GVA range is stored in every shard one of the
+        // GIDs it covers is assigned to, which allows to resolve any GID by
+        // looking at its shard only.
+        struct shard_data
+        {
+            mutex_type mutex_;
+            gva_table_type gvas_;
+            refcnt_table_type refcnts_;
+            migration_table_type migrating_objects_;
+        };
+
+        typedef util::cache_aligned_data_derived<shard_data> shard;
+
+        static constexpr std::size_t num_shards = 32;
+        static constexpr std::size_t shard_block_bits = 10;
+
+        static std::size_t get_shard_index(naming::gid_type const& id);
+
+        shard& get_shard(naming::gid_type const& id)
+        {
+            return shards_[get_shard_index(id)];
+        }
+
+        // Return the (sorted) indices of all shards the given range of GIDs
+        // is assigned to.
+        static std::vector<std::size_t> get_shard_indices(
+            naming::gid_type const& id, std::uint64_t count);
+
+        // Lock all shards the given range of GIDs is assigned to, the locks
+        // are acquired in ascending order of the shard indices.
+        std::vector<std::unique_lock<mutex_type>> lock_shards(
+            std::vector<std::size_t> const& indices);
+
+        std::array<shard, num_shards> shards_;
+
         std::string instance_name_;
         naming::gid_type next_id_;     // next available gid
         naming::gid_type locality_;    // our locality id
-        migration_table_type migrating_objects_;
 
         struct update_time_on_exit;
 
@@ -228,20 +268,21 @@ namespace hpx { namespace agas { namespace server {
 #if defined(HPX_HAVE_AGAS_DUMP_REFCNT_ENTRIES)
         /// Dump the credit counts of all matching ranges. Expects that \p l
         /// is locked.
-        void dump_refcnt_matches(refcnt_table_type::iterator lower_it,
+        void dump_refcnt_matches(shard& s, refcnt_table_type::iterator lower_it,
             refcnt_table_type::iterator upper_it, naming::gid_type const& lower,
             naming::gid_type const& upper, std::unique_lock<mutex_type>& l,
             const char* func_name);
 #endif
 
         // helper function
-        void wait_for_migration_locked(std::unique_lock<mutex_type>& l,
-            naming::gid_type const& id, error_code& ec);
+        void wait_for_migration_locked(shard& s,
+            std::unique_lock<mutex_type>& l, naming::gid_type const& id,
+            error_code& ec);
 
     public:
         primary_namespace()
           : base_type(HPX_AGAS_PRIMARY_NS_MSB, HPX_AGAS_PRIMARY_NS_LSB)
-          , mutex_()
+          , shards_()
           , instance_name_()
           , next_id_(naming::invalid_gid)
           , locality_(naming::invalid_gid)
@@ -269,6 +310,11 @@ namespace hpx { namespace agas { namespace server {
         bool bind_gid(gva const& g, naming::gid_type id,
             naming::gid_type const& locality);
 
+        // bind all given GIDs, returns the result of bind_gid for each of
+        // them
+        std::vector<bool> bind_gids(
+            std::vector<bind_request_type> const& requests);
+
         // API
         std::pair<naming::id_type, naming::address> begin_migration(
             naming::gid_type id);
@@ -276,6 +322,11 @@ namespace hpx { namespace agas { namespace server {
 
         resolved_type resolve_gid(naming::gid_type const& id);
 
+        // resolve all given GIDs, returns the result of resolve_gid for each
+        // of them
+        std::vector<resolved_type> resolve_gids(
+            std::vector<naming::gid_type> const& ids);
+
         naming::id_type colocate(naming::gid_type const& id);
 
         naming::address unbind_gid(std::uint64_t count, naming::gid_type id);
@@ -291,8 +342,9 @@ namespace hpx { namespace agas { namespace server {
             std::uint64_t count);
 
     private:
-        resolved_type resolve_gid_locked(std::unique_lock<mutex_type>& l,
-            naming::gid_type const& gid, error_code& ec);
+        resolved_type resolve_gid_locked(shard& s,
+            std::unique_lock<mutex_type>& l, naming::gid_type const& gid,
+            error_code& ec);
 
         void increment(naming::gid_type const& lower,
             naming::gid_type const& upper, std::int64_t& credits,
@@ -318,7 +370,7 @@ namespace hpx { namespace agas { namespace server {
         using free_entry_list_type =
             std::list<free_entry, free_entry_allocator_type>;
 
-        void resolve_free_list(std::unique_lock<mutex_type>& l,
+        void resolve_free_list(shard& s, std::unique_lock<mutex_type>& l,
             std::list<refcnt_table_type::iterator> const& free_list,
             free_entry_list_type& free_entry_list,
             naming::gid_type const& lower, naming::gid_type const& upper,
@@ -335,12 +387,14 @@ namespace hpx { namespace agas { namespace server {
     public:
         HPX_DEFINE_COMPONENT_ACTION(primary_namespace, allocate);
         HPX_DEFINE_COMPONENT_ACTION(primary_namespace, bind_gid);
+        HPX_DEFINE_COMPONENT_ACTION(primary_namespace, bind_gids);
         HPX_DEFINE_COMPONENT_ACTION(primary_namespace, colocate);
         HPX_DEFINE_COMPONENT_ACTION(primary_namespace, begin_migration);
         HPX_DEFINE_COMPONENT_ACTION(primary_namespace, end_migration);
         HPX_DEFINE_COMPONENT_ACTION(primary_namespace, decrement_credit);
         HPX_DEFINE_COMPONENT_ACTION(primary_namespace, increment_credit);
         HPX_DEFINE_COMPONENT_ACTION(primary_namespace, resolve_gid);
+        HPX_DEFINE_COMPONENT_ACTION(primary_namespace, resolve_gids);
         HPX_DEFINE_COMPONENT_ACTION(primary_namespace, unbind_gid);
 #if defined(HPX_HAVE_NETWORKING)
         HPX_DEFINE_COMPONENT_ACTION(primary_namespace, route);
@@ -372,6 +426,13 @@ HPX_REGISTER_ACTION_DECLARATION(
     hpx::agas::server::primary_namespace::bind_gid_action,
     primary_namespace_bind_gid_action)
 
+HPX_ACTION_USES_MEDIUM_STACK(
+    hpx::agas::server::primary_namespace::bind_gids_action)
+
+HPX_REGISTER_ACTION_DECLARATION(
+    hpx::agas::server::primary_namespace::bind_gids_action,
+    primary_namespace_bind_gids_action)
+
 HPX_ACTION_USES_MEDIUM_STACK(
     hpx::agas::server::primary_namespace::begin_migration_action)
 
@@ -386,8 +447,12 @@ HPX_REGISTER_ACTION_DECLARATION(
     hpx::agas::server::primary_namespace::end_migration_action,
     primary_namespace_end_migration_action)
 
+// resolving addresses and managing credits is latency critical, the
+// corresponding parcels are sent through the high priority lane
 HPX_ACTION_USES_MEDIUM_STACK(
     hpx::agas::server::primary_namespace::decrement_credit_action)
+HPX_ACTION_HAS_HIGH_PRIORITY(
+    hpx::agas::server::primary_namespace::decrement_credit_action)
 
 HPX_REGISTER_ACTION_DECLARATION(
     hpx::agas::server::primary_namespace::decrement_credit_action,
@@ -395,6 +460,8 @@ HPX_REGISTER_ACTION_DECLARATION(
 
 HPX_ACTION_USES_MEDIUM_STACK(
     hpx::agas::server::primary_namespace::increment_credit_action)
+HPX_ACTION_HAS_HIGH_PRIORITY(
+    hpx::agas::server::primary_namespace::increment_credit_action)
 
 HPX_REGISTER_ACTION_DECLARATION(
     hpx::agas::server::primary_namespace::increment_credit_action,
@@ -402,11 +469,22 @@ HPX_REGISTER_ACTION_DECLARATION(
 
 HPX_ACTION_USES_MEDIUM_STACK(
     hpx::agas::server::primary_namespace::resolve_gid_action)
+HPX_ACTION_HAS_HIGH_PRIORITY(
+    hpx::agas::server::primary_namespace::resolve_gid_action)
 
 HPX_REGISTER_ACTION_DECLARATION(
     hpx::agas::server::primary_namespace::resolve_gid_action,
     primary_namespace_resolve_gid_action)
 
+HPX_ACTION_USES_MEDIUM_STACK(
+    hpx::agas::server::primary_namespace::resolve_gids_action)
+HPX_ACTION_HAS_HIGH_PRIORITY(
+    hpx::agas::server::primary_namespace::resolve_gids_action)
+
+HPX_REGISTER_ACTION_DECLARATION(
+    hpx::agas::server::primary_namespace::resolve_gids_action,
+    primary_namespace_resolve_gids_action)
+
 HPX_ACTION_USES_MEDIUM_STACK(
     hpx::agas::server::primary_namespace::colocate_action)
 
@@ -434,6 +512,8 @@ HPX_REGISTER_BASE_LCO_WITH_VALUE_DECLARATION(
 typedef hpx::tuple<hpx::naming::gid_type, hpx::agas::gva, hpx::naming::gid_type>
     gva_tuple_type;
 HPX_REGISTER_BASE_LCO_WITH_VALUE_DECLARATION(gva_tuple_type, gva_tuple)
+HPX_REGISTER_BASE_LCO_WITH_VALUE_DECLARATION(
+    std::vector<gva_tuple_type>, vector_gva_tuple)
 typedef std::pair<hpx::naming::id_type, hpx::naming::address>
     std_pair_address_id_type;
 HPX_REGISTER_BASE_LCO_WITH_VALUE_DECLARATION(
@@ -41,6 +41,10 @@ HPX_REGISTER_ACTION_ID(primary_namespace::bind_gid_action,
     primary_namespace_bind_gid_action,
     hpx::actions::primary_namespace_bind_gid_action_id)
 
+HPX_REGISTER_ACTION_ID(primary_namespace::bind_gids_action,
+    primary_namespace_bind_gids_action,
+    hpx::actions::primary_namespace_bind_gids_action_id)
+
 HPX_REGISTER_ACTION_ID(primary_namespace::begin_migration_action,
     primary_namespace_begin_migration_action,
     hpx::actions::primary_namespace_begin_migration_action_id)
@@ -61,6 +65,10 @@ HPX_REGISTER_ACTION_ID(primary_namespace::resolve_gid_action,
     primary_namespace_resolve_gid_action,
     hpx::actions::primary_namespace_resolve_gid_action_id)
 
+HPX_REGISTER_ACTION_ID(primary_namespace::resolve_gids_action,
+    primary_namespace_resolve_gids_action,
+    hpx::actions::primary_namespace_resolve_gids_action_id)
+
 HPX_REGISTER_ACTION_ID(primary_namespace::colocate_action,
     primary_namespace_colocate_action,
     hpx::actions::primary_namespace_colocate_action_id)
@@ -81,6 +89,10 @@ HPX_REGISTER_BASE_LCO_WITH_VALUE_ID(hpx::naming::address, naming_address,
 HPX_REGISTER_BASE_LCO_WITH_VALUE_ID(gva_tuple_type, gva_tuple,
     hpx::actions::base_lco_with_value_gva_tuple_get,
     hpx::actions::base_lco_with_value_gva_tuple_set)
+HPX_REGISTER_BASE_LCO_WITH_VALUE_ID(std::vector<gva_tuple_type>,
+    vector_gva_tuple,
+    hpx::actions::base_lco_with_value_vector_gva_tuple_get,
+    hpx::actions::base_lco_with_value_vector_gva_tuple_set)
 HPX_REGISTER_BASE_LCO_WITH_VALUE_ID(std_pair_address_id_type,
     std_pair_address_id_type,
     hpx::actions::base_lco_with_value_std_pair_address_id_type_get,
@@ -206,6 +218,28 @@ namespace hpx { namespace agas {
 #endif
     }
 
+    future<std::vector<bool>> primary_namespace::bind_gids_async(
+        std::vector<bind_request_type> requests)
+    {
+        HPX_ASSERT(!requests.empty());
+
+        naming::id_type dest = naming::id_type(
+            get_service_instance(hpx::get<1>(requests.front())),
+            naming::id_type::unmanaged);
+        if (naming::get_locality_from_gid(dest.get_gid()) ==
+            hpx::get_locality())
+        {
+            return hpx::make_ready_future(server_->bind_gids(requests));
+        }
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+        server::primary_namespace::bind_gids_action action;
+        return hpx::async(action, std::move(dest), std::move(requests));
+#else
+        HPX_ASSERT(false);
+        return hpx::make_ready_future(std::vector<bool>{});
+#endif
+    }
+
 #if defined(HPX_HAVE_NETWORKING)
     void primary_namespace::route(parcelset::parcel&& p,
         util::function_nonser<void(
@@ -258,6 +292,28 @@ namespace hpx { namespace agas {
 #endif
     }
 
+    future<std::vector<primary_namespace::resolved_type>>
+    primary_namespace::resolve_full(std::vector<naming::gid_type> ids)
+    {
+        HPX_ASSERT(!ids.empty());
+
+        naming::id_type dest = naming::id_type(
+            get_service_instance(ids.front()), naming::id_type::unmanaged);
+        if (naming::get_locality_from_gid(dest.get_gid()) ==
+            hpx::get_locality())
+        {
+            return hpx::make_ready_future(server_->resolve_gids(ids));
+        }
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+        server::primary_namespace::resolve_gids_action action;
+        return hpx::async(action, std::move(dest), std::move(ids));
+#else
+        HPX_ASSERT(false);
+        return hpx::make_ready_future(
+            std::vector<primary_namespace::resolved_type>{});
+#endif
+    }
+
     hpx::future<id_type> primary_namespace::colocate(naming::gid_type id)
     {
         naming::id_type dest = naming::id_type(
@@ -28,6 +28,7 @@
 #include <hpx/util/get_and_reset_value.hpp>
 #include <hpx/util/insert_checked.hpp>
 
+#include <algorithm>
 #include <atomic>
 #include <cstddef>
 #include <cstdint>
@@ -121,6 +122,58 @@ namespace hpx { namespace agas { namespace server {
     }
 #endif
 
+    ///////////////////////////////////////////////////////////////////////////
+    std::size_t primary_namespace::get_shard_index(naming::gid_type const& id)
+    {
+        std::uint64_t msb =
+            naming::detail::strip_internal_bits_from_gid(id.get_msb());
+        std::uint64_t block = id.get_lsb() >> shard_block_bits;
+        return static_cast<std::size_t>((msb ^ (msb >> 32)) + block) %
+            num_shards;
+    }
+
+    std::vector<std::size_t> primary_namespace::get_shard_indices(
+        naming::gid_type const& id, std::uint64_t count)
+    {
+        std::vector<std::size_t> indices;
+
+        naming::gid_type last(id + (count != 0 ? count - 1 : 0));
+
+        std::uint64_t num_blocks = num_shards;
+        if (last.get_msb() == id.get_msb())
+        {
+            num_blocks = (last.get_lsb() >> shard_block_bits) -
+                (id.get_lsb() >> shard_block_bits) + 1;
+        }
+
+        if (num_blocks >= num_shards)
+        {
+            indices.reserve(num_shards);
+            for (std::size_t i = 0; i != num_shards; ++i)
+                indices.push_back(i);
+            return indices;
+        }
+
+        // consecutive blocks are assigned to consecutive shards
+        std::size_t first = get_shard_index(id);
+        indices.reserve(num_blocks);
+        for (std::size_t i = 0; i != num_blocks; ++i)
+            indices.push_back((first + i) % num_shards);
+
+        std::sort(indices.begin(), indices.end());
+        return indices;
+    }
+
+    std::vector<std::unique_lock<primary_namespace::mutex_type>>
+    primary_namespace::lock_shards(std::vector<std::size_t> const& indices)
+    {
+        std::vector<std::unique_lock<mutex_type>> locks;
+        locks.reserve(indices.size());
+        for (std::size_t i : indices)
+            locks.emplace_back(shards_[i].mutex_);
+        return locks;
+    }
+
     // start migration of the given object
     std::pair<naming::id_type, naming::address>
     primary_namespace::begin_migration(naming::gid_type id)
@@ -131,10 +184,11 @@ namespace hpx { namespace agas { namespace server {
         counter_data_.increment_begin_migration_count();
         using hpx::get;
 
-        std::unique_lock<mutex_type> l(mutex_);
+        shard& s = get_shard(id);
+        std::unique_lock<mutex_type> l(s.mutex_);
 
-        wait_for_migration_locked(l, id, hpx::throws);
-        resolved_type r = resolve_gid_locked(l, id, hpx::throws);
+        wait_for_migration_locked(s, l, id, hpx::throws);
+        resolved_type r = resolve_gid_locked(s, l, id, hpx::throws);
         if (get<0>(r) == naming::invalid_gid)
         {
             l.unlock();
@@ -147,11 +201,11 @@ namespace hpx { namespace agas { namespace server {
             return std::make_pair(naming::invalid_id, naming::address());
         }
 
-        migration_table_type::iterator it = migrating_objects_.find(id);
-        if (it == migrating_objects_.end())
+        migration_table_type::iterator it = s.migrating_objects_.find(id);
+        if (it == s.migrating_objects_.end())
         {
             std::pair<migration_table_type::iterator, bool> p =
-                migrating_objects_.emplace(std::piecewise_construct,
+                s.migrating_objects_.emplace(std::piecewise_construct,
                     std::forward_as_tuple(id), std::forward_as_tuple());
             HPX_ASSERT(p.second);
             it = p.first;
@@ -178,12 +232,13 @@ namespace hpx { namespace agas { namespace server {
             counter_data_.end_migration_.enabled_);
         counter_data_.increment_end_migration_count();
 
-        std::unique_lock<mutex_type> l(mutex_);
+        shard& s = get_shard(id);
+        std::unique_lock<mutex_type> l(s.mutex_);
 
         using hpx::get;
 
-        migration_table_type::iterator it = migrating_objects_.find(id);
-        if (it != migrating_objects_.end())
+        migration_table_type::iterator it = s.migrating_objects_.find(id);
+        if (it != s.migrating_objects_.end())
         {
             // flag this id as not being migrated anymore
             get<0>(it->second) = false;
@@ -193,7 +248,7 @@ namespace hpx { namespace agas { namespace server {
             }
             else
             {
-                migrating_objects_.erase(it);
+                s.migrating_objects_.erase(it);
             }
         }
 
@@ -201,7 +256,7 @@ namespace hpx { namespace agas { namespace server {
     }
 
     // wait if given object is currently being migrated
-    void primary_namespace::wait_for_migration_locked(
+    void primary_namespace::wait_for_migration_locked(shard& s,
         std::unique_lock<mutex_type>& l, naming::gid_type const& id,
         error_code& ec)
     {
@@ -209,8 +264,8 @@ namespace hpx { namespace agas { namespace server {
 
         using hpx::get;
 
-        migration_table_type::iterator it = migrating_objects_.find(id);
-        if (it != migrating_objects_.end())
+        migration_table_type::iterator it = s.migrating_objects_.find(id);
+        if (it != s.migrating_objects_.end())
         {
             if (get<0>(it->second))
             {
@@ -219,13 +274,13 @@ namespace hpx { namespace agas { namespace server {
                 get<2>(it->second).wait(l, ec);
 
                 if (--get<1>(it->second) == 0)
-                    migrating_objects_.erase(it);
+                    s.migrating_objects_.erase(it);
             }
             else
             {
                 if (get<1>(it->second) == 0)
                 {
-                    migrating_objects_.erase(it);
+                    s.migrating_objects_.erase(it);
                 }
             }
         }
@@ -242,10 +297,14 @@ namespace hpx { namespace agas { namespace server {
         naming::gid_type gid = id;
         naming::detail::strip_internal_bits_from_gid(id);
 
-        std::unique_lock<mutex_type> l(mutex_);
+        // lock all shards the range is (or will be) stored in, any existing
+        // range covering the new id is stored in the shard of the id as well
+        std::vector<std::size_t> indices = get_shard_indices(id, g.count);
+        std::vector<std::unique_lock<mutex_type>> locks = lock_shards(indices);
 
-        gva_table_type::iterator it = gvas_.lower_bound(id),
-                                 begin = gvas_.begin(), end = gvas_.end();
+        gva_table_type& gvas = get_shard(id).gvas_;
+        gva_table_type::iterator it = gvas.lower_bound(id),
+                                 begin = gvas.begin(), end = gvas.end();
 
         if (it != end)
         {
@@ -257,7 +316,7 @@ namespace hpx { namespace agas { namespace server {
                 if (naming::refers_to_local_lva(gid) &&
                     !naming::refers_to_virtual_memory(gid))
                 {
-                    l.unlock();
+                    locks.clear();
 
                     HPX_THROW_EXCEPTION(bad_parameter,
                         "primary_namespace::bind_gid",
@@ -266,15 +325,14 @@ namespace hpx { namespace agas { namespace server {
                     return false;
                 }
 
-                gva& gaddr = it->second.first;
-                naming::gid_type& loc = it->second.second;
+                gva const& gaddr = it->second.first;
 
                 // Check for count mismatch (we can't change block sizes of
                 // existing bindings).
                 if (HPX_UNLIKELY(gaddr.count != g.count))
                 {
                     // REVIEW: Is this the right error code to use?
-                    l.unlock();
+                    locks.clear();
 
                     HPX_THROW_EXCEPTION(bad_parameter,
                         "primary_namespace::bind_gid",
@@ -283,7 +341,7 @@ namespace hpx { namespace agas { namespace server {
 
                 if (HPX_UNLIKELY(components::component_invalid == g.type))
                 {
-                    l.unlock();
+                    locks.clear();
 
                     HPX_THROW_EXCEPTION(bad_parameter,
                         "primary_namespace::bind_gid",
@@ -295,7 +353,7 @@ namespace hpx { namespace agas { namespace server {
 
                 if (HPX_UNLIKELY(!locality))
                 {
-                    l.unlock();
+                    locks.clear();
 
                     HPX_THROW_EXCEPTION(bad_parameter,
                         "primary_namespace::bind_gid",
@@ -306,14 +364,21 @@ namespace hpx { namespace agas { namespace server {
                             id, g, locality));
                 }
 
-                // Store the new endpoint and offset
-                gaddr.prefix = g.prefix;
-                gaddr.type = g.type;
-                gaddr.lva(g.lva());
-                gaddr.offset = g.offset;
-                loc = locality;
+                // Store the new endpoint and offset in all shards
+                for (std::size_t i : indices)
+                {
+                    gva_table_type::iterator entry = shards_[i].gvas_.find(id);
+                    HPX_ASSERT(entry != shards_[i].gvas_.end());
+
+                    gva& entry_gaddr = entry->second.first;
+                    entry_gaddr.prefix = g.prefix;
+                    entry_gaddr.type = g.type;
+                    entry_gaddr.lva(g.lva());
+                    entry_gaddr.offset = g.offset;
+                    entry->second.second = locality;
+                }
 
-                l.unlock();
+                locks.clear();
 
                 LAGAS_(info) << hpx::util::format(
                     "primary_namespace::bind_gid, gid({1}), gva({2}), "
@@ -333,7 +398,7 @@ namespace hpx { namespace agas { namespace server {
                 if (HPX_UNLIKELY((it->first + it->second.first.count) > id))
                 {
                     // REVIEW: Is this the right error code to use?
-                    l.unlock();
+                    locks.clear();
 
                     HPX_THROW_EXCEPTION(bad_parameter,
                         "primary_namespace::bind_gid",
@@ -342,7 +407,7 @@ namespace hpx { namespace agas { namespace server {
             }
         }
 
-        else if (HPX_LIKELY(!gvas_.empty()))
+        else if (HPX_LIKELY(!gvas.empty()))
         {
             --it;
 
@@ -350,7 +415,7 @@ namespace hpx { namespace agas { namespace server {
             if ((it->first + it->second.first.count) > id)
             {
                 // REVIEW: Is this the right error code to use?
-                l.unlock();
+                locks.clear();
 
                 HPX_THROW_EXCEPTION(bad_parameter,
                     "primary_namespace::bind_gid",
@@ -374,7 +439,7 @@ namespace hpx { namespace agas { namespace server {
 
         if (HPX_UNLIKELY(id.get_msb() != upper_bound.get_msb()))
         {
-            l.unlock();
+            locks.clear();
 
             HPX_THROW_EXCEPTION(internal_server_error,
                 "primary_namespace::bind_gid",
@@ -383,7 +448,7 @@ namespace hpx { namespace agas { namespace server {
 
         if (HPX_UNLIKELY(components::component_invalid == g.type))
         {
-            l.unlock();
+            locks.clear();
 
             HPX_THROW_EXCEPTION(bad_parameter, "primary_namespace::bind_gid",
                 hpx::util::format(
@@ -392,20 +457,23 @@ namespace hpx { namespace agas { namespace server {
                     id, g, locality));
         }
 
-        // Insert a GID -> GVA entry into the GVA table.
-        if (HPX_UNLIKELY(!util::insert_checked(
-                gvas_.insert(std::make_pair(id, std::make_pair(g, locality))))))
+        // Insert a GID -> GVA entry into the GVA table of all shards.
+        for (std::size_t i : indices)
         {
-            l.unlock();
+            if (HPX_UNLIKELY(!util::insert_checked(shards_[i].gvas_.insert(
+                    std::make_pair(id, std::make_pair(g, locality))))))
+            {
+                locks.clear();
 
-            HPX_THROW_EXCEPTION(lock_error, "primary_namespace::bind_gid",
-                hpx::util::format(
-                    "GVA table insertion failed due to a locking error or "
-                    "memory corruption, gid({1}), gva({2}), locality({3})",
-                    id, g, locality));
+                HPX_THROW_EXCEPTION(lock_error, "primary_namespace::bind_gid",
+                    hpx::util::format(
+                        "GVA table insertion failed due to a locking error or "
+                        "memory corruption, gid({1}), gva({2}), locality({3})",
+                        id, g, locality));
+            }
         }
 
-        l.unlock();
+        locks.clear();
 
         LAGAS_(info) << hpx::util::format(
             "primary_namespace::bind_gid, gid({1}), gva({2}), "
@@ -415,6 +483,21 @@ namespace hpx { namespace agas { namespace server {
         return true;
     }    // }}}
 
+    std::vector<bool> primary_namespace::bind_gids(
+        std::vector<bind_request_type> const& requests)
+    {
+        std::vector<bool> results;
+        results.reserve(requests.size());
+
+        for (bind_request_type const& req : requests)
+        {
+            results.push_back(bind_gid(
+                hpx::get<0>(req), hpx::get<1>(req), hpx::get<2>(req)));
+        }
+
+        return results;
+    }
+
     primary_namespace::resolved_type primary_namespace::resolve_gid(
         naming::gid_type const& id)
     {    // {{{ resolve_gid implementation
@@ -427,16 +510,17 @@ namespace hpx { namespace agas { namespace server {
         resolved_type r;
 
         {
-            std::unique_lock<mutex_type> l(mutex_);
+            shard& s = get_shard(id);
+            std::unique_lock<mutex_type> l(s.mutex_);
 
             // wait for any migration to be completed
             if (naming::detail::is_migratable(id))
             {
-                wait_for_migration_locked(l, id, hpx::throws);
+                wait_for_migration_locked(s, l, id, hpx::throws);
             }
 
             // now, resolve the id
-            r = resolve_gid_locked(l, id, hpx::throws);
+            r = resolve_gid_locked(s, l, id, hpx::throws);
         }
 
         if (get<0>(r) == naming::invalid_gid)
@@ -457,6 +541,20 @@ namespace hpx { namespace agas { namespace server {
         return r;
     }    // }}}
 
+    std::vector<primary_namespace::resolved_type>
+    primary_namespace::resolve_gids(std::vector<naming::gid_type> const& ids)
+    {
+        std::vector<resolved_type> results;
+        results.reserve(ids.size());
+
+        for (naming::gid_type const& id : ids)
+        {
+            results.push_back(resolve_gid(id));
+        }
+
+        return results;
+    }
+
     naming::id_type primary_namespace::colocate(naming::gid_type const& id)
     {
         return naming::id_type(
@@ -473,15 +571,17 @@ namespace hpx { namespace agas { namespace server {
 
         naming::detail::strip_internal_bits_from_gid(id);
 
-        std::unique_lock<mutex_type> l(mutex_);
+        std::vector<std::size_t> indices = get_shard_indices(id, count);
+        std::vector<std::unique_lock<mutex_type>> locks = lock_shards(indices);
 
-        gva_table_type::iterator it = gvas_.find(id), end = gvas_.end();
+        gva_table_type& gvas = get_shard(id).gvas_;
+        gva_table_type::iterator it = gvas.find(id), end = gvas.end();
 
         if (it != end)
         {
             if (HPX_UNLIKELY(it->second.first.count != count))
             {
-                l.unlock();
+                locks.clear();
 
                 HPX_THROW_EXCEPTION(bad_parameter,
                     "primary_namespace::unbind_gid", "block sizes must match");
@@ -489,9 +589,13 @@ namespace hpx { namespace agas { namespace server {
 
             gva_table_data_type data = it->second;
 
-            gvas_.erase(it);
+            // remove the entry from all shards it is stored in
+            for (std::size_t i : indices)
+            {
+                shards_[i].gvas_.erase(id);
+            }
 
-            l.unlock();
+            locks.clear();
             LAGAS_(info) << hpx::util::format("primary_namespace::unbind_gid, "
                                               "gid({1}), count({2}), gva({3}), "
                                               "locality_id({4})",
@@ -518,7 +622,7 @@ namespace hpx { namespace agas { namespace server {
             return naming::address(g.prefix, g.type, g.lva());
         }
 
-        l.unlock();
+        locks.clear();
 
         LAGAS_(info) << hpx::util::format(
             "primary_namespace::unbind_gid, gid({1}), count({2}), "
@@ -573,15 +677,15 @@ namespace hpx { namespace agas { namespace server {
 
         for (auto& req : requests)
         {
+            // the upper bound of the range of GIDs is inclusive
             std::int64_t credits = hpx::get<0>(req);
             naming::gid_type lower = hpx::get<1>(req);
-            naming::gid_type upper = hpx::get<1>(req);
+            naming::gid_type upper = hpx::get<2>(req);
 
             naming::detail::strip_internal_bits_from_gid(lower);
             naming::detail::strip_internal_bits_from_gid(upper);
 
-            if (lower == upper)
-                ++upper;
+            ++upper;
 
             // Decrement.
             if (credits < 0)
@@ -667,7 +771,7 @@ namespace hpx { namespace agas { namespace server {
     }    // }}}
 
 #if defined(HPX_HAVE_AGAS_DUMP_REFCNT_ENTRIES)
-    void primary_namespace::dump_refcnt_matches(
+    void primary_namespace::dump_refcnt_matches(shard& s,
         refcnt_table_type::iterator lower_it,
         refcnt_table_type::iterator upper_it, naming::gid_type const& lower,
         naming::gid_type const& upper, std::unique_lock<mutex_type>& l,
@@ -675,7 +779,7 @@ namespace hpx { namespace agas { namespace server {
     {    // dump_refcnt_matches implementation
         HPX_ASSERT(l.owns_lock());
 
-        if (lower_it == refcnts_.end() && upper_it == refcnts_.end())
+        if (lower_it == s.refcnts_.end() && upper_it == s.refcnts_.end())
             // We got nothing, bail - our caller is probably about to throw.
             return;
 
@@ -701,7 +805,8 @@ namespace hpx { namespace agas { namespace server {
     void primary_namespace::increment(naming::gid_type const& lower,
         naming::gid_type const& upper, std::int64_t& credits, error_code& ec)
     {    // {{{ increment implementation
-        std::unique_lock<mutex_type> l(mutex_);
+        shard* s = &get_shard(lower);
+        std::unique_lock<mutex_type> l(s->mutex_);
 
 #if defined(HPX_HAVE_AGAS_DUMP_REFCNT_ENTRIES)
         if (LAGAS_ENABLED(debug))
@@ -709,11 +814,11 @@ namespace hpx { namespace agas { namespace server {
             typedef refcnt_table_type::iterator iterator;
 
             // Find the mappings that we're about to touch.
-            refcnt_table_type::iterator lower_it = refcnts_.find(lower);
+            refcnt_table_type::iterator lower_it = s->refcnts_.find(lower);
             refcnt_table_type::iterator upper_it;
             if (lower != upper)
             {
-                upper_it = refcnts_.find(upper);
+                upper_it = s->refcnts_.find(upper);
             }
             else
             {
@@ -721,7 +826,7 @@ namespace hpx { namespace agas { namespace server {
                 ++upper_it;
             }
 
-            dump_refcnt_matches(lower_it, upper_it, lower, upper, l,
+            dump_refcnt_matches(*s, lower_it, upper_it, lower, upper, l,
                 "primary_namespace::increment");
         }
 #endif
@@ -738,14 +843,24 @@ namespace hpx { namespace agas { namespace server {
 
         for (naming::gid_type raw = lower; raw != upper; ++raw)
         {
-            refcnt_table_type::iterator it = refcnts_.find(raw);
-            if (it == refcnts_.end())
+            // the reference count is stored in the shard of the GID
+            shard& current = get_shard(raw);
+            if (&current != s)
+            {
+                l.unlock();
+                s = &current;
+                l = std::unique_lock<mutex_type>(s->mutex_);
+            }
+
+            refcnt_table_type::iterator it = s->refcnts_.find(raw);
+            if (it == s->refcnts_.end())
             {
                 std::int64_t count =
                     std::int64_t(HPX_GLOBALCREDIT_INITIAL) + credits;
 
                 std::pair<refcnt_table_type::iterator, bool> p =
-                    refcnts_.insert(refcnt_table_type::value_type(raw, count));
+                    s->refcnts_.insert(
+                        refcnt_table_type::value_type(raw, count));
                 if (!p.second)
                 {
                     l.unlock();
@@ -776,7 +891,8 @@ namespace hpx { namespace agas { namespace server {
     }    // }}}
 
     ///////////////////////////////////////////////////////////////////////////////
-    void primary_namespace::resolve_free_list(std::unique_lock<mutex_type>& l,
+    void primary_namespace::resolve_free_list(shard& s,
+        std::unique_lock<mutex_type>& l,
         std::list<refcnt_table_type::iterator> const& free_list,
         free_entry_list_type& free_entry_list,
         naming::gid_type const& /* lower */,
@@ -798,11 +914,11 @@ namespace hpx { namespace agas { namespace server {
             if (naming::detail::is_migratable(gid))
             {
                 // wait for any migration to be completed
-                wait_for_migration_locked(l, gid, ec);
+                wait_for_migration_locked(s, l, gid, ec);
             }
 
             // Resolve the query GID.
-            resolved_type r = resolve_gid_locked(l, gid, ec);
+            resolved_type r = resolve_gid_locked(s, l, gid, ec);
             if (ec)
                 return;
 
@@ -862,7 +978,7 @@ namespace hpx { namespace agas { namespace server {
             free_entry_list.push_back(free_entry(resolved, gid, get<2>(r)));
 
             // remove this entry from the refcnt table
-            refcnts_.erase(it);
+            s.refcnts_.erase(it);
         }
     }
 
@@ -879,7 +995,8 @@ namespace hpx { namespace agas { namespace server {
         free_entry_list.clear();
 
         {
-            std::unique_lock<mutex_type> l(mutex_);
+            shard* s = &get_shard(lower);
+            std::unique_lock<mutex_type> l(s->mutex_);
 
 #if defined(HPX_HAVE_AGAS_DUMP_REFCNT_ENTRIES)
             if (LAGAS_ENABLED(debug))
@@ -887,11 +1004,11 @@ namespace hpx { namespace agas { namespace server {
                 typedef refcnt_table_type::iterator iterator;
 
                 // Find the mappings that we just added or modified.
-                refcnt_table_type::iterator lower_it = refcnts_.find(lower);
+                refcnt_table_type::iterator lower_it = s->refcnts_.find(lower);
                 refcnt_table_type::iterator upper_it;
                 if (lower != upper)
                 {
-                    upper_it = refcnts_.find(upper);
+                    upper_it = s->refcnts_.find(upper);
                 }
                 else
                 {
@@ -899,7 +1016,7 @@ namespace hpx { namespace agas { namespace server {
                     ++upper_it;
                 }
 
-                dump_refcnt_matches(lower_it, upper_it, lower, upper, l,
+                dump_refcnt_matches(*s, lower_it, upper_it, lower, upper, l,
                     "primary_namespace::decrement_sweep");
             }
 #endif
@@ -916,8 +1033,26 @@ namespace hpx { namespace agas { namespace server {
             std::list<refcnt_table_type::iterator> free_list;
             for (naming::gid_type raw = lower; raw != upper; ++raw)
             {
-                refcnt_table_type::iterator it = refcnts_.find(raw);
-                if (it == refcnts_.end())
+                // the reference count is stored in the shard of the GID,
+                // resolve the objects of the previous shard which have to
+                // be deleted before moving on
+                shard& current = get_shard(raw);
+                if (&current != s)
+                {
+                    resolve_free_list(
+                        *s, l, free_list, free_entry_list, lower, upper, ec);
+                    if (ec)
+                        return;
+
+                    free_list.clear();
+
+                    l.unlock();
+                    s = &current;
+                    l = std::unique_lock<mutex_type>(s->mutex_);
+                }
+
+                refcnt_table_type::iterator it = s->refcnts_.find(raw);
+                if (it == s->refcnts_.end())
                 {
                     if (credits > std::int64_t(HPX_GLOBALCREDIT_INITIAL))
                     {
@@ -938,7 +1073,7 @@ namespace hpx { namespace agas { namespace server {
                         std::int64_t(HPX_GLOBALCREDIT_INITIAL) - credits;
 
                     std::pair<refcnt_table_type::iterator, bool> p =
-                        refcnts_.insert(
+                        s->refcnts_.insert(
                             refcnt_table_type::value_type(raw, count));
                     if (!p.second)
                     {
@@ -980,7 +1115,8 @@ namespace hpx { namespace agas { namespace server {
             }
 
             // Resolve the objects which have to be deleted.
-            resolve_free_list(l, free_list, free_entry_list, lower, upper, ec);
+            resolve_free_list(
+                *s, l, free_list, free_entry_list, lower, upper, ec);
 
         }    // Unlock the mutex.
 
@@ -1048,7 +1184,7 @@ namespace hpx { namespace agas { namespace server {
     }    // }}}
 
     primary_namespace::resolved_type primary_namespace::resolve_gid_locked(
-        std::unique_lock<mutex_type>& l, naming::gid_type const& gid,
+        shard& s, std::unique_lock<mutex_type>& l, naming::gid_type const& gid,
         error_code& ec)
     {    // {{{ resolve_gid_locked implementation
         HPX_ASSERT_OWNS_LOCK(l);
@@ -1068,8 +1204,10 @@ namespace hpx { namespace agas { namespace server {
         naming::gid_type id = gid;
         naming::detail::strip_internal_bits_from_gid(id);
 
-        gva_table_type::const_iterator it = gvas_.lower_bound(id),
-                                       begin = gvas_.begin(), end = gvas_.end();
+        // any range covering the id is stored in the shard of the id
+        gva_table_type const& gvas = s.gvas_;
+        gva_table_type::const_iterator it = gvas.lower_bound(id),
+                                       begin = gvas.begin(), end = gvas.end();
 
         if (it != end)
         {
@@ -1113,7 +1251,7 @@ namespace hpx { namespace agas { namespace server {
             }
         }
 
-        else if (HPX_LIKELY(!gvas_.empty()))
+        else if (HPX_LIKELY(!gvas.empty()))
         {
             --it;
 
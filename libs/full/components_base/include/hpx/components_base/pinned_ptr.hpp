@@ -59,6 +59,13 @@ namespace hpx { namespace components {
                 pin();
             }
 
+            // take over the pin already held on the referenced object
+            pinned_ptr(naming::address_type lva, std::false_type) noexcept
+              : pinned_ptr_base(lva)
+            {
+                HPX_ASSERT(0 != this->lva_);
+            }
+
             ~pinned_ptr()
             {
                 unpin();
@@ -103,6 +110,11 @@ namespace hpx { namespace components {
             {
                 return pinned_ptr{};
             }
+
+            static pinned_ptr call_pinned(naming::address_type)
+            {
+                return pinned_ptr{};
+            }
         };
 
         // created pinned_ptr actually pins object it refers to
@@ -115,6 +127,11 @@ namespace hpx { namespace components {
             {
                 return pinned_ptr(lva, id<Component>{});
             }
+
+            static pinned_ptr call_pinned(naming::address_type lva)
+            {
+                return pinned_ptr(lva, id<Component>{}, std::false_type{});
+            }
         };
 
         template <typename Component>
@@ -123,6 +140,12 @@ namespace hpx { namespace components {
         {
         }
 
+        template <typename Component>
+        pinned_ptr(naming::address_type lva, id<Component>, std::false_type)
+          : data_(new detail::pinned_ptr<Component>(lva, std::false_type{}))
+        {
+        }
+
     public:
         pinned_ptr() = default;
 
@@ -139,6 +162,15 @@ namespace hpx { namespace components {
             return create_helper<component_type>::call(lva);
         }
 
+        // create a pinned_ptr for an object which was pinned already, the
+        // returned pinned_ptr releases that pin
+        template <typename Component>
+        static pinned_ptr create_pinned(naming::address_type lva)
+        {
+            using component_type = typename std::remove_cv<Component>::type;
+            return create_helper<component_type>::call_pinned(lva);
+        }
+
     private:
         std::unique_ptr<detail::pinned_ptr_base> data_;
     };
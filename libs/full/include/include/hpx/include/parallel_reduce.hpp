@@ -10,6 +10,7 @@
 #include <hpx/config.hpp>
 #include <hpx/parallel/algorithms/reduce.hpp>
 #include <hpx/parallel/algorithms/reduce_by_key.hpp>
+#include <hpx/parallel/algorithms/reduce_by_key_unsorted.hpp>
 #include <hpx/parallel/container_algorithms/reduce.hpp>
 
 #if defined(HPX_HAVE_DISTRIBUTED_RUNTIME)
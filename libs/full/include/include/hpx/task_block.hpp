@@ -13,4 +13,5 @@ namespace hpx {
     using hpx::parallel::define_task_block;
     using hpx::parallel::define_task_block_restore_thread;
     using hpx::parallel::task_block;
+    using hpx::parallel::task_block_mode;
 }    // namespace hpx
@@ -0,0 +1,129 @@
+//  Copyright (c) 2020 STE||AR Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/execution/executors/adaptive_chunk_size.hpp>
+#include <hpx/functional/bind_front.hpp>
+#include <hpx/functional/function.hpp>
+#include <hpx/performance_counters/counter_creators.hpp>
+#include <hpx/performance_counters/counters.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace performance_counters { namespace detail {
+    ///////////////////////////////////////////////////////////////////////////
+    using adaptive_chunk_size_value_type = std::int64_t
+        hpx::execution::detail::adaptive_chunk_size_statistics::*;
+
+    // Extract the requested value learned for the given tag and call site
+    static std::int64_t get_adaptive_chunk_size_value(std::string const& tag,
+        std::size_t site, adaptive_chunk_size_value_type value,
+        bool /* reset */)
+    {
+        hpx::execution::detail::adaptive_chunk_size_statistics stats;
+        if (!hpx::execution::detail::get_adaptive_chunk_size_statistics(
+                tag, site, stats))
+        {
+            return 0;
+        }
+        return stats.*value;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Creation function for adaptive chunk size counters
+    naming::gid_type adaptive_chunk_size_counter_creator(
+        counter_info const& info, error_code& ec)
+    {
+        switch (info.type_)
+        {
+        case counter_raw:
+        {
+            counter_path_elements paths;
+            get_counter_path_elements(info.fullname_, paths, ec);
+            if (ec)
+                return naming::invalid_gid;
+
+            if (paths.parentinstance_is_basename_)
+            {
+                HPX_THROWS_IF(ec, bad_parameter,
+                    "adaptive_chunk_size_counter_creator",
+                    "invalid adaptive chunk size counter name (instance name "
+                    "must not be a valid base counter name)");
+                return naming::invalid_gid;
+            }
+
+            using hpx::execution::detail::adaptive_chunk_size_statistics;
+
+            adaptive_chunk_size_value_type value = nullptr;
+            if (paths.countername_ == "adaptive-chunk-size/chunk-size")
+            {
+                value = &adaptive_chunk_size_statistics::chunk_size;
+            }
+            else if (paths.countername_ == "adaptive-chunk-size/cores")
+            {
+                value = &adaptive_chunk_size_statistics::cores;
+            }
+            else if (paths.countername_ ==
+                "adaptive-chunk-size/time-per-iteration")
+            {
+                value = &adaptive_chunk_size_statistics::time_per_iteration;
+            }
+            else if (paths.countername_ ==
+                "adaptive-chunk-size/parallel-overhead")
+            {
+                value = &adaptive_chunk_size_statistics::parallel_overhead;
+            }
+            else if (paths.countername_ == "adaptive-chunk-size/invocations")
+            {
+                value = &adaptive_chunk_size_statistics::invocations;
+            }
+            else if (paths.countername_ == "adaptive-chunk-size/sites")
+            {
+                value = &adaptive_chunk_size_statistics::sites;
+            }
+            else
+            {
+                HPX_THROWS_IF(ec, bad_parameter,
+                    "adaptive_chunk_size_counter_creator",
+                    "invalid adaptive chunk size counter name: " +
+                        paths.countername_);
+                return naming::invalid_gid;
+            }
+
+            // the counter parameter is the tag of the adaptive_chunk_size
+            // executor parameters object (empty by default), optionally
+            // followed by '#<n>' to select the n-th call site using this tag
+            std::string tag = paths.parameters_;
+            std::size_t site = std::size_t(-1);
+
+            std::string::size_type p = tag.rfind('#');
+            if (p != std::string::npos && p + 1 != tag.size() &&
+                tag.find_first_not_of("0123456789", p + 1) ==
+                    std::string::npos)
+            {
+                site = std::stoul(tag.substr(p + 1));
+                tag.erase(p);
+            }
+
+            hpx::util::function_nonser<std::int64_t(bool)> f =
+                util::bind_front(&get_adaptive_chunk_size_value,
+                    std::move(tag), site, value);
+            return create_raw_counter(info, std::move(f), ec);
+        }
+        break;
+
+        default:
+            HPX_THROWS_IF(ec, bad_parameter,
+                "adaptive_chunk_size_counter_creator",
+                "invalid counter type requested");
+            return naming::invalid_gid;
+        }
+    }
+}}}    // namespace hpx::performance_counters::detail
@@ -88,6 +88,10 @@ namespace hpx { namespace util {
 
         std::size_t get_agas_max_pending_refcnt_requests() const;
 
+        // Get the maximum time (in microseconds) reference counting requests
+        // are buffered before being sent to AGAS
+        std::int64_t get_agas_max_pending_refcnt_delay() const;
+
         // Load application specific configuration and merge it with the
         // default configuration loaded from hpx.ini
         bool load_application_configuration(
@@ -313,6 +313,9 @@ namespace hpx { namespace util {
             "${HPX_AGAS_MAX_PENDING_REFCNT_REQUESTS:" HPX_PP_STRINGIZE(
                 HPX_PP_EXPAND(
                     HPX_INITIAL_AGAS_MAX_PENDING_REFCNT_REQUESTS)) "}",
+            "max_pending_refcnt_delay = "
+            "${HPX_AGAS_MAX_PENDING_REFCNT_DELAY:" HPX_PP_STRINGIZE(
+                HPX_PP_EXPAND(HPX_INITIAL_AGAS_MAX_PENDING_REFCNT_DELAY)) "}",
             "service_mode = hosted",
             "local_cache_size = ${HPX_AGAS_LOCAL_CACHE_SIZE:" HPX_PP_STRINGIZE(
                 HPX_PP_EXPAND(HPX_AGAS_LOCAL_CACHE_SIZE)) "}",
@@ -969,6 +972,22 @@ namespace hpx { namespace util {
         return HPX_INITIAL_AGAS_MAX_PENDING_REFCNT_REQUESTS;
     }
 
+    std::int64_t runtime_configuration::get_agas_max_pending_refcnt_delay()
+        const
+    {
+        if (has_section("hpx.agas"))
+        {
+            util::section const* sec = get_section("hpx.agas");
+            if (nullptr != sec)
+            {
+                return hpx::util::get_entry_as<std::int64_t>(*sec,
+                    "max_pending_refcnt_delay",
+                    HPX_INITIAL_AGAS_MAX_PENDING_REFCNT_DELAY);
+            }
+        }
+        return HPX_INITIAL_AGAS_MAX_PENDING_REFCNT_DELAY;
+    }
+
     bool runtime_configuration::get_itt_notify_mode() const
     {
 #if HPX_HAVE_ITTNOTIFY != 0
@@ -0,0 +1,72 @@
+//  Copyright (c) 2020 STE||AR Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#include <iterator>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace hpx { namespace traits {
+
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail {
+        template <typename T>
+        struct is_char_type
+          : std::integral_constant<bool,
+                std::is_same<T, char>::value ||
+                    std::is_same<T, wchar_t>::value ||
+                    std::is_same<T, char16_t>::value ||
+                    std::is_same<T, char32_t>::value>
+        {
+        };
+
+        // std::vector<bool> is not contiguous, std::basic_string can be
+        // instantiated for character types only
+        template <typename Iter,
+            typename T = typename std::iterator_traits<Iter>::value_type>
+        struct is_known_contiguous_iterator
+          : std::integral_constant<bool,
+                (!std::is_same<T, bool>::value &&
+                    (std::is_same<Iter,
+                         typename std::vector<T>::iterator>::value ||
+                        std::is_same<Iter,
+                            typename std::vector<T>::const_iterator>::value)) ||
+                    (is_char_type<T>::value &&
+                        (std::is_same<Iter,
+                             typename std::basic_string<typename std::
+                                     conditional<is_char_type<T>::value, T,
+                                         char>::type>::iterator>::value ||
+                            std::is_same<Iter,
+                                typename std::basic_string<typename std::
+                                        conditional<is_char_type<T>::value, T,
+                                            char>::type>::const_iterator>::
+                                value))>
+        {
+        };
+    }    // namespace detail
+
+    // An iterator is contiguous if the elements it refers to are stored
+    // adjacent to each other in memory, i.e. if std::addressof(*(it + n)) is
+    // equal to std::addressof(*it) + n. This trait can be specialized for
+    // user defined iterator types.
+    template <typename Iter, typename Enable = void>
+    struct is_contiguous_iterator : std::is_pointer<Iter>
+    {
+    };
+
+    template <typename Iter>
+    struct is_contiguous_iterator<Iter,
+        typename std::enable_if<!std::is_pointer<Iter>::value &&
+            std::is_same<typename std::iterator_traits<Iter>::iterator_category,
+                std::random_access_iterator_tag>::value>::type>
+      : detail::is_known_contiguous_iterator<Iter>
+    {
+    };
+}}    // namespace hpx::traits
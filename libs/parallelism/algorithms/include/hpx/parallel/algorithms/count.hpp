@@ -165,6 +165,7 @@ namespace hpx {
 #include <hpx/algorithms/traits/projected.hpp>
 #include <hpx/execution/traits/vector_pack_count_bits.hpp>
 #include <hpx/executors/execution_policy.hpp>
+#include <hpx/parallel/algorithms/detail/contiguous_compare.hpp>
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
 #include <hpx/parallel/algorithms/detail/distance.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
@@ -245,6 +246,41 @@ namespace hpx { namespace parallel { inline namespace v1 {
             }
         };
 
+        // counting in contiguous sequences of bitwise comparable elements
+        template <typename T>
+        struct count_contiguous_iteration
+        {
+            T value_;
+
+            template <typename Iter>
+            HPX_FORCEINLINE typename std::iterator_traits<Iter>::difference_type
+            operator()(Iter part_begin, std::size_t part_size) const
+            {
+                if (part_size == 0)
+                    return 0;
+
+                return static_cast<
+                    typename std::iterator_traits<Iter>::difference_type>(
+                    contiguous_count(
+                        contiguous_data(part_begin), part_size, value_));
+            }
+        };
+
+        template <typename ExPolicy, typename T, typename Proj>
+        count_iteration<ExPolicy, detail::compare_to<T>, Proj>
+        make_count_iteration(T const& value, Proj&& proj, std::false_type)
+        {
+            return count_iteration<ExPolicy, detail::compare_to<T>, Proj>(
+                detail::compare_to<T>(value), std::forward<Proj>(proj));
+        }
+
+        template <typename ExPolicy, typename T, typename Proj>
+        count_contiguous_iteration<T> make_count_iteration(
+            T const& value, Proj&&, std::true_type)
+        {
+            return count_contiguous_iteration<T>{value};
+        }
+
         ///////////////////////////////////////////////////////////////////////
         template <typename Value>
         struct count : public detail::algorithm<count<Value>, Value>
@@ -260,6 +296,17 @@ namespace hpx { namespace parallel { inline namespace v1 {
                 typename T, typename Proj>
             static difference_type sequential(ExPolicy&& policy, InIterB first,
                 InIterE last, T const& value, Proj&& proj)
+            {
+                return sequential_count(std::forward<ExPolicy>(policy), first,
+                    last, value, std::forward<Proj>(proj),
+                    is_contiguous_find<InIterB, InIterE, T, Proj>());
+            }
+
+            template <typename ExPolicy, typename InIterB, typename InIterE,
+                typename T, typename Proj>
+            static difference_type sequential_count(ExPolicy&& policy,
+                InIterB first, InIterE last, T const& value, Proj&& proj,
+                std::false_type)
             {
                 auto f1 =
                     count_iteration<ExPolicy, detail::compare_to<T>, Proj>(
@@ -273,6 +320,15 @@ namespace hpx { namespace parallel { inline namespace v1 {
                 return ret;
             }
 
+            template <typename ExPolicy, typename Iter, typename T,
+                typename Proj>
+            static difference_type sequential_count(ExPolicy&&, Iter first,
+                Iter last, T const& value, Proj&&, std::true_type)
+            {
+                return count_contiguous_iteration<T>{value}(
+                    first, std::distance(first, last));
+            }
+
             template <typename ExPolicy, typename IterB, typename IterE,
                 typename T, typename Proj>
             static typename util::detail::algorithm_result<ExPolicy,
@@ -286,9 +342,9 @@ namespace hpx { namespace parallel { inline namespace v1 {
                         difference_type>::get(0);
                 }
 
-                auto f1 =
-                    count_iteration<ExPolicy, detail::compare_to<T>, Proj>(
-                        detail::compare_to<T>(value), std::forward<Proj>(proj));
+                auto f1 = make_count_iteration<ExPolicy>(value,
+                    std::forward<Proj>(proj),
+                    is_contiguous_find<IterB, IterE, T, Proj>());
 
                 return util::partitioner<ExPolicy, difference_type>::call(
                     std::forward<ExPolicy>(policy), first,
@@ -0,0 +1,599 @@
+//  Copyright (c) 2020 STE||AR Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/algorithms/traits/is_contiguous_iterator.hpp>
+#include <hpx/execution/algorithms/detail/predicates.hpp>
+#include <hpx/parallel/util/projection_identity.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+
+// The kernels below use SSE2 (which is part of the x86-64 baseline) and,
+// if the CPU supports it, AVX2. Unless the code is compiled with AVX2 enabled
+// anyways, the AVX2 variants are selected at runtime.
+#if defined(HPX_GCC_VERSION) && !defined(HPX_INTEL_VERSION) &&                 \
+    (defined(__x86_64__) || defined(__i386__)) && defined(__SSE2__)
+#define HPX_CONTIGUOUS_COMPARE_SSE2
+#include <immintrin.h>
+#if defined(__AVX2__)
+#define HPX_CONTIGUOUS_COMPARE_TARGET_AVX2
+#else
+#define HPX_CONTIGUOUS_COMPARE_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+#endif
+
+namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Two objects of these types compare equal if and only if their object
+    // representations are identical.
+    template <typename T>
+    struct is_bitwise_comparable
+      : std::integral_constant<bool,
+            (std::is_integral<T>::value || std::is_enum<T>::value ||
+                std::is_pointer<T>::value) &&
+                !std::is_volatile<T>::value &&
+                (sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 ||
+                    sizeof(T) == 8)>
+    {
+    };
+
+    // Predicates which are known to be equivalent to operator==()
+    template <typename Pred, typename T>
+    struct is_equal_to_predicate : std::false_type
+    {
+    };
+
+    template <typename T>
+    struct is_equal_to_predicate<detail::equal_to, T> : std::true_type
+    {
+    };
+
+    template <typename T>
+    struct is_equal_to_predicate<std::equal_to<>, T> : std::true_type
+    {
+    };
+
+    template <typename T>
+    struct is_equal_to_predicate<std::equal_to<T>, T> : std::true_type
+    {
+    };
+
+    // The value type of the given iterator is bitwise comparable and the
+    // iterator refers to contiguous memory.
+    template <typename Iter,
+        typename T = typename std::iterator_traits<Iter>::value_type>
+    struct is_contiguous_bitwise_comparable
+      : std::conditional<is_bitwise_comparable<T>::value,
+            hpx::traits::is_contiguous_iterator<Iter>, std::false_type>::type
+    {
+    };
+
+    // find/count of a value in [first, last) using operator==() without a
+    // projection
+    template <typename Iter, typename Sent, typename T, typename Proj>
+    struct is_contiguous_find
+      : std::conditional<std::is_same<Iter, Sent>::value &&
+                std::is_same<typename std::decay<Proj>::type,
+                    util::projection_identity>::value &&
+                std::is_same<typename std::iterator_traits<Iter>::value_type,
+                    typename std::decay<T>::type>::value,
+            is_contiguous_bitwise_comparable<Iter>, std::false_type>::type
+    {
+    };
+
+    // element-wise comparison of two sequences using an equality predicate
+    // without projections
+    template <typename Iter1, typename Iter2, typename Pred,
+        typename Proj1 = util::projection_identity,
+        typename Proj2 = util::projection_identity>
+    struct is_contiguous_compare
+      : std::conditional<
+            std::is_same<typename std::iterator_traits<Iter1>::value_type,
+                typename std::iterator_traits<Iter2>::value_type>::value &&
+                is_equal_to_predicate<typename std::decay<Pred>::type,
+                    typename std::iterator_traits<Iter1>::value_type>::value &&
+                std::is_same<typename std::decay<Proj1>::type,
+                    util::projection_identity>::value &&
+                std::is_same<typename std::decay<Proj2>::type,
+                    util::projection_identity>::value &&
+                is_contiguous_bitwise_comparable<Iter1>::value,
+            is_contiguous_bitwise_comparable<Iter2>, std::false_type>::type
+    {
+    };
+
+    // Number of elements processed between checks of a cancellation token.
+    HPX_INLINE_CONSTEXPR_VARIABLE std::size_t contiguous_compare_block_size =
+        4096;
+
+    template <typename Iter>
+    HPX_FORCEINLINE
+        typename std::iterator_traits<Iter>::value_type const* contiguous_data(
+            Iter it)
+    {
+        return std::addressof(*it);
+    }
+
+#if defined(HPX_CONTIGUOUS_COMPARE_SSE2)
+    ///////////////////////////////////////////////////////////////////////////
+    namespace simd {
+
+        inline bool has_avx2() noexcept
+        {
+#if defined(__AVX2__)
+            return true;
+#else
+            static bool const avx2 = __builtin_cpu_supports("avx2");
+            return avx2;
+#endif
+        }
+
+        // lane-wise comparisons of elements of the given size, all bytes of
+        // equal lanes are set to 0xff
+        template <std::size_t Size>
+        struct lanes;
+
+        template <>
+        struct lanes<1>
+        {
+            static __m128i eq(__m128i a, __m128i b) noexcept
+            {
+                return _mm_cmpeq_epi8(a, b);
+            }
+
+            HPX_CONTIGUOUS_COMPARE_TARGET_AVX2 static __m256i eq(
+                __m256i a, __m256i b) noexcept
+            {
+                return _mm256_cmpeq_epi8(a, b);
+            }
+        };
+
+        template <>
+        struct lanes<2>
+        {
+            static __m128i eq(__m128i a, __m128i b) noexcept
+            {
+                return _mm_cmpeq_epi16(a, b);
+            }
+
+            HPX_CONTIGUOUS_COMPARE_TARGET_AVX2 static __m256i eq(
+                __m256i a, __m256i b) noexcept
+            {
+                return _mm256_cmpeq_epi16(a, b);
+            }
+        };
+
+        template <>
+        struct lanes<4>
+        {
+            static __m128i eq(__m128i a, __m128i b) noexcept
+            {
+                return _mm_cmpeq_epi32(a, b);
+            }
+
+            HPX_CONTIGUOUS_COMPARE_TARGET_AVX2 static __m256i eq(
+                __m256i a, __m256i b) noexcept
+            {
+                return _mm256_cmpeq_epi32(a, b);
+            }
+        };
+
+        template <>
+        struct lanes<8>
+        {
+            // SSE2 has no 64bit comparison, combine the results for both
+            // 32bit halves instead
+            static __m128i eq(__m128i a, __m128i b) noexcept
+            {
+                __m128i const e = _mm_cmpeq_epi32(a, b);
+                return _mm_and_si128(
+                    e, _mm_shuffle_epi32(e, _MM_SHUFFLE(2, 3, 0, 1)));
+            }
+
+            HPX_CONTIGUOUS_COMPARE_TARGET_AVX2 static __m256i eq(
+                __m256i a, __m256i b) noexcept
+            {
+                return _mm256_cmpeq_epi64(a, b);
+            }
+        };
+
+        template <typename T>
+        __m128i splat128(T const& val) noexcept
+        {
+            T data[16 / sizeof(T)];
+            std::fill_n(data, 16 / sizeof(T), val);
+            return _mm_loadu_si128(reinterpret_cast<__m128i const*>(data));
+        }
+
+        template <typename T>
+        HPX_CONTIGUOUS_COMPARE_TARGET_AVX2 __m256i splat256(
+            T const& val) noexcept
+        {
+            T data[32 / sizeof(T)];
+            std::fill_n(data, 32 / sizeof(T), val);
+            return _mm256_loadu_si256(reinterpret_cast<__m256i const*>(data));
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        template <typename T>
+        std::size_t find_sse2(T const* p, std::size_t count, T val) noexcept
+        {
+            constexpr std::size_t width = 16 / sizeof(T);
+
+            __m128i const v = splat128(val);
+
+            std::size_t i = 0;
+            for (/**/; i + width <= count; i += width)
+            {
+                __m128i const d =
+                    _mm_loadu_si128(reinterpret_cast<__m128i const*>(p + i));
+                unsigned const mask = static_cast<unsigned>(
+                    _mm_movemask_epi8(lanes<sizeof(T)>::eq(d, v)));
+                if (mask != 0)
+                    return i + __builtin_ctz(mask) / sizeof(T);
+            }
+            for (/**/; i != count; ++i)
+            {
+                if (p[i] == val)
+                    break;
+            }
+            return i;
+        }
+
+        template <typename T>
+        HPX_CONTIGUOUS_COMPARE_TARGET_AVX2 std::size_t find_avx2(
+            T const* p, std::size_t count, T val) noexcept
+        {
+            constexpr std::size_t width = 32 / sizeof(T);
+
+            __m256i const v = splat256(val);
+
+            std::size_t i = 0;
+            for (/**/; i + width <= count; i += width)
+            {
+                __m256i const d = _mm256_loadu_si256(
+                    reinterpret_cast<__m256i const*>(p + i));
+                unsigned const mask = static_cast<unsigned>(
+                    _mm256_movemask_epi8(lanes<sizeof(T)>::eq(d, v)));
+                if (mask != 0)
+                    return i + __builtin_ctz(mask) / sizeof(T);
+            }
+            for (/**/; i != count; ++i)
+            {
+                if (p[i] == val)
+                    break;
+            }
+            return i;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        template <typename T>
+        std::size_t count_sse2(T const* p, std::size_t count, T val) noexcept
+        {
+            constexpr std::size_t width = 16 / sizeof(T);
+
+            __m128i const v = splat128(val);
+
+            // every matching element sets sizeof(T) bits in the mask
+            std::size_t bits = 0;
+            std::size_t i = 0;
+            for (/**/; i + width <= count; i += width)
+            {
+                __m128i const d =
+                    _mm_loadu_si128(reinterpret_cast<__m128i const*>(p + i));
+                bits += __builtin_popcount(static_cast<unsigned>(
+                    _mm_movemask_epi8(lanes<sizeof(T)>::eq(d, v))));
+            }
+
+            std::size_t result = bits / sizeof(T);
+            for (/**/; i != count; ++i)
+            {
+                if (p[i] == val)
+                    ++result;
+            }
+            return result;
+        }
+
+        template <typename T>
+        HPX_CONTIGUOUS_COMPARE_TARGET_AVX2 std::size_t count_avx2(
+            T const* p, std::size_t count, T val) noexcept
+        {
+            constexpr std::size_t width = 32 / sizeof(T);
+
+            __m256i const v = splat256(val);
+
+            std::size_t bits = 0;
+            std::size_t i = 0;
+            for (/**/; i + width <= count; i += width)
+            {
+                __m256i const d = _mm256_loadu_si256(
+                    reinterpret_cast<__m256i const*>(p + i));
+                bits += __builtin_popcount(static_cast<unsigned>(
+                    _mm256_movemask_epi8(lanes<sizeof(T)>::eq(d, v))));
+            }
+
+            std::size_t result = bits / sizeof(T);
+            for (/**/; i != count; ++i)
+            {
+                if (p[i] == val)
+                    ++result;
+            }
+            return result;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // returns the index of the first differing byte
+        inline std::size_t mismatch_sse2(unsigned char const* p1,
+            unsigned char const* p2, std::size_t count) noexcept
+        {
+            std::size_t i = 0;
+            for (/**/; i + 16 <= count; i += 16)
+            {
+                __m128i const d1 =
+                    _mm_loadu_si128(reinterpret_cast<__m128i const*>(p1 + i));
+                __m128i const d2 =
+                    _mm_loadu_si128(reinterpret_cast<__m128i const*>(p2 + i));
+                unsigned const mask = static_cast<unsigned>(
+                    _mm_movemask_epi8(_mm_cmpeq_epi8(d1, d2)));
+                if (mask != 0xffff)
+                    return i + __builtin_ctz(~mask);
+            }
+            for (/**/; i != count; ++i)
+            {
+                if (p1[i] != p2[i])
+                    break;
+            }
+            return i;
+        }
+
+        HPX_CONTIGUOUS_COMPARE_TARGET_AVX2 inline std::size_t mismatch_avx2(
+            unsigned char const* p1, unsigned char const* p2,
+            std::size_t count) noexcept
+        {
+            std::size_t i = 0;
+            for (/**/; i + 32 <= count; i += 32)
+            {
+                __m256i const d1 = _mm256_loadu_si256(
+                    reinterpret_cast<__m256i const*>(p1 + i));
+                __m256i const d2 = _mm256_loadu_si256(
+                    reinterpret_cast<__m256i const*>(p2 + i));
+                unsigned const mask = static_cast<unsigned>(
+                    _mm256_movemask_epi8(_mm256_cmpeq_epi8(d1, d2)));
+                if (mask != 0xffffffff)
+                    return i + __builtin_ctz(~mask);
+            }
+            for (/**/; i != count; ++i)
+            {
+                if (p1[i] != p2[i])
+                    break;
+            }
+            return i;
+        }
+    }    // namespace simd
+#endif
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Returns the index of the first element in [p, p + count) equal to val,
+    // or count if there is none.
+    template <typename T>
+    std::size_t contiguous_find(T const* p, std::size_t count, T val) noexcept
+    {
+        if (count == 0)
+            return 0;
+
+        if (sizeof(T) == 1)
+        {
+            unsigned char byte;
+            std::memcpy(&byte, &val, 1);
+
+            void const* found = std::memchr(p, byte, count);
+            return found == nullptr ? count :
+                                      static_cast<std::size_t>(
+                                          static_cast<T const*>(found) - p);
+        }
+
+#if defined(HPX_CONTIGUOUS_COMPARE_SSE2)
+        if (simd::has_avx2())
+            return simd::find_avx2(p, count, val);
+        return simd::find_sse2(p, count, val);
+#else
+        std::size_t i = 0;
+        for (/**/; i != count; ++i)
+        {
+            if (p[i] == val)
+                break;
+        }
+        return i;
+#endif
+    }
+
+    // Returns the number of elements in [p, p + count) equal to val.
+    template <typename T>
+    std::size_t contiguous_count(T const* p, std::size_t count, T val) noexcept
+    {
+#if defined(HPX_CONTIGUOUS_COMPARE_SSE2)
+        if (simd::has_avx2())
+            return simd::count_avx2(p, count, val);
+        return simd::count_sse2(p, count, val);
+#else
+        std::size_t result = 0;
+        for (std::size_t i = 0; i != count; ++i)
+        {
+            result += (p[i] == val);
+        }
+        return result;
+#endif
+    }
+
+    // Returns the index of the first position where [p1, p1 + count) and
+    // [p2, p2 + count) differ, or count if both ranges are equal.
+    template <typename T>
+    std::size_t contiguous_mismatch(
+        T const* p1, T const* p2, std::size_t count) noexcept
+    {
+#if defined(HPX_CONTIGUOUS_COMPARE_SSE2)
+        // the first differing byte belongs to the first differing element
+        unsigned char const* b1 = reinterpret_cast<unsigned char const*>(p1);
+        unsigned char const* b2 = reinterpret_cast<unsigned char const*>(p2);
+        std::size_t const bytes = count * sizeof(T);
+
+        if (simd::has_avx2())
+            return simd::mismatch_avx2(b1, b2, bytes) / sizeof(T);
+        return simd::mismatch_sse2(b1, b2, bytes) / sizeof(T);
+#else
+        std::size_t i = 0;
+        for (/**/; i != count; ++i)
+        {
+            if (p1[i] != p2[i])
+                break;
+        }
+        return i;
+#endif
+    }
+
+    template <typename T>
+    HPX_FORCEINLINE bool contiguous_equal(
+        T const* p1, T const* p2, std::size_t count) noexcept
+    {
+        return count == 0 || std::memcmp(p1, p2, count * sizeof(T)) == 0;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Helpers for the partitioned algorithms: the data is processed in
+    // blocks, the cancellation token is checked in between.
+    template <typename Iter, typename T, typename Token>
+    void contiguous_find_idx_n(std::size_t base_idx, Iter it,
+        std::size_t count, Token& tok, T const& val)
+    {
+        if (count == 0)
+            return;
+
+        auto p = contiguous_data(it);
+        while (count != 0 && !tok.was_cancelled(base_idx))
+        {
+            std::size_t const n =
+                (std::min)(count, contiguous_compare_block_size);
+            std::size_t const pos = contiguous_find(p, n, val);
+            if (pos != n)
+            {
+                tok.cancel(base_idx + pos);
+                return;
+            }
+
+            p += n;
+            base_idx += n;
+            count -= n;
+        }
+    }
+
+    template <typename Iter1, typename Iter2, typename Token>
+    void contiguous_mismatch_idx_n(std::size_t base_idx, Iter1 it1,
+        Iter2 it2, std::size_t count, Token& tok)
+    {
+        if (count == 0)
+            return;
+
+        auto p1 = contiguous_data(it1);
+        auto p2 = contiguous_data(it2);
+        while (count != 0 && !tok.was_cancelled(base_idx))
+        {
+            std::size_t const n =
+                (std::min)(count, contiguous_compare_block_size);
+            std::size_t const pos = contiguous_mismatch(p1, p2, n);
+            if (pos != n)
+            {
+                tok.cancel(base_idx + pos);
+                return;
+            }
+
+            p1 += n;
+            p2 += n;
+            base_idx += n;
+            count -= n;
+        }
+    }
+
+    template <typename Iter1, typename Iter2, typename Token>
+    bool contiguous_equal_n(
+        Iter1 it1, Iter2 it2, std::size_t count, Token& tok)
+    {
+        if (count == 0)
+            return !tok.was_cancelled();
+
+        auto p1 = contiguous_data(it1);
+        auto p2 = contiguous_data(it2);
+        while (count != 0 && !tok.was_cancelled())
+        {
+            std::size_t const n =
+                (std::min)(count, contiguous_compare_block_size);
+            if (!contiguous_equal(p1, p2, n))
+            {
+                tok.cancel();
+                return false;
+            }
+
+            p1 += n;
+            p2 += n;
+            count -= n;
+        }
+        return !tok.was_cancelled();
+    }
+
+    // Search for [s, s + s_count) starting at one of the count positions
+    // following p. The whole needle has to be accessible from all of those
+    // positions.
+    template <typename T>
+    std::size_t contiguous_search(T const* p, std::size_t count, T const* s,
+        std::size_t s_count) noexcept
+    {
+        std::size_t pos = 0;
+        while (pos != count)
+        {
+            pos += contiguous_find(p + pos, count - pos, *s);
+            if (pos == count ||
+                contiguous_equal(p + pos + 1, s + 1, s_count - 1))
+            {
+                break;
+            }
+            ++pos;
+        }
+        return pos;
+    }
+
+    template <typename Iter1, typename Iter2, typename Token>
+    void contiguous_search_idx_n(std::size_t base_idx, Iter1 it,
+        std::size_t count, Iter2 s_first, std::size_t s_count, Token& tok)
+    {
+        if (count == 0)
+            return;
+
+        auto p = contiguous_data(it);
+        auto s = contiguous_data(s_first);
+        while (count != 0 && !tok.was_cancelled(base_idx))
+        {
+            std::size_t const n =
+                (std::min)(count, contiguous_compare_block_size);
+            std::size_t const pos = contiguous_search(p, n, s, s_count);
+            if (pos != n)
+            {
+                tok.cancel(base_idx + pos);
+                return;
+            }
+
+            p += n;
+            base_idx += n;
+            count -= n;
+        }
+    }
+}}}}    // namespace hpx::parallel::v1::detail
@@ -14,6 +14,7 @@
 #include <hpx/execution/algorithms/detail/predicates.hpp>
 #include <hpx/functional/detail/invoke.hpp>
 
+#include <hpx/parallel/algorithms/detail/contiguous_compare.hpp>
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
 #include <hpx/parallel/util/compare_projected.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
@@ -29,6 +30,61 @@
 namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
     /// \cond NOINTERNAL
 
+    ///////////////////////////////////////////////////////////////////////////
+    // Look for the needle starting at each of the positions of one partition
+    template <typename FwdIter, typename FwdIter2, typename Token,
+        typename Pred, typename Proj1, typename Proj2>
+    void search_idx_n(std::size_t base_idx, FwdIter it, std::size_t part_size,
+        FwdIter2 s_first,
+        typename std::iterator_traits<FwdIter>::difference_type diff,
+        typename std::iterator_traits<FwdIter>::difference_type count,
+        Token& tok, Pred& op, Proj1& proj1, Proj2& proj2, std::false_type)
+    {
+        using reference = typename std::iterator_traits<FwdIter>::reference;
+        using difference_type =
+            typename std::iterator_traits<FwdIter>::difference_type;
+
+        FwdIter curr = it;
+
+        hpx::parallel::util::loop_idx_n(base_idx, it, part_size, tok,
+            [diff, count, s_first, &tok, &curr, &op, &proj1, &proj2](
+                reference v, std::size_t i) -> void {
+                ++curr;
+                if (HPX_INVOKE(
+                        op, HPX_INVOKE(proj1, v), HPX_INVOKE(proj2, *s_first)))
+                {
+                    difference_type local_count = 1;
+                    FwdIter2 needle = s_first;
+                    FwdIter mid = curr;
+
+                    for (difference_type len = 0;
+                         local_count != diff && len != count;
+                         ++local_count, ++len, ++mid)
+                    {
+                        if (!HPX_INVOKE(op, HPX_INVOKE(proj1, *mid),
+                                HPX_INVOKE(proj2, *++needle)))
+                            break;
+                    }
+
+                    if (local_count == diff)
+                        tok.cancel(i);
+                }
+            });
+    }
+
+    // contiguous sequences of bitwise comparable elements
+    template <typename FwdIter, typename FwdIter2, typename Token,
+        typename Pred, typename Proj1, typename Proj2>
+    void search_idx_n(std::size_t base_idx, FwdIter it, std::size_t part_size,
+        FwdIter2 s_first,
+        typename std::iterator_traits<FwdIter>::difference_type diff,
+        typename std::iterator_traits<FwdIter>::difference_type, Token& tok,
+        Pred&, Proj1&, Proj2&, std::true_type)
+    {
+        contiguous_search_idx_n(base_idx, it, part_size, s_first,
+            static_cast<std::size_t>(diff), tok);
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     // search
     template <typename FwdIter, typename Sent>
@@ -44,6 +100,43 @@ namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
         static FwdIter sequential(ExPolicy, FwdIter first, Sent last,
             FwdIter2 s_first, Sent2 s_last, Pred&& op, Proj1&& proj1,
             Proj2&& proj2)
+        {
+            using is_contiguous = std::integral_constant<bool,
+                std::is_same<FwdIter, Sent>::value &&
+                    std::is_same<FwdIter2, Sent2>::value &&
+                    is_contiguous_compare<FwdIter, FwdIter2, Pred, Proj1,
+                        Proj2>::value>;
+
+            return sequential_search(first, last, s_first, s_last,
+                std::forward<Pred>(op), std::forward<Proj1>(proj1),
+                std::forward<Proj2>(proj2), is_contiguous());
+        }
+
+        // contiguous sequences of bitwise comparable elements
+        template <typename FwdIter2, typename Pred, typename Proj1,
+            typename Proj2>
+        static FwdIter sequential_search(FwdIter first, FwdIter last,
+            FwdIter2 s_first, FwdIter2 s_last, Pred&&, Proj1&&, Proj2&&,
+            std::true_type)
+        {
+            std::size_t count = std::distance(first, last);
+            std::size_t diff = std::distance(s_first, s_last);
+            if (diff == 0)
+                return first;
+            if (diff > count)
+                return last;
+
+            std::size_t const candidates = count - (diff - 1);
+            std::size_t const pos = contiguous_search(contiguous_data(first),
+                candidates, contiguous_data(s_first), diff);
+            return pos == candidates ? last : first + pos;
+        }
+
+        template <typename FwdIter2, typename Sent2, typename Pred,
+            typename Proj1, typename Proj2>
+        static FwdIter sequential_search(FwdIter first, Sent last,
+            FwdIter2 s_first, Sent2 s_last, Pred&& op, Proj1&& proj1,
+            Proj2&& proj2, std::false_type)
         {
             for (;; ++first)
             {
@@ -68,8 +161,6 @@ namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
         parallel(ExPolicy&& policy, FwdIter first, Sent last, FwdIter2 s_first,
             Sent2 s_last, Pred&& op, Proj1&& proj1, Proj2&& proj2)
         {
-            using reference = typename std::iterator_traits<FwdIter>::reference;
-
             using difference_type =
                 typename std::iterator_traits<FwdIter>::difference_type;
 
@@ -91,8 +182,7 @@ namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
                 hpx::parallel::v1::detail::distance(first, last);
             if (diff > count)
             {
-                std::advance(first,
-                    hpx::parallel::v1::detail::distance(first, last) - 1);
+                std::advance(first, count);
                 return result::get(std::move(first));
             }
 
@@ -106,44 +196,15 @@ namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
                           proj2 = std::forward<Proj2>(proj2)](FwdIter it,
                           std::size_t part_size,
                           std::size_t base_idx) mutable -> void {
-                FwdIter curr = it;
-
-                hpx::parallel::util::loop_idx_n(base_idx, it, part_size, tok,
-                    [diff, count, s_first, &tok, &curr,
-                        op = std::forward<Pred>(op),
-                        proj1 = std::forward<Proj1>(proj1),
-                        proj2 = std::forward<Proj2>(proj2)](
-                        reference v, std::size_t i) -> void {
-                        ++curr;
-                        if (HPX_INVOKE(op, HPX_INVOKE(proj1, v),
-                                HPX_INVOKE(proj2, *s_first)))
-                        {
-                            difference_type local_count = 1;
-                            FwdIter2 needle = s_first;
-                            FwdIter mid = curr;
-
-                            for (difference_type len = 0;
-                                 local_count != diff && len != count;
-                                 ++local_count, ++len, ++mid)
-                            {
-                                if (!HPX_INVOKE(op, HPX_INVOKE(proj1, *mid),
-                                        HPX_INVOKE(proj2, *++needle)))
-                                    break;
-                            }
-
-                            if (local_count == diff)
-                                tok.cancel(i);
-                        }
-                    });
+                search_idx_n(base_idx, it, part_size, s_first, diff, count,
+                    tok, op, proj1, proj2,
+                    is_contiguous_compare<FwdIter, FwdIter2, Pred, Proj1,
+                        Proj2>());
             };
 
             auto f2 = [=](std::vector<hpx::future<void>>&&) mutable -> FwdIter {
                 difference_type search_res = tok.get_data();
-                if (search_res != count)
-                    std::advance(first, search_res);
-                else
-                    std::advance(first,
-                        hpx::parallel::v1::detail::distance(first, last) - 1);
+                std::advance(first, search_res);
 
                 return std::move(first);
             };
@@ -167,11 +228,43 @@ namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
         static FwdIter sequential(ExPolicy, FwdIter first, std::size_t count,
             FwdIter2 s_first, FwdIter2 s_last, Pred&& op, Proj1&& proj1,
             Proj2&& proj2)
+        {
+            return sequential_search_n(first, count, s_first, s_last,
+                std::forward<Pred>(op), std::forward<Proj1>(proj1),
+                std::forward<Proj2>(proj2),
+                is_contiguous_compare<FwdIter, FwdIter2, Pred, Proj1,
+                    Proj2>());
+        }
+
+        template <typename FwdIter2, typename Pred, typename Proj1,
+            typename Proj2>
+        static FwdIter sequential_search_n(FwdIter first, std::size_t count,
+            FwdIter2 s_first, FwdIter2 s_last, Pred&& op, Proj1&& proj1,
+            Proj2&& proj2, std::false_type)
         {
             return std::search(first, std::next(first, count), s_first, s_last,
                 util::compare_projected<Pred, Proj1, Proj2>(op, proj1, proj2));
         }
 
+        // contiguous sequences of bitwise comparable elements
+        template <typename FwdIter2, typename Pred, typename Proj1,
+            typename Proj2>
+        static FwdIter sequential_search_n(FwdIter first, std::size_t count,
+            FwdIter2 s_first, FwdIter2 s_last, Pred&&, Proj1&&, Proj2&&,
+            std::true_type)
+        {
+            std::size_t diff = std::distance(s_first, s_last);
+            if (diff == 0)
+                return first;
+            if (diff > count)
+                return first + count;
+
+            std::size_t const candidates = count - (diff - 1);
+            std::size_t const pos = contiguous_search(contiguous_data(first),
+                candidates, contiguous_data(s_first), diff);
+            return first + (pos == candidates ? count : pos);
+        }
+
         template <typename ExPolicy, typename FwdIter2, typename Pred,
             typename Proj1, typename Proj2>
         static typename util::detail::algorithm_result<ExPolicy, FwdIter>::type
@@ -179,7 +272,6 @@ namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
             FwdIter2 s_first, FwdIter2 s_last, Pred&& op, Proj1&& proj1,
             Proj2&& proj2)
         {
-            typedef typename std::iterator_traits<FwdIter>::reference reference;
             typedef typename std::iterator_traits<FwdIter>::difference_type
                 difference_type;
             typedef typename std::iterator_traits<FwdIter2>::difference_type
@@ -191,7 +283,10 @@ namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
                 return result::get(std::move(first));
 
             if (diff > s_difference_type(count))
+            {
+                std::advance(first, count);
                 return result::get(std::move(first));
+            }
 
             typedef util::partitioner<ExPolicy, FwdIter, void> partitioner;
 
@@ -202,41 +297,16 @@ namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
                           proj2 = std::forward<Proj2>(proj2)](FwdIter it,
                           std::size_t part_size,
                           std::size_t base_idx) mutable -> void {
-                FwdIter curr = it;
-
-                util::loop_idx_n(base_idx, it, part_size, tok,
-                    [count, diff, s_first, &tok, &curr,
-                        op = std::forward<Pred>(op),
-                        proj1 = std::forward<Proj1>(proj1),
-                        proj2 = std::forward<Proj2>(proj2)](
-                        reference v, std::size_t i) -> void {
-                        ++curr;
-                        if (HPX_INVOKE(op, HPX_INVOKE(proj1, v),
-                                HPX_INVOKE(proj2, *s_first)))
-                        {
-                            difference_type local_count = 1;
-                            FwdIter2 needle = s_first;
-                            FwdIter mid = curr;
-
-                            for (difference_type len = 0; local_count != diff &&
-                                 len != difference_type(count);
-                                 ++local_count, ++len, ++mid)
-                            {
-                                if (!HPX_INVOKE(op, HPX_INVOKE(proj1, *mid),
-                                        HPX_INVOKE(proj2, *++needle)))
-                                    break;
-                            }
-
-                            if (local_count == diff)
-                                tok.cancel(i);
-                        }
-                    });
+                search_idx_n(base_idx, it, part_size, s_first,
+                    difference_type(diff), difference_type(count), tok, op,
+                    proj1, proj2,
+                    is_contiguous_compare<FwdIter, FwdIter2, Pred, Proj1,
+                        Proj2>());
             };
 
             auto f2 = [=](std::vector<hpx::future<void>>&&) mutable -> FwdIter {
                 difference_type search_res = tok.get_data();
-                if (search_res != s_difference_type(count))
-                    std::advance(first, search_res);
+                std::advance(first, search_res);
 
                 return std::move(first);
             };
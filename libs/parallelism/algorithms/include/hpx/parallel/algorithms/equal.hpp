@@ -179,6 +179,7 @@ namespace hpx {
 
 #include <hpx/execution/algorithms/detail/predicates.hpp>
 #include <hpx/executors/execution_policy.hpp>
+#include <hpx/parallel/algorithms/detail/contiguous_compare.hpp>
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
 #include <hpx/parallel/algorithms/detail/distance.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
@@ -205,7 +206,8 @@ namespace hpx { namespace parallel { inline namespace v1 {
         template <typename InIter1, typename InIter2, typename F,
             typename Proj1, typename Proj2>
         bool sequential_equal_binary(InIter1 first1, InIter1 last1,
-            InIter2 first2, InIter2 last2, F&& f, Proj1&& proj1, Proj2&& proj2)
+            InIter2 first2, InIter2 last2, F&& f, Proj1&& proj1, Proj2&& proj2,
+            std::false_type)
         {
             for (/* */; first1 != last1 && first2 != last2;
                  (void) ++first1, ++first2)
@@ -217,6 +219,63 @@ namespace hpx { namespace parallel { inline namespace v1 {
             return first1 == last1 && first2 == last2;
         }
 
+        // contiguous sequences of bitwise comparable elements
+        template <typename Iter1, typename Iter2, typename F, typename Proj1,
+            typename Proj2>
+        bool sequential_equal_binary(Iter1 first1, Iter1 last1, Iter2 first2,
+            Iter2 last2, F&&, Proj1&&, Proj2&&, std::true_type)
+        {
+            std::size_t count = std::distance(first1, last1);
+            if (count != static_cast<std::size_t>(std::distance(first2, last2)))
+                return false;
+
+            return count == 0 ||
+                contiguous_equal(
+                    contiguous_data(first1), contiguous_data(first2), count);
+        }
+
+        template <typename InIter1, typename InIter2, typename F,
+            typename Proj1, typename Proj2>
+        bool sequential_equal_binary(InIter1 first1, InIter1 last1,
+            InIter2 first2, InIter2 last2, F&& f, Proj1&& proj1, Proj2&& proj2)
+        {
+            return sequential_equal_binary(first1, last1, first2, last2,
+                std::forward<F>(f), std::forward<Proj1>(proj1),
+                std::forward<Proj2>(proj2),
+                is_contiguous_compare<InIter1, InIter2, F, Proj1, Proj2>());
+        }
+
+        // element-wise comparison of one partition of the zipped sequences
+        template <typename ExPolicy, typename ZipIter, typename Token,
+            typename F, typename Proj1, typename Proj2>
+        bool equal_n(ZipIter it, std::size_t part_count, Token& tok, F& f,
+            Proj1& proj1, Proj2& proj2, std::false_type)
+        {
+            using reference = typename ZipIter::reference;
+
+            util::loop_n<ExPolicy>(it, part_count, tok,
+                [&f, &proj1, &proj2, &tok](ZipIter const& curr) {
+                    reference t = *curr;
+                    if (!hpx::util::invoke(f,
+                            hpx::util::invoke(proj1, hpx::get<0>(t)),
+                            hpx::util::invoke(proj2, hpx::get<1>(t))))
+                    {
+                        tok.cancel();
+                    }
+                });
+            return !tok.was_cancelled();
+        }
+
+        template <typename ExPolicy, typename ZipIter, typename Token,
+            typename F, typename Proj1, typename Proj2>
+        bool equal_n(ZipIter it, std::size_t part_count, Token& tok, F&,
+            Proj1&, Proj2&, std::true_type)
+        {
+            auto const& iters = it.get_iterator_tuple();
+            return contiguous_equal_n(
+                hpx::get<0>(iters), hpx::get<1>(iters), part_count, tok);
+        }
+
         ///////////////////////////////////////////////////////////////////////
         struct equal_binary : public detail::algorithm<equal_binary, bool>
         {
@@ -277,7 +336,6 @@ namespace hpx { namespace parallel { inline namespace v1 {
                 }
 
                 typedef hpx::util::zip_iterator<Iter1, Iter2> zip_iterator;
-                typedef typename zip_iterator::reference reference;
 
                 util::cancellation_token<> tok;
                 auto f1 = [tok, f = std::forward<F>(f),
@@ -285,17 +343,10 @@ namespace hpx { namespace parallel { inline namespace v1 {
                               proj2 = std::forward<Proj2>(proj2)](
                               zip_iterator it,
                               std::size_t part_count) mutable -> bool {
-                    util::loop_n<ExPolicy>(it, part_count, tok,
-                        [&f, &proj1, &proj2, &tok](zip_iterator const& curr) {
-                            reference t = *curr;
-                            if (!hpx::util::invoke(f,
-                                    hpx::util::invoke(proj1, hpx::get<0>(t)),
-                                    hpx::util::invoke(proj2, hpx::get<1>(t))))
-                            {
-                                tok.cancel();
-                            }
-                        });
-                    return !tok.was_cancelled();
+                    return equal_n<ExPolicy>(it, part_count, tok, f, proj1,
+                        proj2,
+                        is_contiguous_compare<Iter1, Iter2, F, Proj1,
+                            Proj2>());
                 };
 
                 return util::partitioner<ExPolicy, bool>::call(
@@ -365,10 +416,29 @@ namespace hpx { namespace parallel { inline namespace v1 {
                 typename F>
             static bool sequential(
                 ExPolicy, InIter1 first1, InIter1 last1, InIter2 first2, F&& f)
+            {
+                return sequential_equal(first1, last1, first2,
+                    std::forward<F>(f),
+                    is_contiguous_compare<InIter1, InIter2, F>());
+            }
+
+            template <typename InIter1, typename InIter2, typename F>
+            static bool sequential_equal(InIter1 first1, InIter1 last1,
+                InIter2 first2, F&& f, std::false_type)
             {
                 return std::equal(first1, last1, first2, std::forward<F>(f));
             }
 
+            template <typename InIter1, typename InIter2, typename F>
+            static bool sequential_equal(InIter1 first1, InIter1 last1,
+                InIter2 first2, F&&, std::true_type)
+            {
+                std::size_t count = std::distance(first1, last1);
+                return count == 0 ||
+                    contiguous_equal(contiguous_data(first1),
+                        contiguous_data(first2), count);
+            }
+
             template <typename ExPolicy, typename FwdIter1, typename FwdIter2,
                 typename F>
             static typename util::detail::algorithm_result<ExPolicy, bool>::type
@@ -387,21 +457,13 @@ namespace hpx { namespace parallel { inline namespace v1 {
 
                 typedef hpx::util::zip_iterator<FwdIter1, FwdIter2>
                     zip_iterator;
-                typedef typename zip_iterator::reference reference;
 
                 util::cancellation_token<> tok;
                 auto f1 = [f, tok](zip_iterator it,
                               std::size_t part_count) mutable -> bool {
-                    util::loop_n<ExPolicy>(it, part_count, tok,
-                        [&f, &tok](zip_iterator const& curr) {
-                            reference t = *curr;
-                            if (!hpx::util::invoke(
-                                    f, hpx::get<0>(t), hpx::get<1>(t)))
-                            {
-                                tok.cancel();
-                            }
-                        });
-                    return !tok.was_cancelled();
+                    util::projection_identity proj;
+                    return equal_n<ExPolicy>(it, part_count, tok, f, proj,
+                        proj, is_contiguous_compare<FwdIter1, FwdIter2, F>());
                 };
 
                 return util::partitioner<ExPolicy, bool>::call(
@@ -383,6 +383,7 @@ namespace hpx {
 #include <hpx/execution/algorithms/detail/predicates.hpp>
 #include <hpx/executors/execution_policy.hpp>
 #include <hpx/parallel/algorithms/detail/advance_to_sentinel.hpp>
+#include <hpx/parallel/algorithms/detail/contiguous_compare.hpp>
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
 #include <hpx/parallel/algorithms/detail/distance.hpp>
 #include <hpx/parallel/util/compare_projected.hpp>
@@ -406,8 +407,8 @@ namespace hpx { namespace parallel { inline namespace v1 {
     namespace detail {
 
         template <typename Iter, typename Sent, typename T, typename Proj>
-        constexpr Iter sequential_find(
-            Iter first, Sent last, T const& value, Proj&& proj)
+        constexpr Iter sequential_find(Iter first, Sent last, T const& value,
+            Proj&& proj, std::false_type)
         {
             for (/**/; first != last; ++first)
             {
@@ -419,6 +420,49 @@ namespace hpx { namespace parallel { inline namespace v1 {
             return first;
         }
 
+        // contiguous sequences of bitwise comparable elements
+        template <typename Iter, typename T, typename Proj>
+        Iter sequential_find(
+            Iter first, Iter last, T const& value, Proj&&, std::true_type)
+        {
+            std::size_t count = std::distance(first, last);
+            if (count == 0)
+                return first;
+
+            return first +
+                contiguous_find(contiguous_data(first), count, value);
+        }
+
+        template <typename Iter, typename Sent, typename T, typename Proj>
+        constexpr Iter sequential_find(
+            Iter first, Sent last, T const& value, Proj&& proj)
+        {
+            return sequential_find(first, last, value, std::forward<Proj>(proj),
+                is_contiguous_find<Iter, Sent, T, Proj>());
+        }
+
+        template <typename Iter, typename Token, typename T, typename Proj>
+        void find_idx_n(std::size_t base_idx, Iter it, std::size_t part_size,
+            Token& tok, T const& val, Proj& proj, std::false_type)
+        {
+            using type = typename std::iterator_traits<Iter>::value_type;
+
+            util::loop_idx_n(base_idx, it, part_size, tok,
+                [&val, &proj, &tok](type& v, std::size_t i) -> void {
+                    if (hpx::util::invoke(proj, v) == val)
+                    {
+                        tok.cancel(i);
+                    }
+                });
+        }
+
+        template <typename Iter, typename Token, typename T, typename Proj>
+        void find_idx_n(std::size_t base_idx, Iter it, std::size_t part_size,
+            Token& tok, T const& val, Proj&, std::true_type)
+        {
+            contiguous_find_idx_n(base_idx, it, part_size, tok, val);
+        }
+
         template <typename FwdIter>
         struct find : public detail::algorithm<find<FwdIter>, FwdIter>
         {
@@ -443,7 +487,6 @@ namespace hpx { namespace parallel { inline namespace v1 {
                 Proj&& proj = Proj())
             {
                 typedef util::detail::algorithm_result<ExPolicy, Iter> result;
-                typedef typename std::iterator_traits<Iter>::value_type type;
                 typedef typename std::iterator_traits<Iter>::difference_type
                     difference_type;
 
@@ -456,13 +499,8 @@ namespace hpx { namespace parallel { inline namespace v1 {
                 auto f1 = [val, proj = std::forward<Proj>(proj), tok](Iter it,
                               std::size_t part_size,
                               std::size_t base_idx) mutable -> void {
-                    util::loop_idx_n(base_idx, it, part_size, tok,
-                        [&val, &proj, &tok](type& v, std::size_t i) -> void {
-                            if (hpx::util::invoke(proj, v) == val)
-                            {
-                                tok.cancel(i);
-                            }
-                        });
+                    find_idx_n(base_idx, it, part_size, tok, val, proj,
+                        is_contiguous_find<Iter, Sent, T, Proj>());
                 };
 
                 auto f2 =
@@ -0,0 +1,476 @@
+//  Copyright (c) 2020 STE||AR Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/algorithms/for_loop_nd.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/concepts/concepts.hpp>
+#include <hpx/functional/detail/invoke.hpp>
+#include <hpx/functional/tag_invoke.hpp>
+#include <hpx/modules/executors.hpp>
+#include <hpx/type_support/pack.hpp>
+
+#include <hpx/parallel/algorithms/for_loop.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx {
+    ///////////////////////////////////////////////////////////////////////////
+    /// The order in which the tiles of an N-dimensional index space are
+    /// traversed by \a for_loop_nd. Consecutive tiles are assigned to the
+    /// same task, the space filling curves (Morton and Hilbert order) make
+    /// sure that the tiles handled by one task are close to each other in
+    /// all dimensions.
+    enum class tile_order
+    {
+        row_major,    ///< the last dimension varies fastest
+        morton,       ///< Z-order curve
+        hilbert       ///< Hilbert curve (2-D only, Z-order otherwise)
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// The extents of an N-dimensional index space, the index for dimension
+    /// \a i takes the values [0, extents[i]).
+    template <std::size_t N>
+    struct extents
+    {
+        static_assert(N != 0, "extents must have at least one dimension");
+
+        // clang-format off
+        template <typename... Ts,
+            HPX_CONCEPT_REQUIRES_(
+                sizeof...(Ts) == N &&
+                util::all_of<std::is_integral<Ts>...>::value
+            )>
+        // clang-format on
+        constexpr explicit extents(Ts... sizes)
+          : sizes_{{std::size_t(sizes)...}}
+        {
+        }
+
+        explicit extents(std::array<std::size_t, N> const& sizes)
+          : sizes_(sizes)
+        {
+        }
+
+        constexpr std::size_t operator[](std::size_t i) const
+        {
+            return sizes_[i];
+        }
+
+        /// Return the overall number of points in the index space
+        std::size_t size() const
+        {
+            std::size_t result = 1;
+            for (std::size_t s : sizes_)
+            {
+                result *= s;
+            }
+            return result;
+        }
+
+        std::array<std::size_t, N> sizes_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// The shape of the tiles an N-dimensional index space is split into by
+    /// \a for_loop_nd, together with the order in which the tiles are
+    /// traversed. Each tile is walked in row-major order by a single task,
+    /// its size should be chosen such that the data it touches fits into
+    /// the cache.
+    template <std::size_t N>
+    struct tile_shape
+    {
+        static_assert(N != 0, "tile_shape must have at least one dimension");
+
+        // clang-format off
+        template <typename... Ts,
+            HPX_CONCEPT_REQUIRES_(
+                sizeof...(Ts) == N &&
+                util::all_of<std::is_integral<Ts>...>::value
+            )>
+        // clang-format on
+        constexpr explicit tile_shape(Ts... sizes)
+          : sizes_{{std::size_t(sizes)...}}
+          , order_(tile_order::row_major)
+        {
+        }
+
+        explicit tile_shape(std::array<std::size_t, N> const& sizes,
+            tile_order order = tile_order::row_major)
+          : sizes_(sizes)
+          , order_(order)
+        {
+        }
+
+        constexpr std::size_t operator[](std::size_t i) const
+        {
+            return sizes_[i];
+        }
+
+        std::array<std::size_t, N> sizes_;
+        tile_order order_;
+    };
+
+    namespace parallel { inline namespace v2 {
+        // for_loop_nd
+        namespace detail {
+            /// \cond NOINTERNAL
+
+            ///////////////////////////////////////////////////////////////////
+            // By default, tiles hold about 4096 points, the last (fastest
+            // varying) dimension gets the remainder of the distribution.
+            template <std::size_t N>
+            tile_shape<N> default_tile_shape()
+            {
+                constexpr std::size_t bits = 12;
+
+                std::array<std::size_t, N> sizes;
+                sizes.fill(std::size_t(1) << (bits / N));
+                sizes[N - 1] = std::size_t(1) << (bits - (N - 1) * (bits / N));
+
+                return tile_shape<N>(sizes);
+            }
+
+            ///////////////////////////////////////////////////////////////////
+            // Interleave the bits of the coordinates of a tile
+            template <std::size_t N>
+            std::uint64_t morton_key(std::array<std::size_t, N> const& coords)
+            {
+                constexpr std::size_t bits = 64 / N;
+
+                std::uint64_t key = 0;
+                for (std::size_t b = 0; b != bits; ++b)
+                {
+                    for (std::size_t d = 0; d != N; ++d)
+                    {
+                        std::uint64_t bit = (coords[d] >> b) & 1;
+                        key |= bit << (b * N + (N - 1 - d));
+                    }
+                }
+                return key;
+            }
+
+            // Distance of a tile along the Hilbert curve filling the square
+            // of the given size (which must be a power of two)
+            inline std::uint64_t hilbert_key(
+                std::size_t side, std::size_t x, std::size_t y)
+            {
+                std::uint64_t key = 0;
+                for (std::size_t s = side / 2; s != 0; s /= 2)
+                {
+                    std::size_t rx = (x & s) != 0 ? 1 : 0;
+                    std::size_t ry = (y & s) != 0 ? 1 : 0;
+                    key += std::uint64_t(s) * s * ((3 * rx) ^ ry);
+
+                    // rotate the quadrant
+                    if (ry == 0)
+                    {
+                        if (rx == 1)
+                        {
+                            x = s - 1 - x;
+                            y = s - 1 - y;
+                        }
+                        std::swap(x, y);
+                    }
+                }
+                return key;
+            }
+
+            ///////////////////////////////////////////////////////////////////
+            // Describes the decomposition of the index space into tiles and
+            // the order in which those are traversed
+            template <std::size_t N>
+            struct tile_space
+            {
+                tile_space(extents<N> const& ext, tile_shape<N> const& shape)
+                  : extents_(ext.sizes_)
+                  , shape_(shape.sizes_)
+                  , count_(1)
+                {
+                    for (std::size_t d = 0; d != N; ++d)
+                    {
+                        HPX_ASSERT(shape_[d] != 0);
+                        tiles_[d] = (extents_[d] + shape_[d] - 1) / shape_[d];
+                        count_ *= tiles_[d];
+                    }
+
+                    if (count_ > 1 && shape.order_ != tile_order::row_major)
+                    {
+                        init_order(shape.order_);
+                    }
+                }
+
+                // Return the coordinates of the tile with the given row-major
+                // index
+                std::array<std::size_t, N> coords(std::size_t index) const
+                {
+                    std::array<std::size_t, N> result;
+                    for (std::size_t d = N; d != 0; --d)
+                    {
+                        result[d - 1] = index % tiles_[d - 1];
+                        index /= tiles_[d - 1];
+                    }
+                    return result;
+                }
+
+                // Return the coordinates of the n-th tile to traverse
+                std::array<std::size_t, N> tile(std::size_t n) const
+                {
+                    return coords(order_.empty() ? n : order_[n]);
+                }
+
+                void init_order(tile_order order)
+                {
+                    std::size_t side = 1;
+                    for (std::size_t t : tiles_)
+                    {
+                        while (side < t)
+                            side *= 2;
+                    }
+
+                    std::vector<std::pair<std::uint64_t, std::size_t>> keys;
+                    keys.reserve(count_);
+
+                    for (std::size_t i = 0; i != count_; ++i)
+                    {
+                        std::array<std::size_t, N> c = coords(i);
+                        if (N == 2 && order == tile_order::hilbert)
+                        {
+                            keys.emplace_back(
+                                hilbert_key(side, c[0], c[N - 1]), i);
+                        }
+                        else
+                        {
+                            keys.emplace_back(morton_key<N>(c), i);
+                        }
+                    }
+
+                    std::sort(keys.begin(), keys.end());
+
+                    order_.reserve(count_);
+                    for (auto const& k : keys)
+                    {
+                        order_.push_back(k.second);
+                    }
+                }
+
+                std::array<std::size_t, N> extents_;
+                std::array<std::size_t, N> shape_;
+                std::array<std::size_t, N> tiles_;
+                std::size_t count_;
+                std::vector<std::size_t> order_;
+            };
+
+            ///////////////////////////////////////////////////////////////////
+            // Walk all points [first, last) of one tile in row-major order
+            template <std::size_t D, std::size_t N>
+            struct walk_tile
+            {
+                template <typename F>
+                HPX_FORCEINLINE static void call(F& f,
+                    std::array<std::size_t, N>& idx,
+                    std::array<std::size_t, N> const& first,
+                    std::array<std::size_t, N> const& last)
+                {
+                    for (idx[D] = first[D]; idx[D] != last[D]; ++idx[D])
+                    {
+                        walk_tile<D + 1, N>::call(f, idx, first, last);
+                    }
+                }
+            };
+
+            template <std::size_t N>
+            struct walk_tile<N, N>
+            {
+                template <typename F, std::size_t... Is>
+                HPX_FORCEINLINE static void invoke(F& f,
+                    std::array<std::size_t, N> const& idx,
+                    hpx::util::index_pack<Is...>)
+                {
+                    HPX_INVOKE(f, idx[Is]...);
+                }
+
+                template <typename F>
+                HPX_FORCEINLINE static void call(F& f,
+                    std::array<std::size_t, N>& idx,
+                    std::array<std::size_t, N> const&,
+                    std::array<std::size_t, N> const&)
+                {
+                    invoke(f, idx,
+                        typename hpx::util::make_index_pack<N>::type());
+                }
+            };
+
+            ///////////////////////////////////////////////////////////////////
+            // The function object invoked by for_loop_n for each tile
+            template <typename F, std::size_t N>
+            struct tile_iteration
+            {
+                typedef typename std::decay<F>::type fun_type;
+
+                fun_type f_;
+                std::shared_ptr<tile_space<N> const> space_;
+
+                void operator()(std::size_t n)
+                {
+                    tile_space<N> const& space = *space_;
+                    std::array<std::size_t, N> c = space.tile(n);
+
+                    std::array<std::size_t, N> first, last;
+                    for (std::size_t d = 0; d != N; ++d)
+                    {
+                        first[d] = c[d] * space.shape_[d];
+                        last[d] = (std::min)(
+                            first[d] + space.shape_[d], space.extents_[d]);
+                    }
+
+                    std::array<std::size_t, N> idx;
+                    walk_tile<0, N>::call(f_, idx, first, last);
+                }
+            };
+
+            template <typename ExPolicy, std::size_t N, typename F>
+            typename util::detail::algorithm_result<ExPolicy>::type
+            for_loop_nd(ExPolicy&& policy, extents<N> const& ext,
+                tile_shape<N> const& shape, F&& f)
+            {
+                auto space = std::make_shared<tile_space<N> const>(ext, shape);
+                std::size_t count = space->count_;
+
+                return hpx::for_loop_n(std::forward<ExPolicy>(policy),
+                    std::size_t(0), count,
+                    tile_iteration<F, N>{std::forward<F>(f), std::move(space)});
+            }
+            /// \endcond
+        }    // namespace detail
+    }}       // namespace parallel::v2
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// The for_loop_nd implements loop functionality over an N-dimensional
+    /// index space. The index space is split into tiles of the given shape,
+    /// the tiles are traversed in the order specified by the tile shape, and
+    /// consecutive tiles are handed to the same task. This provides cache
+    /// blocking for stencil-like codes without manual tiling.
+    ///
+    /// The function object \a f is invoked exactly once for each point of
+    /// the index space, with N arguments of type std::size_t representing
+    /// the point's coordinates: f(i0, i1, ..., iN-1). Inside a tile, the
+    /// points are visited in row-major order.
+    ///
+    /// If no tile shape is specified, tiles of about 4096 points are used.
+    /// The chunk size (number of tiles per task) is determined by the
+    /// executor parameters of the execution policy.
+    ///
+    /// \returns  The \a for_loop_nd algorithm returns a \a hpx::future<void>
+    ///           if the execution policy is of type
+    ///           \a hpx::execution::sequenced_task_policy or
+    ///           \a hpx::execution::parallel_task_policy and returns \a void
+    ///           otherwise.
+    ///
+    HPX_INLINE_CONSTEXPR_VARIABLE struct for_loop_nd_t final
+      : hpx::functional::tag<for_loop_nd_t>
+    {
+    private:
+        // clang-format off
+        template <typename ExPolicy, std::size_t N, typename F,
+            HPX_CONCEPT_REQUIRES_(
+                hpx::is_execution_policy<ExPolicy>::value
+            )>
+        // clang-format on
+        friend typename parallel::util::detail::algorithm_result<ExPolicy>::type
+        tag_invoke(hpx::for_loop_nd_t, ExPolicy&& policy,
+            hpx::extents<N> const& ext, hpx::tile_shape<N> const& shape, F&& f)
+        {
+            return parallel::v2::detail::for_loop_nd(
+                std::forward<ExPolicy>(policy), ext, shape, std::forward<F>(f));
+        }
+
+        // clang-format off
+        template <typename ExPolicy, std::size_t N, typename F,
+            HPX_CONCEPT_REQUIRES_(
+                hpx::is_execution_policy<ExPolicy>::value
+            )>
+        // clang-format on
+        friend typename parallel::util::detail::algorithm_result<ExPolicy>::type
+        tag_invoke(hpx::for_loop_nd_t, ExPolicy&& policy,
+            hpx::extents<N> const& ext, F&& f)
+        {
+            return parallel::v2::detail::for_loop_nd(
+                std::forward<ExPolicy>(policy), ext,
+                parallel::v2::detail::default_tile_shape<N>(),
+                std::forward<F>(f));
+        }
+
+        template <std::size_t N, typename F>
+        friend void tag_invoke(hpx::for_loop_nd_t, hpx::extents<N> const& ext,
+            hpx::tile_shape<N> const& shape, F&& f)
+        {
+            return parallel::v2::detail::for_loop_nd(
+                hpx::execution::seq, ext, shape, std::forward<F>(f));
+        }
+
+        template <std::size_t N, typename F>
+        friend void tag_invoke(
+            hpx::for_loop_nd_t, hpx::extents<N> const& ext, F&& f)
+        {
+            return parallel::v2::detail::for_loop_nd(hpx::execution::seq, ext,
+                parallel::v2::detail::default_tile_shape<N>(),
+                std::forward<F>(f));
+        }
+    } for_loop_nd{};
+}    // namespace hpx
+
+#if defined(HPX_HAVE_THREAD_DESCRIPTION)
+namespace hpx { namespace traits {
+    template <typename F, std::size_t N>
+    struct get_function_address<parallel::v2::detail::tile_iteration<F, N>>
+    {
+        static std::size_t call(
+            parallel::v2::detail::tile_iteration<F, N> const& f) noexcept
+        {
+            return get_function_address<typename std::decay<F>::type>::call(
+                f.f_);
+        }
+    };
+
+    template <typename F, std::size_t N>
+    struct get_function_annotation<parallel::v2::detail::tile_iteration<F, N>>
+    {
+        static char const* call(
+            parallel::v2::detail::tile_iteration<F, N> const& f) noexcept
+        {
+            return get_function_annotation<typename std::decay<F>::type>::call(
+                f.f_);
+        }
+    };
+
+#if HPX_HAVE_ITTNOTIFY != 0 && !defined(HPX_HAVE_APEX)
+    template <typename F, std::size_t N>
+    struct get_function_annotation_itt<
+        parallel::v2::detail::tile_iteration<F, N>>
+    {
+        static util::itt::string_handle call(
+            parallel::v2::detail::tile_iteration<F, N> const& f) noexcept
+        {
+            return get_function_annotation_itt<
+                typename std::decay<F>::type>::call(f.f_);
+        }
+    };
+#endif
+}}    // namespace hpx::traits
+#endif
@@ -179,11 +179,13 @@ namespace hpx {
 
 #include <hpx/execution/algorithms/detail/predicates.hpp>
 #include <hpx/executors/execution_policy.hpp>
+#include <hpx/parallel/algorithms/detail/contiguous_compare.hpp>
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
 #include <hpx/parallel/algorithms/detail/distance.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
 #include <hpx/parallel/util/loop.hpp>
 #include <hpx/parallel/util/partitioner.hpp>
+#include <hpx/parallel/util/projection_identity.hpp>
 #include <hpx/parallel/util/result_types.hpp>
 #include <hpx/parallel/util/zip_iterator.hpp>
 
@@ -204,7 +206,7 @@ namespace hpx { namespace parallel { inline namespace v1 {
             typename Sent2, typename F, typename Proj1, typename Proj2>
         util::in_in_result<Iter1, Iter2> sequential_mismatch_binary(
             Iter1 first1, Sent1 last1, Iter2 first2, Sent2 last2, F&& f,
-            Proj1&& proj1, Proj2&& proj2)
+            Proj1&& proj1, Proj2&& proj2, std::false_type)
         {
             while (first1 != last1 && first2 != last2 &&
                 hpx::util::invoke(f, hpx::util::invoke(proj1, *first1),
@@ -215,6 +217,72 @@ namespace hpx { namespace parallel { inline namespace v1 {
             return {first1, first2};
         }
 
+        // contiguous sequences of bitwise comparable elements
+        template <typename Iter1, typename Iter2, typename F, typename Proj1,
+            typename Proj2>
+        util::in_in_result<Iter1, Iter2> sequential_mismatch_binary(
+            Iter1 first1, Iter1 last1, Iter2 first2, Iter2 last2, F&&,
+            Proj1&&, Proj2&&, std::true_type)
+        {
+            std::size_t count = (std::min)(
+                static_cast<std::size_t>(std::distance(first1, last1)),
+                static_cast<std::size_t>(std::distance(first2, last2)));
+            if (count == 0)
+                return {first1, first2};
+
+            std::size_t pos = contiguous_mismatch(
+                contiguous_data(first1), contiguous_data(first2), count);
+            return {first1 + pos, first2 + pos};
+        }
+
+        template <typename Iter1, typename Sent1, typename Iter2,
+            typename Sent2, typename F, typename Proj1, typename Proj2>
+        util::in_in_result<Iter1, Iter2> sequential_mismatch_binary(
+            Iter1 first1, Sent1 last1, Iter2 first2, Sent2 last2, F&& f,
+            Proj1&& proj1, Proj2&& proj2)
+        {
+            using is_contiguous = std::integral_constant<bool,
+                std::is_same<Iter1, Sent1>::value &&
+                    std::is_same<Iter2, Sent2>::value &&
+                    is_contiguous_compare<Iter1, Iter2, F, Proj1,
+                        Proj2>::value>;
+
+            return sequential_mismatch_binary(first1, last1, first2, last2,
+                std::forward<F>(f), std::forward<Proj1>(proj1),
+                std::forward<Proj2>(proj2), is_contiguous());
+        }
+
+        // element-wise comparison of one partition of the zipped sequences
+        template <typename ZipIter, typename Token, typename F,
+            typename Proj1, typename Proj2>
+        void mismatch_idx_n(std::size_t base_idx, ZipIter it,
+            std::size_t part_count, Token& tok, F& f, Proj1& proj1,
+            Proj2& proj2, std::false_type)
+        {
+            using reference = typename ZipIter::reference;
+
+            util::loop_idx_n(base_idx, it, part_count, tok,
+                [&f, &proj1, &proj2, &tok](reference t, std::size_t i) {
+                    if (!hpx::util::invoke(f,
+                            hpx::util::invoke(proj1, hpx::get<0>(t)),
+                            hpx::util::invoke(proj2, hpx::get<1>(t))))
+                    {
+                        tok.cancel(i);
+                    }
+                });
+        }
+
+        template <typename ZipIter, typename Token, typename F,
+            typename Proj1, typename Proj2>
+        void mismatch_idx_n(std::size_t base_idx, ZipIter it,
+            std::size_t part_count, Token& tok, F&, Proj1&, Proj2&,
+            std::true_type)
+        {
+            auto const& iters = it.get_iterator_tuple();
+            contiguous_mismatch_idx_n(base_idx, hpx::get<0>(iters),
+                hpx::get<1>(iters), part_count, tok);
+        }
+
         template <typename IterPair>
         struct mismatch_binary
           : public detail::algorithm<mismatch_binary<IterPair>, IterPair>
@@ -273,7 +341,6 @@ namespace hpx { namespace parallel { inline namespace v1 {
                 }
 
                 typedef hpx::util::zip_iterator<Iter1, Iter2> zip_iterator;
-                typedef typename zip_iterator::reference reference;
 
                 util::cancellation_token<std::size_t> tok(count1);
 
@@ -282,15 +349,10 @@ namespace hpx { namespace parallel { inline namespace v1 {
                               proj2 = std::forward<Proj2>(proj2)](
                               zip_iterator it, std::size_t part_count,
                               std::size_t base_idx) mutable -> void {
-                    util::loop_idx_n(base_idx, it, part_count, tok,
-                        [&f, &proj1, &proj2, &tok](reference t, std::size_t i) {
-                            if (!hpx::util::invoke(f,
-                                    hpx::util::invoke(proj1, hpx::get<0>(t)),
-                                    hpx::util::invoke(proj2, hpx::get<1>(t))))
-                            {
-                                tok.cancel(i);
-                            }
-                        });
+                    mismatch_idx_n(base_idx, it, part_count, tok, f, proj1,
+                        proj2,
+                        is_contiguous_compare<Iter1, Iter2, F, Proj1,
+                            Proj2>());
                 };
 
                 auto f2 = [=](std::vector<hpx::future<void>>&&) mutable
@@ -392,10 +454,32 @@ namespace hpx { namespace parallel { inline namespace v1 {
                 typename F>
             static IterPair sequential(
                 ExPolicy, InIter1 first1, InIter1 last1, InIter2 first2, F&& f)
+            {
+                return sequential_mismatch(first1, last1, first2,
+                    std::forward<F>(f),
+                    is_contiguous_compare<InIter1, InIter2, F>());
+            }
+
+            template <typename InIter1, typename InIter2, typename F>
+            static IterPair sequential_mismatch(InIter1 first1, InIter1 last1,
+                InIter2 first2, F&& f, std::false_type)
             {
                 return std::mismatch(first1, last1, first2, std::forward<F>(f));
             }
 
+            template <typename InIter1, typename InIter2, typename F>
+            static IterPair sequential_mismatch(InIter1 first1, InIter1 last1,
+                InIter2 first2, F&&, std::true_type)
+            {
+                std::size_t count = std::distance(first1, last1);
+                if (count == 0)
+                    return IterPair(first1, first2);
+
+                std::size_t pos = contiguous_mismatch(
+                    contiguous_data(first1), contiguous_data(first2), count);
+                return IterPair(first1 + pos, first2 + pos);
+            }
+
             template <typename ExPolicy, typename FwdIter1, typename FwdIter2,
                 typename F>
             static typename util::detail::algorithm_result<ExPolicy,
@@ -415,21 +499,15 @@ namespace hpx { namespace parallel { inline namespace v1 {
 
                 typedef hpx::util::zip_iterator<FwdIter1, FwdIter2>
                     zip_iterator;
-                typedef typename zip_iterator::reference reference;
 
                 util::cancellation_token<std::size_t> tok(count);
 
                 auto f1 = [tok, f = std::forward<F>(f)](zip_iterator it,
                               std::size_t part_count,
                               std::size_t base_idx) mutable -> void {
-                    util::loop_idx_n(base_idx, it, part_count, tok,
-                        [&f, &tok](reference t, std::size_t i) {
-                            if (!hpx::util::invoke(
-                                    f, hpx::get<0>(t), hpx::get<1>(t)))
-                            {
-                                tok.cancel(i);
-                            }
-                        });
+                    util::projection_identity proj;
+                    mismatch_idx_n(base_idx, it, part_count, tok, f, proj,
+                        proj, is_contiguous_compare<FwdIter1, FwdIter2, F>());
                 };
                 auto f2 = [=](std::vector<hpx::future<void>>&&) mutable
                     -> std::pair<FwdIter1, FwdIter2> {
@@ -0,0 +1,716 @@
+//  Copyright (c) 2020 STE||AR Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/algorithms/reduce_by_key_unsorted.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/concepts/concepts.hpp>
+#include <hpx/execution/executors/execution.hpp>
+#include <hpx/execution/executors/execution_parameters.hpp>
+#include <hpx/execution/executors/static_chunk_size.hpp>
+#include <hpx/functional/deferred_call.hpp>
+#include <hpx/functional/invoke.hpp>
+#include <hpx/iterator_support/traits/is_iterator.hpp>
+
+#include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/for_loop.hpp>
+#include <hpx/parallel/algorithms/reduce_by_key.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/result_types.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace parallel { inline namespace v1 {
+    ///////////////////////////////////////////////////////////////////////////
+    // reduce_by_key_unsorted, group_by
+    namespace detail {
+        /// \cond NOINTERNAL
+
+        // The input is split into one chunk per core, each chunk is
+        // aggregated into its own set of hash tables. Each of those sets is
+        // split into partitions based on the hash value of the keys. All
+        // tables of one partition are merged by a single task, the
+        // partitions are written to consecutive ranges of the output.
+        struct hash_aggregation_shape
+        {
+            template <typename ExPolicy>
+            hash_aggregation_shape(ExPolicy const& policy, std::size_t count)
+              : chunks_(1)
+              , partition_bits_(0)
+            {
+                if (hpx::is_sequenced_execution_policy<ExPolicy>::value)
+                    return;
+
+                std::size_t cores = execution::processing_units_count(
+                    policy.parameters(), policy.executor());
+
+                // avoid creating chunks of less than 1024 elements
+                chunks_ = (std::min)(cores, (count + 1023) / 1024);
+                if (chunks_ == 0)
+                    chunks_ = 1;
+
+                // use about twice as many partitions as chunks to even out
+                // the work of the merge phase
+                while ((std::size_t(1) << partition_bits_) < 2 * chunks_)
+                    ++partition_bits_;
+            }
+
+            std::size_t partitions() const
+            {
+                return std::size_t(1) << partition_bits_;
+            }
+
+            // use the upper bits of the scrambled hash value to select the
+            // partition, the lower bits are used by the hash tables
+            std::size_t partition(std::size_t hash) const
+            {
+                if (partition_bits_ == 0)
+                    return 0;
+
+                return std::size_t((std::uint64_t(hash) *
+                                       std::uint64_t(0x9e3779b97f4a7c15ull)) >>
+                    (64 - partition_bits_));
+            }
+
+            std::size_t chunk_begin(std::size_t chunk, std::size_t count) const
+            {
+                return (count / chunks_) * chunk +
+                    (std::min)(chunk, count % chunks_);
+            }
+
+            std::size_t chunks_;
+            std::size_t partition_bits_;
+        };
+
+        // The hash function is invoked once per element, its result is
+        // reused for selecting the partition and for the hash table lookup.
+        struct precomputed_hash
+        {
+            std::size_t operator()(std::size_t hash) const
+            {
+                return hash;
+            }
+        };
+
+        // A hash table keeping its entries in order of insertion, each key
+        // is represented by the index of its first occurrence.
+        template <typename Entry, typename Compare>
+        struct ordered_hash_table
+        {
+            explicit ordered_hash_table(Compare& comp)
+              : comp_(&comp)
+            {
+            }
+
+            // Return the index of the entry with the same key, if any,
+            // insert the given entry otherwise. The given entry is left
+            // untouched if it was not inserted.
+            template <typename Entry_>
+            std::pair<std::size_t, bool> insert(Entry_&& e)
+            {
+                auto range = buckets_.equal_range(e.hash_);
+                for (auto it = range.first; it != range.second; ++it)
+                {
+                    if (HPX_INVOKE(*comp_, entries_[it->second].key_, e.key_))
+                    {
+                        return std::make_pair(it->second, false);
+                    }
+                }
+
+                std::size_t index = entries_.size();
+                buckets_.emplace(e.hash_, index);
+                entries_.push_back(std::forward<Entry_>(e));
+                return std::make_pair(index, true);
+            }
+
+            Compare* comp_;
+            std::vector<Entry> entries_;
+            std::unordered_multimap<std::size_t, std::size_t,
+                precomputed_hash>
+                buckets_;
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        template <typename Key, typename Value>
+        struct reduce_entry
+        {
+            Key key_;
+            Value value_;
+            std::size_t hash_;
+        };
+
+        template <typename ExPolicy, typename RanIter, typename RanIter2,
+            typename FwdIter1, typename FwdIter2, typename Compare,
+            typename Func, typename Hash>
+        util::in_out_result<FwdIter1, FwdIter2> reduce_by_key_unsorted_impl(
+            ExPolicy&& policy, RanIter key_first, RanIter key_last,
+            RanIter2 values_first, FwdIter1 keys_output, FwdIter2 values_output,
+            Compare&& comp, Func&& func, Hash&& hash)
+        {
+            typedef typename detail::remove_asynchronous<
+                typename std::decay<ExPolicy>::type>::type sync_policy_type;
+
+            typedef typename std::iterator_traits<RanIter>::value_type
+                key_type;
+            typedef typename std::iterator_traits<RanIter2>::value_type
+                value_type;
+            typedef reduce_entry<key_type, value_type> entry_type;
+            typedef typename std::decay<Compare>::type compare_type;
+            typedef ordered_hash_table<entry_type, compare_type> table_type;
+
+            auto sync_policy = sync_policy_type()
+                                   .on(policy.executor())
+                                   .with(policy.parameters());
+
+            std::size_t const count = std::distance(key_first, key_last);
+            hash_aggregation_shape const shape(policy, count);
+            std::size_t const partitions = shape.partitions();
+
+            // one set of partitioned tables for each chunk of the input
+            std::vector<std::vector<table_type>> tables(shape.chunks_);
+            for (auto& t : tables)
+            {
+                t.reserve(partitions);
+                for (std::size_t p = 0; p != partitions; ++p)
+                {
+                    t.emplace_back(comp);
+                }
+            }
+
+            // aggregate each chunk locally
+            hpx::for_loop(sync_policy.with(execution::static_chunk_size(1)),
+                std::size_t(0), shape.chunks_, [&](std::size_t chunk) {
+                    std::vector<table_type>& local = tables[chunk];
+                    std::size_t const end = shape.chunk_begin(chunk + 1, count);
+                    for (std::size_t i = shape.chunk_begin(chunk, count);
+                         i != end; ++i)
+                    {
+                        std::size_t h = HPX_INVOKE(hash, key_first[i]);
+                        table_type& table = local[shape.partition(h)];
+
+                        auto r = table.insert(
+                            entry_type{key_first[i], values_first[i], h});
+                        if (!r.second)
+                        {
+                            value_type& v = table.entries_[r.first].value_;
+                            v = HPX_INVOKE(func, v, values_first[i]);
+                        }
+                    }
+                });
+
+            // merge the tables of each partition into the first chunk
+            std::vector<std::size_t> offsets(partitions + 1, 0);
+            hpx::for_loop(sync_policy, std::size_t(0), partitions,
+                [&](std::size_t p) {
+                    table_type& target = tables[0][p];
+                    for (std::size_t chunk = 1; chunk != shape.chunks_;
+                         ++chunk)
+                    {
+                        for (entry_type& e : tables[chunk][p].entries_)
+                        {
+                            auto r = target.insert(std::move(e));
+                            if (!r.second)
+                            {
+                                value_type& v = target.entries_[r.first].value_;
+                                v = HPX_INVOKE(func, v, std::move(e.value_));
+                            }
+                        }
+                        tables[chunk][p] = table_type(comp);
+                    }
+                    offsets[p + 1] = target.entries_.size();
+                });
+
+            for (std::size_t p = 0; p != partitions; ++p)
+            {
+                offsets[p + 1] += offsets[p];
+            }
+
+            // write out the results of all partitions
+            hpx::for_loop(sync_policy, std::size_t(0), partitions,
+                [&](std::size_t p) {
+                    FwdIter1 keys = std::next(keys_output, offsets[p]);
+                    FwdIter2 values = std::next(values_output, offsets[p]);
+                    for (entry_type& e : tables[0][p].entries_)
+                    {
+                        *keys++ = std::move(e.key_);
+                        *values++ = std::move(e.value_);
+                    }
+                });
+
+            return util::in_out_result<FwdIter1, FwdIter2>{
+                std::next(keys_output, offsets[partitions]),
+                std::next(values_output, offsets[partitions])};
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        template <typename Key>
+        struct group_entry
+        {
+            Key key_;
+            std::size_t hash_;
+            std::vector<std::size_t> indices_;
+        };
+
+        template <typename ExPolicy, typename RanIter, typename RanIter2,
+            typename FwdIter1, typename FwdIter2, typename Compare,
+            typename Hash>
+        util::in_out_result<FwdIter1, FwdIter2> group_by_impl(
+            ExPolicy&& policy, RanIter key_first, RanIter key_last,
+            RanIter2 values_first, FwdIter1 keys_output, FwdIter2 values_output,
+            Compare&& comp, Hash&& hash)
+        {
+            typedef typename detail::remove_asynchronous<
+                typename std::decay<ExPolicy>::type>::type sync_policy_type;
+
+            typedef typename std::iterator_traits<RanIter>::value_type
+                key_type;
+            typedef group_entry<key_type> entry_type;
+            typedef typename std::decay<Compare>::type compare_type;
+            typedef ordered_hash_table<entry_type, compare_type> table_type;
+
+            auto sync_policy = sync_policy_type()
+                                   .on(policy.executor())
+                                   .with(policy.parameters());
+
+            std::size_t const count = std::distance(key_first, key_last);
+            hash_aggregation_shape const shape(policy, count);
+            std::size_t const partitions = shape.partitions();
+
+            std::vector<std::vector<table_type>> tables(shape.chunks_);
+            for (auto& t : tables)
+            {
+                t.reserve(partitions);
+                for (std::size_t p = 0; p != partitions; ++p)
+                {
+                    t.emplace_back(comp);
+                }
+            }
+
+            // collect the element indices of each group for each chunk
+            hpx::for_loop(sync_policy.with(execution::static_chunk_size(1)),
+                std::size_t(0), shape.chunks_, [&](std::size_t chunk) {
+                    std::vector<table_type>& local = tables[chunk];
+                    std::size_t const end = shape.chunk_begin(chunk + 1, count);
+                    for (std::size_t i = shape.chunk_begin(chunk, count);
+                         i != end; ++i)
+                    {
+                        std::size_t h = HPX_INVOKE(hash, key_first[i]);
+                        table_type& table = local[shape.partition(h)];
+
+                        auto r = table.insert(entry_type{
+                            key_first[i], h, std::vector<std::size_t>()});
+                        table.entries_[r.first].indices_.push_back(i);
+                    }
+                });
+
+            // merge the groups of each partition, this keeps the elements of
+            // each group in their original order
+            std::vector<std::size_t> offsets(partitions + 1, 0);
+            hpx::for_loop(sync_policy, std::size_t(0), partitions,
+                [&](std::size_t p) {
+                    table_type& target = tables[0][p];
+                    for (std::size_t chunk = 1; chunk != shape.chunks_;
+                         ++chunk)
+                    {
+                        for (entry_type& e : tables[chunk][p].entries_)
+                        {
+                            auto r = target.insert(std::move(e));
+                            if (!r.second)
+                            {
+                                std::vector<std::size_t>& indices =
+                                    target.entries_[r.first].indices_;
+                                indices.insert(indices.end(),
+                                    e.indices_.begin(), e.indices_.end());
+                            }
+                        }
+                        tables[chunk][p] = table_type(comp);
+                    }
+
+                    std::size_t size = 0;
+                    for (entry_type const& e : target.entries_)
+                    {
+                        size += e.indices_.size();
+                    }
+                    offsets[p + 1] = size;
+                });
+
+            for (std::size_t p = 0; p != partitions; ++p)
+            {
+                offsets[p + 1] += offsets[p];
+            }
+
+            // write out all elements group by group
+            hpx::for_loop(sync_policy, std::size_t(0), partitions,
+                [&](std::size_t p) {
+                    FwdIter1 keys = std::next(keys_output, offsets[p]);
+                    FwdIter2 values = std::next(values_output, offsets[p]);
+                    for (entry_type const& e : tables[0][p].entries_)
+                    {
+                        for (std::size_t i : e.indices_)
+                        {
+                            *keys++ = key_first[i];
+                            *values++ = values_first[i];
+                        }
+                    }
+                });
+
+            return util::in_out_result<FwdIter1, FwdIter2>{
+                std::next(keys_output, count), std::next(values_output, count)};
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // reduce_by_key_unsorted wrapper struct
+        template <typename FwdIter1, typename FwdIter2>
+        struct reduce_by_key_unsorted
+          : public detail::algorithm<
+                reduce_by_key_unsorted<FwdIter1, FwdIter2>,
+                util::in_out_result<FwdIter1, FwdIter2>>
+        {
+            reduce_by_key_unsorted()
+              : reduce_by_key_unsorted::algorithm("reduce_by_key_unsorted")
+            {
+            }
+
+            template <typename ExPolicy, typename RanIter, typename RanIter2,
+                typename Compare, typename Func, typename Hash>
+            static util::in_out_result<FwdIter1, FwdIter2> sequential(
+                ExPolicy&& policy, RanIter key_first, RanIter key_last,
+                RanIter2 values_first, FwdIter1 keys_output,
+                FwdIter2 values_output, Compare&& comp, Func&& func,
+                Hash&& hash)
+            {
+                return reduce_by_key_unsorted_impl(
+                    std::forward<ExPolicy>(policy), key_first, key_last,
+                    values_first, keys_output, values_output,
+                    std::forward<Compare>(comp), std::forward<Func>(func),
+                    std::forward<Hash>(hash));
+            }
+
+            template <typename ExPolicy, typename RanIter, typename RanIter2,
+                typename Compare, typename Func, typename Hash>
+            static typename util::detail::algorithm_result<ExPolicy,
+                util::in_out_result<FwdIter1, FwdIter2>>::type
+            parallel(ExPolicy&& policy, RanIter key_first, RanIter key_last,
+                RanIter2 values_first, FwdIter1 keys_output,
+                FwdIter2 values_output, Compare&& comp, Func&& func,
+                Hash&& hash)
+            {
+                return util::detail::algorithm_result<ExPolicy,
+                    util::in_out_result<FwdIter1, FwdIter2>>::
+                    get(execution::async_execute(policy.executor(),
+                        hpx::util::deferred_call(
+                            &hpx::parallel::v1::detail::
+                                reduce_by_key_unsorted_impl<
+                                    typename std::decay<ExPolicy>::type&&,
+                                    RanIter, RanIter2, FwdIter1, FwdIter2,
+                                    typename std::decay<Compare>::type&&,
+                                    typename std::decay<Func>::type&&,
+                                    typename std::decay<Hash>::type&&>,
+                            policy, key_first, key_last, values_first,
+                            keys_output, values_output,
+                            std::forward<Compare>(comp),
+                            std::forward<Func>(func),
+                            std::forward<Hash>(hash))));
+            }
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        // group_by wrapper struct
+        template <typename FwdIter1, typename FwdIter2>
+        struct group_by
+          : public detail::algorithm<group_by<FwdIter1, FwdIter2>,
+                util::in_out_result<FwdIter1, FwdIter2>>
+        {
+            group_by()
+              : group_by::algorithm("group_by")
+            {
+            }
+
+            template <typename ExPolicy, typename RanIter, typename RanIter2,
+                typename Compare, typename Hash>
+            static util::in_out_result<FwdIter1, FwdIter2> sequential(
+                ExPolicy&& policy, RanIter key_first, RanIter key_last,
+                RanIter2 values_first, FwdIter1 keys_output,
+                FwdIter2 values_output, Compare&& comp, Hash&& hash)
+            {
+                return group_by_impl(std::forward<ExPolicy>(policy), key_first,
+                    key_last, values_first, keys_output, values_output,
+                    std::forward<Compare>(comp), std::forward<Hash>(hash));
+            }
+
+            template <typename ExPolicy, typename RanIter, typename RanIter2,
+                typename Compare, typename Hash>
+            static typename util::detail::algorithm_result<ExPolicy,
+                util::in_out_result<FwdIter1, FwdIter2>>::type
+            parallel(ExPolicy&& policy, RanIter key_first, RanIter key_last,
+                RanIter2 values_first, FwdIter1 keys_output,
+                FwdIter2 values_output, Compare&& comp, Hash&& hash)
+            {
+                return util::detail::algorithm_result<ExPolicy,
+                    util::in_out_result<FwdIter1, FwdIter2>>::
+                    get(execution::async_execute(policy.executor(),
+                        hpx::util::deferred_call(
+                            &hpx::parallel::v1::detail::group_by_impl<
+                                typename std::decay<ExPolicy>::type&&,
+                                RanIter, RanIter2, FwdIter1, FwdIter2,
+                                typename std::decay<Compare>::type&&,
+                                typename std::decay<Hash>::type&&>,
+                            policy, key_first, key_last, values_first,
+                            keys_output, values_output,
+                            std::forward<Compare>(comp),
+                            std::forward<Hash>(hash))));
+            }
+        };
+        /// \endcond
+    }    // namespace detail
+
+    //-----------------------------------------------------------------------------
+    /// Reduce by Key Unsorted performs a reduction operation on elements
+    /// supplied in key/value pairs. Unlike \a reduce_by_key, the keys do not
+    /// have to be sorted: the algorithm produces a single output value for
+    /// each set of equal keys in [key_first, key_last), the value being the
+    /// GENERALIZED_SUM(func, ...) of all values associated with that key.
+    /// The number of keys supplied must match the number of values.
+    ///
+    /// The keys are aggregated into hash tables which are local to each
+    /// task, those are partitioned by the hash values of the keys and merged
+    /// in parallel, one task per partition. No sorting takes place.
+    ///
+    /// \note   Complexity: O(\a key_last - \a key_first) applications of
+    ///         the functions \a hash and \a func, and on average
+    ///         O(\a key_last - \a key_first) applications of \a comp.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it applies user-provided function objects.
+    /// \tparam RanIter     The type of the key iterators used (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     random access iterator.
+    /// \tparam RanIter2    The type of the value iterators used (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     random access iterator.
+    /// \tparam FwdIter1    The type of the iterator representing the
+    ///                     destination key range (deduced).
+    ///                     This iterator type must meet the requirements of an
+    ///                     forward iterator.
+    /// \tparam FwdIter2    The type of the iterator representing the
+    ///                     destination value range (deduced).
+    ///                     This iterator type must meet the requirements of an
+    ///                     forward iterator.
+    /// \tparam Compare     The type of the optional function/function object to use
+    ///                     to compare keys for equality (deduced).
+    ///                     Assumed to be std::equal_to otherwise.
+    /// \tparam Func        The type of the function/function object to use
+    ///                     for the reduction (deduced). Assumed to be
+    ///                     std::plus otherwise.
+    /// \tparam Hash        The type of the function/function object to use
+    ///                     to hash the keys (deduced). Assumed to be
+    ///                     std::hash otherwise.
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param key_first    Refers to the beginning of the sequence of key elements
+    ///                     the algorithm will be applied to.
+    /// \param key_last     Refers to the end of the sequence of key elements the
+    ///                     algorithm will be applied to.
+    /// \param values_first Refers to the beginning of the sequence of value elements
+    ///                     the algorithm will be applied to.
+    /// \param keys_output  Refers to the start output location for the keys
+    ///                     produced by the algorithm.
+    /// \param values_output Refers to the start output location for the values
+    ///                     produced by the algorithm.
+    /// \param comp         comp is a callable object. The return value of the
+    ///                     INVOKE operation applied to an object of type Comp,
+    ///                     when contextually converted to bool, yields true if
+    ///                     the two arguments of the call are equal, and false
+    ///                     otherwise.
+    /// \param func         Specifies the function (or function object) used
+    ///                     to combine two values associated with the same key.
+    ///                     The signature of this function should be
+    ///                     equivalent to:
+    ///                     \code
+    ///                     Ret fun(const Type1 &a, const Type1 &b);
+    ///                     \endcode \n
+    ///                     The signature does not need to have const&.
+    /// \param hash         Specifies the function (or function object) used
+    ///                     to compute the hash values of the keys. Keys which
+    ///                     compare equal must have the same hash value.
+    ///
+    /// \a func has to be associative and commutative, as the values of a key
+    /// are combined in an unspecified order when invoked with a parallel
+    /// execution policy.
+    ///
+    /// The order of the keys in the output is unspecified. When invoked with
+    /// a sequential execution policy, the keys are written in the order of
+    /// their first occurrence.
+    ///
+    /// The application of function objects in parallel algorithm
+    /// invoked with an execution policy object of type
+    /// \a sequenced_policy execute in sequential order in the
+    /// calling thread.
+    ///
+    /// The application of function objects in parallel algorithm
+    /// invoked with an execution policy object of type
+    /// \a parallel_policy or \a parallel_task_policy are
+    /// permitted to execute in an unordered fashion in unspecified
+    /// threads, and indeterminately sequenced within each thread.
+    ///
+    /// \returns  The \a reduce_by_key_unsorted algorithm returns a
+    ///           \a hpx::future<in_out_result<FwdIter1,FwdIter2>> if the
+    ///           execution policy is of type \a sequenced_task_policy or
+    ///           \a parallel_task_policy and returns
+    ///           \a in_out_result<FwdIter1,FwdIter2> otherwise. The result
+    ///           refers to the end of the written key and value ranges.
+    //-----------------------------------------------------------------------------
+    template <typename ExPolicy, typename RanIter, typename RanIter2,
+        typename FwdIter1, typename FwdIter2,
+        typename Compare =
+            std::equal_to<typename std::iterator_traits<RanIter>::value_type>,
+        typename Func =
+            std::plus<typename std::iterator_traits<RanIter2>::value_type>,
+        typename Hash =
+            std::hash<typename std::iterator_traits<RanIter>::value_type>,
+        HPX_CONCEPT_REQUIRES_(hpx::is_execution_policy<ExPolicy>::value&&
+                hpx::traits::is_iterator<RanIter>::value&&
+                    hpx::traits::is_iterator<RanIter2>::value&&
+                        hpx::traits::is_iterator<FwdIter1>::value&&
+                            hpx::traits::is_iterator<FwdIter2>::value)>
+    typename util::detail::algorithm_result<ExPolicy,
+        util::in_out_result<FwdIter1, FwdIter2>>::type
+    reduce_by_key_unsorted(ExPolicy&& policy, RanIter key_first,
+        RanIter key_last, RanIter2 values_first, FwdIter1 keys_output,
+        FwdIter2 values_output, Compare&& comp = Compare(),
+        Func&& func = Func(), Hash&& hash = Hash())
+    {
+        static_assert(
+            (hpx::traits::is_random_access_iterator<RanIter>::value) &&
+                (hpx::traits::is_random_access_iterator<RanIter2>::value) &&
+                (hpx::traits::is_forward_iterator<FwdIter1>::value) &&
+                (hpx::traits::is_forward_iterator<FwdIter2>::value),
+            "iterators : Random_access for inputs and forward for outputs.");
+
+        typedef hpx::is_sequenced_execution_policy<ExPolicy> is_seq;
+
+        return detail::reduce_by_key_unsorted<FwdIter1, FwdIter2>().call(
+            std::forward<ExPolicy>(policy), is_seq(), key_first, key_last,
+            values_first, keys_output, values_output,
+            std::forward<Compare>(comp), std::forward<Func>(func),
+            std::forward<Hash>(hash));
+    }
+
+    //-----------------------------------------------------------------------------
+    /// Group by reorders the key/value pairs supplied in [key_first,
+    /// key_last) and [values_first, ...) such that all pairs with equal keys
+    /// are written to adjacent positions of the output ranges. The relative
+    /// order of the pairs with equal keys is preserved, the order of the
+    /// groups is unspecified. When invoked with a sequential execution
+    /// policy, the groups are written in the order of the first occurrence of
+    /// their key.
+    ///
+    /// The output is suitable as the input of \a reduce_by_key or
+    /// \a sort_by_key, which require equal keys to be adjacent. The
+    /// grouping is based on hashing and does not sort the keys.
+    ///
+    /// \note   Complexity: O(\a key_last - \a key_first) applications of
+    ///         the function \a hash, and on average
+    ///         O(\a key_last - \a key_first) applications of \a comp.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it applies user-provided function objects.
+    /// \tparam RanIter     The type of the key iterators used (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     random access iterator.
+    /// \tparam RanIter2    The type of the value iterators used (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     random access iterator.
+    /// \tparam FwdIter1    The type of the iterator representing the
+    ///                     destination key range (deduced).
+    ///                     This iterator type must meet the requirements of an
+    ///                     forward iterator.
+    /// \tparam FwdIter2    The type of the iterator representing the
+    ///                     destination value range (deduced).
+    ///                     This iterator type must meet the requirements of an
+    ///                     forward iterator.
+    /// \tparam Compare     The type of the optional function/function object to use
+    ///                     to compare keys for equality (deduced).
+    ///                     Assumed to be std::equal_to otherwise.
+    /// \tparam Hash        The type of the function/function object to use
+    ///                     to hash the keys (deduced). Assumed to be
+    ///                     std::hash otherwise.
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param key_first    Refers to the beginning of the sequence of key elements
+    ///                     the algorithm will be applied to.
+    /// \param key_last     Refers to the end of the sequence of key elements the
+    ///                     algorithm will be applied to.
+    /// \param values_first Refers to the beginning of the sequence of value elements
+    ///                     the algorithm will be applied to.
+    /// \param keys_output  Refers to the start output location for the keys
+    ///                     produced by the algorithm.
+    /// \param values_output Refers to the start output location for the values
+    ///                     produced by the algorithm.
+    /// \param comp         comp is a callable object. The return value of the
+    ///                     INVOKE operation applied to an object of type Comp,
+    ///                     when contextually converted to bool, yields true if
+    ///                     the two arguments of the call are equal, and false
+    ///                     otherwise.
+    /// \param hash         Specifies the function (or function object) used
+    ///                     to compute the hash values of the keys. Keys which
+    ///                     compare equal must have the same hash value.
+    ///
+    /// \returns  The \a group_by algorithm returns a
+    ///           \a hpx::future<in_out_result<FwdIter1,FwdIter2>> if the
+    ///           execution policy is of type \a sequenced_task_policy or
+    ///           \a parallel_task_policy and returns
+    ///           \a in_out_result<FwdIter1,FwdIter2> otherwise. The result
+    ///           refers to the end of the written key and value ranges.
+    //-----------------------------------------------------------------------------
+    template <typename ExPolicy, typename RanIter, typename RanIter2,
+        typename FwdIter1, typename FwdIter2,
+        typename Compare =
+            std::equal_to<typename std::iterator_traits<RanIter>::value_type>,
+        typename Hash =
+            std::hash<typename std::iterator_traits<RanIter>::value_type>,
+        HPX_CONCEPT_REQUIRES_(hpx::is_execution_policy<ExPolicy>::value&&
+                hpx::traits::is_iterator<RanIter>::value&&
+                    hpx::traits::is_iterator<RanIter2>::value&&
+                        hpx::traits::is_iterator<FwdIter1>::value&&
+                            hpx::traits::is_iterator<FwdIter2>::value)>
+    typename util::detail::algorithm_result<ExPolicy,
+        util::in_out_result<FwdIter1, FwdIter2>>::type
+    group_by(ExPolicy&& policy, RanIter key_first, RanIter key_last,
+        RanIter2 values_first, FwdIter1 keys_output, FwdIter2 values_output,
+        Compare&& comp = Compare(), Hash&& hash = Hash())
+    {
+        static_assert(
+            (hpx::traits::is_random_access_iterator<RanIter>::value) &&
+                (hpx::traits::is_random_access_iterator<RanIter2>::value) &&
+                (hpx::traits::is_forward_iterator<FwdIter1>::value) &&
+                (hpx::traits::is_forward_iterator<FwdIter2>::value),
+            "iterators : Random_access for inputs and forward for outputs.");
+
+        typedef hpx::is_sequenced_execution_policy<ExPolicy> is_seq;
+
+        return detail::group_by<FwdIter1, FwdIter2>().call(
+            std::forward<ExPolicy>(policy), is_seq(), key_first, key_last,
+            values_first, keys_output, values_output,
+            std::forward<Compare>(comp), std::forward<Hash>(hash));
+    }
+}}}    // namespace hpx::parallel::v1
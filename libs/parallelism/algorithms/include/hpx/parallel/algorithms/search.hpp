@@ -212,9 +212,10 @@ namespace hpx {
     ///           the last subsequence [s_first, s_last) in range [first, first+count).
     ///           If the length of the subsequence [s_first, s_last) is greater
     ///           than the length of the range [first, first+count),
-    ///           \a first is returned.
-    ///           Additionally if the size of the subsequence is empty or no subsequence
-    ///           is found, \a first is also returned.
+    ///           \a first+count is returned.
+    ///           Additionally if the size of the subsequence is empty \a first is
+    ///           returned. If no subsequence is found, \a first+count is
+    ///           returned.
     ///
     template <typename FwdIter, typename FwdIter2,
         typename Pred = detail::equal_to>
@@ -287,9 +288,10 @@ namespace hpx {
     ///           the last subsequence [s_first, s_last) in range [first, first+count).
     ///           If the length of the subsequence [s_first, s_last) is greater
     ///           than the length of the range [first, first+count),
-    ///           \a first is returned.
-    ///           Additionally if the size of the subsequence is empty or no subsequence
-    ///           is found, \a first is also returned.
+    ///           \a first+count is returned.
+    ///           Additionally if the size of the subsequence is empty \a first is
+    ///           returned. If no subsequence is found, \a first+count is
+    ///           returned.
     ///
     template <typename ExPolicy, typename FwdIter, typename FwdIter2,
         typename Pred = detail::equal_to>
@@ -430,9 +430,10 @@ namespace hpx { namespace ranges {
     ///           the last subsequence [s_first, s_last) in range [first, first+count).
     ///           If the length of the subsequence [s_first, s_last) is greater
     ///           than the length of the range [first, first+count),
-    ///           \a first is returned.
-    ///           Additionally if the size of the subsequence is empty or no subsequence
-    ///           is found, \a first is also returned.
+    ///           \a first+count is returned.
+    ///           Additionally if the size of the subsequence is empty \a first is
+    ///           returned. If no subsequence is found, \a first+count is
+    ///           returned.
     ///
     template <typename FwdIter, typename FwdIter2, typename Sent2,
         typename Pred = hpx::ranges::equal_to,
@@ -520,9 +521,10 @@ namespace hpx { namespace ranges {
     ///           the last subsequence [s_first, s_last) in range [first, first+count).
     ///           If the length of the subsequence [s_first, s_last) is greater
     ///           than the length of the range [first, first+count),
-    ///           \a first is returned.
-    ///           Additionally if the size of the subsequence is empty or no subsequence
-    ///           is found, \a first is also returned.
+    ///           \a first+count is returned.
+    ///           Additionally if the size of the subsequence is empty \a first is
+    ///           returned. If no subsequence is found, \a first+count is
+    ///           returned.
     ///
     template <typename ExPolicy, typename FwdIter, typename FwdIter2,
         typename Sent2, typename Pred = hpx::ranges::equal_to,
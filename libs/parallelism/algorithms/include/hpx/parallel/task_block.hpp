@@ -13,6 +13,10 @@
 #include <hpx/async_local/dataflow.hpp>
 #include <hpx/functional/bind.hpp>
 #include <hpx/functional/bind_back.hpp>
+#include <hpx/functional/bind_front.hpp>
+#include <hpx/functional/deferred_call.hpp>
+#include <hpx/functional/one_shot.hpp>
+#include <hpx/functional/unique_function.hpp>
 #include <hpx/futures/future.hpp>
 #include <hpx/futures/traits/is_future.hpp>
 #include <hpx/modules/errors.hpp>
@@ -22,9 +26,11 @@
 #include <hpx/executors/exception_list.hpp>
 #include <hpx/executors/execution_policy.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/detail/work_first_frames.hpp>
 
 #include <memory>    // std::addressof
 
+#include <cstddef>
 #include <exception>
 #include <mutex>
 #include <type_traits>
@@ -32,28 +38,23 @@
 #include <vector>
 
 namespace hpx { namespace parallel { inline namespace v2 {
-    namespace detail {
-        /// \cond NOINTERNAL
-        ///////////////////////////////////////////////////////////////////////
-        inline void handle_task_block_exceptions(
-            parallel::exception_list& errors)
-        {
-            try
-            {
-                std::rethrow_exception(std::current_exception());
-            }
-            catch (parallel::exception_list const& el)
-            {
-                for (std::exception_ptr const& e : el)
-                    errors.add(e);
-            }
-            catch (...)
-            {
-                errors.add(std::current_exception());
-            }
-        }
-        /// \endcond
-    }    // namespace detail
+    /// The execution modes supported by a \a task_block
+    enum class task_block_mode
+    {
+        /// Each invocation of \a task_block::run schedules a new task right
+        /// away (help-first). This is the default.
+        help_first,
+
+        /// Invocations of \a task_block::run record the function in the
+        /// task block instead of scheduling a new task. Idle worker threads
+        /// steal the oldest recorded functions, all functions which were not
+        /// stolen are executed by the thread waiting for the task block,
+        /// newest first. No tasks are created as long as all worker threads
+        /// are busy. For asynchronous execution policies the functions
+        /// remaining at the end of the task block are executed by a new
+        /// task, define_task_block does not block.
+        work_first
+    };
 
     /// The class \a task_canceled_exception defines the type of objects thrown
     /// by task_block::run or task_block::wait if they detect
@@ -121,11 +122,13 @@ namespace hpx { namespace parallel { inline namespace v2 {
 
         template <typename ExPolicy_, typename F>
         friend typename util::detail::algorithm_result<ExPolicy_>::type
-        define_task_block(ExPolicy_&&, F&&);
+        define_task_block(ExPolicy_&&, task_block_mode, F&&);
 
-        explicit task_block(ExPolicy const& policy = ExPolicy())
+        explicit task_block(ExPolicy const& policy = ExPolicy(),
+            task_block_mode mode = task_block_mode::help_first)
           : id_(threads::get_self_id())
           , policy_(policy)
+          , mode_(mode)
         {
         }
 
@@ -169,6 +172,22 @@ namespace hpx { namespace parallel { inline namespace v2 {
                 throw std::forward<parallel::exception_list>(errors);
         }
 
+        // execute the functions recorded in work_first mode which were not
+        // stolen, returns all errors of the task block
+        static parallel::exception_list drain_frames(
+            std::shared_ptr<detail::work_first_frames> const& frames,
+            parallel::exception_list&& errors)
+        {
+            frames->drain(errors);
+            return std::move(errors);
+        }
+
+        static void on_drained(hpx::future<parallel::exception_list>&& errors,
+            std::vector<hpx::future<void>>&& results)
+        {
+            on_ready(std::move(results), errors.get());
+        }
+
         // return future representing the execution of all tasks
         typename util::detail::algorithm_result<ExPolicy>::type when(
             bool throw_on_error = false)
@@ -184,11 +203,43 @@ namespace hpx { namespace parallel { inline namespace v2 {
 
             typedef util::detail::algorithm_result<ExPolicy> result;
 
+            if (frames_)
+            {
+                // the final join of a task block created with an
+                // asynchronous execution policy does not block, the
+                // recorded functions are executed by a new task which keeps
+                // the frames alive
+                if (throw_on_error &&
+                    hpx::is_async_execution_policy<ExPolicy>::value)
+                {
+                    hpx::future<parallel::exception_list> drained =
+                        execution::async_execute(policy_.executor(),
+                            hpx::util::one_shot(hpx::util::bind_front(
+                                &task_block::drain_frames, std::move(frames_),
+                                std::move(errors))));
+
+                    return result::get(hpx::dataflow(&task_block::on_drained,
+                        std::move(drained), std::move(tasks)));
+                }
+
+                frames_->drain(errors);
+            }
+
             if (tasks.empty() && errors.size() == 0)
                 return result::get();
 
             if (!throw_on_error)
+            {
+                // errors of the recorded functions are reported once the
+                // task block is complete
+                if (errors.size() != 0)
+                {
+                    std::lock_guard<mutex_type> l(mtx_);
+                    for (std::exception_ptr const& e : errors)
+                        errors_.add(e);
+                }
                 return result::get(hpx::when_all(tasks));
+            }
 
             return result::get(
                 hpx::dataflow(hpx::util::one_shot(hpx::util::bind_back(
@@ -209,6 +260,12 @@ namespace hpx { namespace parallel { inline namespace v2 {
             return policy_;
         }
 
+        /// Return the execution mode this \a task_block was created with
+        task_block_mode get_mode() const
+        {
+            return mode_;
+        }
+
         /// Causes the expression f() to be invoked asynchronously.
         /// The invocation of f is permitted to run on an unspecified thread
         /// in an unordered fashion relative to the sequence of operations
@@ -236,6 +293,11 @@ namespace hpx { namespace parallel { inline namespace v2 {
         ///       available. \a run might or might not return before invocation
         ///       of f completes.
         ///
+        ///       If the \a task_block was created in
+        ///       \a task_block_mode::work_first, f is recorded in the
+        ///       \a task_block and is executed by an idle worker thread or,
+        ///       if none became available, by the next invocation of wait.
+        ///
         /// \throw This function may throw \a task_canceled_exception, as
         ///        described in Exception Handling.
         ///
@@ -250,6 +312,25 @@ namespace hpx { namespace parallel { inline namespace v2 {
                     "the task_block is not active");
             }
 
+            if (mode_ == task_block_mode::work_first)
+            {
+                if (!frames_)
+                {
+                    frames_ = std::make_shared<detail::work_first_frames>();
+                }
+                frames_->push(hpx::util::deferred_call(
+                    std::forward<F>(f), std::forward<Ts>(ts)...));
+
+                // make sure an idle worker thread will look for the frame
+                if (!hpx::is_sequenced_execution_policy<ExPolicy>::value &&
+                    detail::acquire_task_block_agent())
+                {
+                    execution::post(
+                        policy_.executor(), &detail::run_task_block_agent);
+                }
+                return;
+            }
+
             hpx::future<void> result =
                 execution::async_execute(policy_.executor(), std::forward<F>(f),
                     std::forward<Ts>(ts)...);
@@ -373,6 +454,10 @@ namespace hpx { namespace parallel { inline namespace v2 {
         parallel::exception_list errors_;
         threads::thread_id_type id_;
         ExPolicy policy_;
+        task_block_mode mode_;
+
+        // the functions recorded in work_first mode
+        std::shared_ptr<detail::work_first_frames> frames_;
     };
 
     /// Constructs a \a task_block, \a tr, using the given execution policy
@@ -387,6 +472,8 @@ namespace hpx { namespace parallel { inline namespace v2 {
     ///
     /// \param policy       The execution policy to use for the scheduling of
     ///                     the iterations.
+    /// \param mode         The execution mode of the task block, see
+    ///                     \a task_block_mode.
     /// \param f    The user defined function to invoke inside the task block.
     ///             Given an lvalue \a tr of type \a task_block, the
     ///             expression, (void)f(tr), shall be well-formed.
@@ -402,13 +489,13 @@ namespace hpx { namespace parallel { inline namespace v2 {
     ///
     template <typename ExPolicy, typename F>
     typename util::detail::algorithm_result<ExPolicy>::type define_task_block(
-        ExPolicy&& policy, F&& f)
+        ExPolicy&& policy, task_block_mode mode, F&& f)
     {
         static_assert(hpx::is_execution_policy<ExPolicy>::value,
             "hpx::is_execution_policy<ExPolicy>::value");
 
         typedef typename std::decay<ExPolicy>::type policy_type;
-        task_block<policy_type> trh(std::forward<ExPolicy>(policy));
+        task_block<policy_type> trh(std::forward<ExPolicy>(policy), mode);
 
         // invoke the user supplied function
         try
@@ -425,6 +512,39 @@ namespace hpx { namespace parallel { inline namespace v2 {
         return trh.when(true);
     }
 
+    /// Constructs a \a task_block, \a tr, using the given execution policy
+    /// \a policy, and invokes the expression
+    /// \a f(tr) on the user-provided object, \a f.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the task block may be parallelized.
+    /// \tparam F   The type of the user defined function to invoke inside the
+    ///             define_task_block (deduced). \a F shall be MoveConstructible.
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param f    The user defined function to invoke inside the task block.
+    ///             Given an lvalue \a tr of type \a task_block, the
+    ///             expression, (void)f(tr), shall be well-formed.
+    ///
+    /// Postcondition: All tasks spawned from \a f have finished execution.
+    ///                A call to define_task_block may return on a different
+    ///                thread than that on which it was called.
+    ///
+    /// \throws An \a exception_list, as specified in Exception Handling.
+    ///
+    /// \note It is expected (but not mandated) that f will (directly or
+    ///       indirectly) call tr.run(_callable_object_).
+    ///
+    template <typename ExPolicy, typename F>
+    typename util::detail::algorithm_result<ExPolicy>::type define_task_block(
+        ExPolicy&& policy, F&& f)
+    {
+        return define_task_block(std::forward<ExPolicy>(policy),
+            task_block_mode::help_first, std::forward<F>(f));
+    }
+
     /// Constructs a \a task_block, tr, and invokes the expression
     /// \a f(tr) on the user-provided object, \a f. This version uses
     /// \a parallel_policy for task scheduling.
@@ -0,0 +1,91 @@
+//  Copyright (c) 2020 STE||AR Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/executors/exception_list.hpp>
+#include <hpx/functional/unique_function.hpp>
+#include <hpx/synchronization/condition_variable.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+
+#include <cstddef>
+#include <exception>
+#include <vector>
+
+namespace hpx { namespace parallel { inline namespace v2 {
+    namespace detail {
+        /// \cond NOINTERNAL
+        ///////////////////////////////////////////////////////////////////////
+        inline void handle_task_block_exceptions(
+            parallel::exception_list& errors)
+        {
+            try
+            {
+                std::rethrow_exception(std::current_exception());
+            }
+            catch (parallel::exception_list const& el)
+            {
+                for (std::exception_ptr const& e : el)
+                    errors.add(e);
+            }
+            catch (...)
+            {
+                errors.add(std::current_exception());
+            }
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // The functions recorded by a task_block operating in work_first
+        // mode. This is embedded into the task_block itself, which lives on
+        // the stack of define_task_block.
+        struct HPX_EXPORT work_first_frames
+        {
+            using mutex_type = hpx::lcos::local::spinlock;
+            using function_type = hpx::util::unique_function_nonser<void()>;
+
+            work_first_frames() = default;
+            ~work_first_frames();
+
+            work_first_frames(work_first_frames const&) = delete;
+            work_first_frames& operator=(work_first_frames const&) = delete;
+
+            // Record the given function and make it available for stealing
+            void push(function_type&& f);
+
+            // Execute all recorded functions which were not stolen, newest
+            // first, and wait for the stolen functions to finish
+            void drain(parallel::exception_list& errors);
+
+            // Called by an idle worker thread after having executed a stolen
+            // function, this is the last access to the frames
+            void stolen_done(std::exception_ptr&& e);
+
+            mutex_type mtx_;
+            std::vector<function_type> frames_;
+            std::size_t head_ = 0;    // next function to be stolen
+            std::vector<std::exception_ptr> stolen_errors_;
+
+            // the number of stolen functions still running, drain waits for
+            // this to drop to zero
+            std::size_t stolen_ = 0;
+            hpx::lcos::local::condition_variable_any stolen_cond_;
+
+            // linkage used by the list of frames available for stealing
+            std::size_t shard_ = std::size_t(-1);
+            work_first_frames* prev_ = nullptr;
+            work_first_frames* next_ = nullptr;
+        };
+
+        // Reserve one of the agents looking for frames to steal, returns
+        // false if all agents are already busy or waiting to be scheduled
+        HPX_EXPORT bool acquire_task_block_agent();
+
+        // Steal and execute recorded functions until there is nothing left
+        HPX_EXPORT void run_task_block_agent();
+        /// \endcond
+    }    // namespace detail
+}}}    // namespace hpx::parallel::v2
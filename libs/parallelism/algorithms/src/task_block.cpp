@@ -0,0 +1,254 @@
+//  Copyright (c) 2020 STE||AR Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/parallel/util/detail/work_first_frames.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+#include <hpx/threading_base/thread_num_tss.hpp>
+#include <hpx/topology/topology.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace parallel { inline namespace v2 { namespace detail {
+    ///////////////////////////////////////////////////////////////////////////
+    namespace {
+        // All frames holding functions available for stealing, split into
+        // one list per core to reduce contention
+        struct frames_list
+        {
+            hpx::lcos::local::spinlock mtx_;
+            work_first_frames* head_ = nullptr;
+            work_first_frames* tail_ = nullptr;
+        };
+
+        struct frames_registry
+        {
+            frames_registry()
+              : lists_(hpx::threads::hardware_concurrency())
+              , max_agents_(lists_.size())
+              , agents_(0)
+            {
+            }
+
+            std::vector<hpx::util::cache_aligned_data<frames_list>> lists_;
+
+            // the number of agents which are running or waiting to be
+            // scheduled
+            std::size_t const max_agents_;
+            std::atomic<std::size_t> agents_;
+        };
+
+        frames_registry& get_frames_registry()
+        {
+            static frames_registry registry;
+            return registry;
+        }
+
+        void register_frames(work_first_frames& frames)
+        {
+            frames_registry& registry = get_frames_registry();
+            std::size_t shard =
+                hpx::get_worker_thread_num() % registry.lists_.size();
+            frames_list& list = registry.lists_[shard].data_;
+
+            std::lock_guard<hpx::lcos::local::spinlock> l(list.mtx_);
+
+            // older frames are stolen first, append at the end
+            frames.shard_ = shard;
+            frames.prev_ = list.tail_;
+            frames.next_ = nullptr;
+            if (list.tail_ != nullptr)
+                list.tail_->next_ = &frames;
+            else
+                list.head_ = &frames;
+            list.tail_ = &frames;
+        }
+
+        void unregister_frames(work_first_frames& frames)
+        {
+            frames_registry& registry = get_frames_registry();
+            frames_list& list = registry.lists_[frames.shard_].data_;
+
+            std::lock_guard<hpx::lcos::local::spinlock> l(list.mtx_);
+
+            if (frames.prev_ != nullptr)
+                frames.prev_->next_ = frames.next_;
+            else
+                list.head_ = frames.next_;
+
+            if (frames.next_ != nullptr)
+                frames.next_->prev_ = frames.prev_;
+            else
+                list.tail_ = frames.prev_;
+
+            frames.shard_ = std::size_t(-1);
+            frames.prev_ = nullptr;
+            frames.next_ = nullptr;
+        }
+
+        // Take the oldest function recorded by any of the registered frames,
+        // starting with the frames registered on the current core.
+        bool steal_frame(work_first_frames::function_type& f,
+            work_first_frames*& victim)
+        {
+            frames_registry& registry = get_frames_registry();
+            std::size_t const size = registry.lists_.size();
+            std::size_t const start = hpx::get_worker_thread_num() % size;
+
+            for (std::size_t i = 0; i != size; ++i)
+            {
+                frames_list& list = registry.lists_[(start + i) % size].data_;
+
+                // holding the lock of the list keeps all frames alive
+                std::lock_guard<hpx::lcos::local::spinlock> ll(list.mtx_);
+                for (work_first_frames* p = list.head_; p != nullptr;
+                     p = p->next_)
+                {
+                    std::lock_guard<hpx::lcos::local::spinlock> l(p->mtx_);
+                    if (p->head_ != p->frames_.size())
+                    {
+                        f = std::move(p->frames_[p->head_++]);
+                        ++p->stolen_;
+                        victim = p;
+                        return true;
+                    }
+                }
+            }
+            return false;
+        }
+    }    // namespace
+
+    ///////////////////////////////////////////////////////////////////////////
+    work_first_frames::~work_first_frames()
+    {
+        if (shard_ != std::size_t(-1))
+        {
+            unregister_frames(*this);
+        }
+    }
+
+    void work_first_frames::push(function_type&& f)
+    {
+        if (shard_ == std::size_t(-1))
+        {
+            register_frames(*this);
+        }
+
+        std::lock_guard<mutex_type> l(mtx_);
+        frames_.push_back(std::move(f));
+    }
+
+    void work_first_frames::drain(parallel::exception_list& errors)
+    {
+        if (shard_ == std::size_t(-1))
+            return;
+
+        // execute the remaining functions, newest first
+        while (true)
+        {
+            function_type f;
+
+            {
+                std::lock_guard<mutex_type> l(mtx_);
+                if (head_ == frames_.size())
+                    break;
+
+                f = std::move(frames_.back());
+                frames_.pop_back();
+            }
+
+            try
+            {
+                f();
+            }
+            catch (...)
+            {
+                handle_task_block_exceptions(errors);
+            }
+        }
+
+        // wait for the stolen functions to finish
+        {
+            std::unique_lock<mutex_type> l(mtx_);
+            stolen_cond_.wait(l, [this]() { return stolen_ == 0; });
+        }
+
+        unregister_frames(*this);
+
+        std::lock_guard<mutex_type> l(mtx_);
+        for (std::exception_ptr& e : stolen_errors_)
+        {
+            errors.add(std::move(e));
+        }
+        stolen_errors_.clear();
+        frames_.clear();
+        head_ = 0;
+    }
+
+    void work_first_frames::stolen_done(std::exception_ptr&& e)
+    {
+        // the frames may go out of scope as soon as the lock is released
+        // after the last stolen function has finished
+        std::lock_guard<mutex_type> l(mtx_);
+        if (e)
+        {
+            stolen_errors_.push_back(std::move(e));
+        }
+
+        HPX_ASSERT(stolen_ != 0);
+        if (--stolen_ == 0)
+        {
+            stolen_cond_.notify_all();
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    bool acquire_task_block_agent()
+    {
+        frames_registry& registry = get_frames_registry();
+
+        std::size_t agents = registry.agents_.load(std::memory_order_relaxed);
+        do
+        {
+            if (agents >= registry.max_agents_)
+                return false;
+        } while (!registry.agents_.compare_exchange_weak(agents, agents + 1));
+
+        return true;
+    }
+
+    void run_task_block_agent()
+    {
+        work_first_frames::function_type f;
+        work_first_frames* victim = nullptr;
+
+        while (steal_frame(f, victim))
+        {
+            std::exception_ptr e;
+            try
+            {
+                f();
+            }
+            catch (...)
+            {
+                e = std::current_exception();
+            }
+
+            f.reset();
+            victim->stolen_done(std::move(e));
+        }
+
+        --get_frames_registry().agents_;
+    }
+}}}}    // namespace hpx::parallel::v2::detail
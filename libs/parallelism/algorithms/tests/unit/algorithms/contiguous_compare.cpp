@@ -0,0 +1,216 @@
+//  Copyright (c) 2020 STE||AR Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Exercise the vectorized code paths used by find, count, mismatch, equal,
+// and search for contiguous sequences of bitwise comparable elements.
+
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/parallel_count.hpp>
+#include <hpx/include/parallel_equal.hpp>
+#include <hpx/include/parallel_find.hpp>
+#include <hpx/include/parallel_mismatch.hpp>
+#include <hpx/include/parallel_search.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+////////////////////////////////////////////////////////////////////////////
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+// the sizes are chosen to cover the scalar tails of the kernels as well as
+// the block boundaries used for cancellation
+std::size_t const sizes[] = {0, 1, 15, 33, 4095, 4097, 20011};
+
+template <typename T>
+std::vector<T> make_data(std::size_t size)
+{
+    std::uniform_int_distribution<> dis(2, 101);
+
+    std::vector<T> c(size);
+    std::generate(std::begin(c), std::end(c), [&]() { return T(dis(gen)); });
+    return c;
+}
+
+template <typename ExPolicy, typename T>
+void test_find_count(ExPolicy&& policy)
+{
+    for (std::size_t size : sizes)
+    {
+        std::vector<T> c = make_data<T>(size);
+        if (size != 0)
+        {
+            std::uniform_int_distribution<std::size_t> pos(0, size - 1);
+            c[pos(gen)] = T(1);
+            c[pos(gen)] = T(1);
+        }
+
+        auto it = hpx::find(policy, std::begin(c), std::end(c), T(1));
+        HPX_TEST(it == std::find(std::begin(c), std::end(c), T(1)));
+
+        it = hpx::find(policy, std::begin(c), std::end(c), T(0));
+        HPX_TEST(it == std::end(c));
+
+        auto count = hpx::count(policy, std::begin(c), std::end(c), T(1));
+        HPX_TEST_EQ(count, std::count(std::begin(c), std::end(c), T(1)));
+    }
+}
+
+template <typename ExPolicy, typename T>
+void test_mismatch_equal(ExPolicy&& policy)
+{
+    for (std::size_t size : sizes)
+    {
+        std::vector<T> c1 = make_data<T>(size);
+        std::vector<T> c2 = c1;
+
+        HPX_TEST(hpx::equal(policy, std::begin(c1), std::end(c1),
+            std::begin(c2), std::end(c2)));
+        HPX_TEST(hpx::equal(
+            policy, std::begin(c1), std::end(c1), std::begin(c2)));
+
+        auto result = hpx::mismatch(policy, std::begin(c1), std::end(c1),
+            std::begin(c2), std::end(c2));
+        HPX_TEST(result.first == std::end(c1));
+        HPX_TEST(result.second == std::end(c2));
+
+        if (size == 0)
+            continue;
+
+        std::uniform_int_distribution<std::size_t> pos(0, size - 1);
+        std::size_t mismatched = pos(gen);
+        c2[mismatched] = T(0);
+
+        HPX_TEST(!hpx::equal(policy, std::begin(c1), std::end(c1),
+            std::begin(c2), std::end(c2)));
+        HPX_TEST(!hpx::equal(
+            policy, std::begin(c1), std::end(c1), std::begin(c2)));
+
+        result = hpx::mismatch(policy, std::begin(c1), std::end(c1),
+            std::begin(c2), std::end(c2));
+        HPX_TEST(result.first == std::begin(c1) + mismatched);
+        HPX_TEST(result.second == std::begin(c2) + mismatched);
+
+        result =
+            hpx::mismatch(policy, std::begin(c1), std::end(c1), std::begin(c2));
+        HPX_TEST(result.first == std::begin(c1) + mismatched);
+        HPX_TEST(result.second == std::begin(c2) + mismatched);
+    }
+}
+
+template <typename ExPolicy, typename T>
+void test_search(ExPolicy&& policy)
+{
+    for (std::size_t size : sizes)
+    {
+        std::vector<T> c = make_data<T>(size);
+        std::vector<T> h = {T(1), T(2), T(1)};
+
+        auto it = hpx::search(
+            policy, std::begin(c), std::end(c), std::begin(h), std::end(h));
+        HPX_TEST(it ==
+            std::search(std::begin(c), std::end(c), std::begin(h),
+                std::end(h)));
+
+        if (size < h.size())
+            continue;
+
+        // partial matches in front of the real one
+        std::uniform_int_distribution<std::size_t> pos(0, size - h.size());
+        std::size_t found = pos(gen);
+        std::copy(std::begin(h), std::end(h), std::begin(c) + found);
+        if (found != 0)
+            c[found / 2] = T(1);
+
+        it = hpx::search(
+            policy, std::begin(c), std::end(c), std::begin(h), std::end(h));
+        HPX_TEST(it ==
+            std::search(std::begin(c), std::end(c), std::begin(h),
+                std::end(h)));
+    }
+}
+
+template <typename T>
+void test_contiguous_compare()
+{
+    using namespace hpx::execution;
+
+    test_find_count<sequenced_policy const&, T>(seq);
+    test_find_count<parallel_policy const&, T>(par);
+
+    test_mismatch_equal<sequenced_policy const&, T>(seq);
+    test_mismatch_equal<parallel_policy const&, T>(par);
+
+    test_search<sequenced_policy const&, T>(seq);
+    test_search<parallel_policy const&, T>(par);
+}
+
+void test_string_search()
+{
+    std::string log(100000, 'x');
+    std::string pattern = "ERROR";
+
+    log.replace(77777, pattern.size(), pattern);
+    log.replace(33333, 3, "ERR");
+
+    auto it = hpx::search(hpx::execution::par, std::begin(log), std::end(log),
+        std::begin(pattern), std::end(pattern));
+    HPX_TEST(it == std::begin(log) + 77777);
+
+    HPX_TEST_EQ(
+        hpx::count(hpx::execution::par, std::begin(log), std::end(log), 'E'),
+        std::ptrdiff_t(2));
+}
+
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    test_contiguous_compare<char>();
+    test_contiguous_compare<std::uint16_t>();
+    test_contiguous_compare<int>();
+    test_contiguous_compare<std::int64_t>();
+    test_string_search();
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::init(argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
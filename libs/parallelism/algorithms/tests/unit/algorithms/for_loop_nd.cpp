@@ -0,0 +1,170 @@
+//  Copyright (c) 2020 STE||AR Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/algorithm.hpp>
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <array>
+#include <cstddef>
+#include <iostream>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+hpx::tile_order const orders[] = {hpx::tile_order::row_major,
+    hpx::tile_order::morton, hpx::tile_order::hilbert};
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy>
+void test_for_loop_nd_2d(ExPolicy&& policy)
+{
+    static_assert(hpx::is_execution_policy<ExPolicy>::value,
+        "hpx::is_execution_policy<ExPolicy>::value");
+
+    std::uniform_int_distribution<std::size_t> dis(1, 300);
+    std::size_t const nx = dis(gen);
+    std::size_t const ny = dis(gen);
+
+    for (hpx::tile_order order : orders)
+    {
+        std::vector<std::size_t> c(nx * ny, 0);
+
+        hpx::for_loop_nd(policy, hpx::extents<2>(nx, ny),
+            hpx::tile_shape<2>({{7, 32}}, order),
+            [&](std::size_t i, std::size_t j) { c[i * ny + j] += i + j; });
+
+        // every point has to be visited exactly once
+        for (std::size_t i = 0; i != nx; ++i)
+        {
+            for (std::size_t j = 0; j != ny; ++j)
+            {
+                HPX_TEST_EQ(c[i * ny + j], i + j);
+            }
+        }
+    }
+
+    // default tile shape
+    std::vector<std::size_t> c(nx * ny, 0);
+    hpx::for_loop_nd(policy, hpx::extents<2>(nx, ny),
+        [&](std::size_t i, std::size_t j) { ++c[i * ny + j]; });
+
+    for (std::size_t v : c)
+    {
+        HPX_TEST_EQ(v, std::size_t(1));
+    }
+}
+
+template <typename ExPolicy>
+void test_for_loop_nd_3d(ExPolicy&& policy)
+{
+    std::uniform_int_distribution<std::size_t> dis(1, 50);
+    std::array<std::size_t, 3> const n = {{dis(gen), dis(gen), dis(gen)}};
+
+    for (hpx::tile_order order : orders)
+    {
+        std::vector<std::size_t> c(n[0] * n[1] * n[2], 0);
+
+        hpx::for_loop_nd(policy, hpx::extents<3>(n),
+            hpx::tile_shape<3>({{4, 5, 16}}, order),
+            [&](std::size_t i, std::size_t j, std::size_t k) {
+                ++c[(i * n[1] + j) * n[2] + k];
+            });
+
+        for (std::size_t v : c)
+        {
+            HPX_TEST_EQ(v, std::size_t(1));
+        }
+    }
+}
+
+template <typename ExPolicy>
+void test_for_loop_nd_async(ExPolicy&& p)
+{
+    std::vector<std::size_t> c(100 * 100, 0);
+
+    auto f = hpx::for_loop_nd(p, hpx::extents<2>(100, 100),
+        hpx::tile_shape<2>({{16, 16}}, hpx::tile_order::hilbert),
+        [&](std::size_t i, std::size_t j) { ++c[i * 100 + j]; });
+    f.wait();
+
+    for (std::size_t v : c)
+    {
+        HPX_TEST_EQ(v, std::size_t(1));
+    }
+}
+
+void test_for_loop_nd_empty()
+{
+    std::size_t count = 0;
+    hpx::for_loop_nd(hpx::extents<2>(0, 10),
+        [&](std::size_t, std::size_t) { ++count; });
+    HPX_TEST_EQ(count, std::size_t(0));
+
+    hpx::for_loop_nd(hpx::extents<1>(10), [&](std::size_t) { ++count; });
+    HPX_TEST_EQ(count, std::size_t(10));
+}
+
+void for_loop_nd_test()
+{
+    using namespace hpx::execution;
+
+    test_for_loop_nd_2d(seq);
+    test_for_loop_nd_2d(par);
+    test_for_loop_nd_2d(par_unseq);
+
+    test_for_loop_nd_3d(seq);
+    test_for_loop_nd_3d(par);
+
+    test_for_loop_nd_async(seq(task));
+    test_for_loop_nd_async(par(task));
+
+    test_for_loop_nd_empty();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    for_loop_nd_test();
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::init(argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
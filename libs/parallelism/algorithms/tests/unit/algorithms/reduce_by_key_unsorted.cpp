@@ -0,0 +1,209 @@
+//  Copyright (c) 2020 STE||AR Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/parallel/algorithms/reduce_by_key_unsorted.hpp>
+
+#include <cstddef>
+#include <ctime>
+#include <iostream>
+#include <map>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+////////////////////////////////////////////////////////////////////////////
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+void generate_input(std::size_t size, int num_keys, std::vector<int>& keys,
+    std::vector<int>& values)
+{
+    std::uniform_int_distribution<int> dis_key(0, num_keys - 1);
+    std::uniform_int_distribution<int> dis_value(-100, 100);
+
+    keys.resize(size);
+    values.resize(size);
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        keys[i] = dis_key(gen);
+        values[i] = dis_value(gen);
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy>
+void test_reduce_by_key_unsorted(
+    ExPolicy&& policy, std::size_t size, int num_keys)
+{
+    std::vector<int> keys, values;
+    generate_input(size, num_keys, keys, values);
+
+    std::map<int, int> expected;
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        expected[keys[i]] += values[i];
+    }
+
+    std::vector<int> o_keys(size), o_values(size);
+    auto result = hpx::parallel::reduce_by_key_unsorted(policy,
+        keys.begin(), keys.end(), values.begin(), o_keys.begin(),
+        o_values.begin());
+
+    HPX_TEST(result.in == o_keys.begin() + expected.size());
+    HPX_TEST(result.out == o_values.begin() + expected.size());
+
+    std::map<int, int> actual;
+    for (auto it = o_keys.begin(); it != result.in; ++it)
+    {
+        // each key has to be written exactly once
+        HPX_TEST(actual.find(*it) == actual.end());
+        actual[*it] = o_values[std::distance(o_keys.begin(), it)];
+    }
+    HPX_TEST(actual == expected);
+}
+
+template <typename ExPolicy>
+void test_reduce_by_key_unsorted_async(
+    ExPolicy&& policy, std::size_t size, int num_keys)
+{
+    std::vector<int> keys, values;
+    generate_input(size, num_keys, keys, values);
+
+    std::map<int, int> expected;
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        expected[keys[i]] += values[i];
+    }
+
+    std::vector<int> o_keys(size), o_values(size);
+    auto f = hpx::parallel::reduce_by_key_unsorted(policy, keys.begin(),
+        keys.end(), values.begin(), o_keys.begin(), o_values.begin());
+    auto result = f.get();
+
+    HPX_TEST(result.in == o_keys.begin() + expected.size());
+
+    std::map<int, int> actual;
+    for (auto it = o_keys.begin(); it != result.in; ++it)
+    {
+        actual[*it] = o_values[std::distance(o_keys.begin(), it)];
+    }
+    HPX_TEST(actual == expected);
+}
+
+void test_reduce_by_key_unsorted_order()
+{
+    // the sequential version writes the keys in order of first occurrence
+    std::vector<int> keys = {3, 1, 3, 2, 1, 3};
+    std::vector<int> values = {1, 2, 3, 4, 5, 6};
+    std::vector<int> o_keys(keys.size()), o_values(keys.size());
+
+    auto result = hpx::parallel::reduce_by_key_unsorted(hpx::execution::seq,
+        keys.begin(), keys.end(), values.begin(), o_keys.begin(),
+        o_values.begin());
+
+    HPX_TEST(result.in == o_keys.begin() + 3);
+    HPX_TEST((std::vector<int>(o_keys.begin(), o_keys.begin() + 3) ==
+        std::vector<int>{3, 1, 2}));
+    HPX_TEST((std::vector<int>(o_values.begin(), o_values.begin() + 3) ==
+        std::vector<int>{10, 7, 4}));
+}
+
+////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy>
+void test_group_by(ExPolicy&& policy, std::size_t size, int num_keys)
+{
+    std::vector<int> keys, values;
+    generate_input(size, num_keys, keys, values);
+
+    std::map<int, std::vector<int>> expected;
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        expected[keys[i]].push_back(values[i]);
+    }
+
+    std::vector<int> o_keys(size), o_values(size);
+    auto result = hpx::parallel::group_by(policy, keys.begin(), keys.end(),
+        values.begin(), o_keys.begin(), o_values.begin());
+
+    HPX_TEST(result.in == o_keys.end());
+    HPX_TEST(result.out == o_values.end());
+
+    // all equal keys have to be adjacent, the values of each group have to
+    // be in their original order
+    std::map<int, std::vector<int>> actual;
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        if (i == 0 || o_keys[i] != o_keys[i - 1])
+        {
+            HPX_TEST(actual.find(o_keys[i]) == actual.end());
+        }
+        actual[o_keys[i]].push_back(o_values[i]);
+    }
+    HPX_TEST(actual == expected);
+}
+
+////////////////////////////////////////////////////////////////////////////
+void test_reduce_by_key_unsorted()
+{
+    using namespace hpx::execution;
+
+    for (int num_keys : {1, 17, 1000, 100000})
+    {
+        test_reduce_by_key_unsorted(seq, 0, num_keys);
+        test_reduce_by_key_unsorted(par, 0, num_keys);
+
+        test_reduce_by_key_unsorted(seq, 10007, num_keys);
+        test_reduce_by_key_unsorted(par, 10007, num_keys);
+        test_reduce_by_key_unsorted(par_unseq, 10007, num_keys);
+
+        test_reduce_by_key_unsorted_async(seq(task), 10007, num_keys);
+        test_reduce_by_key_unsorted_async(par(task), 10007, num_keys);
+
+        test_group_by(seq, 10007, num_keys);
+        test_group_by(par, 10007, num_keys);
+        test_group_by(par_unseq, 10007, num_keys);
+    }
+
+    test_reduce_by_key_unsorted_order();
+}
+
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    test_reduce_by_key_unsorted();
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    hpx::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::init(argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
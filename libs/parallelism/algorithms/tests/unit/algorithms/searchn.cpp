@@ -433,6 +433,74 @@ void search_n_test5()
     test_search_n5<std::forward_iterator_tag>();
 }
 
+template <typename ExPolicy, typename IteratorTag>
+void test_search_n6(ExPolicy policy, IteratorTag)
+{
+    static_assert(hpx::is_execution_policy<ExPolicy>::value,
+        "hpx::is_execution_policy<ExPolicy>::value");
+
+    typedef std::vector<std::size_t>::iterator base_iterator;
+    typedef test::test_iterator<base_iterator, IteratorTag> iterator;
+
+    std::vector<std::size_t> c(10007);
+    // fill vector with random values above 2, the subsequence is not part
+    // of the vector
+    std::fill(std::begin(c), std::end(c), (std::rand() % 100) + 3);
+
+    std::size_t h[] = {1, 2};
+
+    iterator index = hpx::search_n(
+        policy, iterator(std::begin(c)), c.size(), std::begin(h), std::end(h));
+
+    HPX_TEST(index == iterator(std::end(c)));
+
+    // the subsequence is longer than the searched range
+    std::vector<std::size_t> h2(c.size() + 1, c[0]);
+
+    index = hpx::search_n(policy, iterator(std::begin(c)), c.size(),
+        std::begin(h2), std::end(h2));
+
+    HPX_TEST(index == iterator(std::end(c)));
+}
+
+template <typename ExPolicy, typename IteratorTag>
+void test_search_n6_async(ExPolicy p, IteratorTag)
+{
+    typedef std::vector<std::size_t>::iterator base_iterator;
+    typedef test::test_iterator<base_iterator, IteratorTag> iterator;
+
+    std::vector<std::size_t> c(10007);
+    // fill vector with random values above 2, the subsequence is not part
+    // of the vector
+    std::fill(std::begin(c), std::end(c), (std::rand() % 100) + 3);
+
+    std::size_t h[] = {1, 2};
+
+    hpx::future<iterator> f = hpx::search_n(
+        p, iterator(std::begin(c)), c.size(), std::begin(h), std::end(h));
+    f.wait();
+
+    HPX_TEST(f.get() == iterator(std::end(c)));
+}
+
+template <typename IteratorTag>
+void test_search_n6()
+{
+    using namespace hpx::execution;
+    test_search_n6(seq, IteratorTag());
+    test_search_n6(par, IteratorTag());
+    test_search_n6(par_unseq, IteratorTag());
+
+    test_search_n6_async(seq(task), IteratorTag());
+    test_search_n6_async(par(task), IteratorTag());
+}
+
+void search_n_test6()
+{
+    test_search_n6<std::random_access_iterator_tag>();
+    test_search_n6<std::forward_iterator_tag>();
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 template <typename ExPolicy, typename IteratorTag>
 void test_search_n_exception(ExPolicy policy, IteratorTag)
@@ -640,6 +708,7 @@ int hpx_main(hpx::program_options::variables_map& vm)
     search_n_test3();
     search_n_test4();
     search_n_test5();
+    search_n_test6();
     search_n_exception_test();
     search_n_bad_alloc_test();
     return hpx::finalize();
@@ -0,0 +1,197 @@
+//  Copyright (c) 2020 STE||AR Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/future.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/parallel/task_block.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+using hpx::parallel::define_task_block;
+using hpx::parallel::task_block;
+using hpx::parallel::task_block_mode;
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy>
+std::uint64_t fibonacci(ExPolicy const& policy, std::uint64_t n)
+{
+    if (n < 2)
+        return n;
+
+    std::uint64_t x = 0, y = 0;
+    define_task_block(policy, task_block_mode::work_first,
+        [&](task_block<ExPolicy>& trh) {
+            HPX_TEST(trh.get_mode() == task_block_mode::work_first);
+
+            trh.run([&]() { x = fibonacci(policy, n - 1); });
+            y = fibonacci(policy, n - 2);
+        });
+
+    return x + y;
+}
+
+void define_task_block_work_first_test()
+{
+    HPX_TEST_EQ(fibonacci(hpx::execution::par, 22), std::uint64_t(17711));
+    HPX_TEST_EQ(fibonacci(hpx::execution::seq, 22), std::uint64_t(17711));
+}
+
+void define_task_block_work_first_many_test()
+{
+    std::size_t const count = 10000;
+    std::vector<std::size_t> results(count, 0);
+
+    define_task_block(hpx::execution::par, task_block_mode::work_first,
+        [&](task_block<>& trh) {
+            for (std::size_t i = 0; i != count; ++i)
+            {
+                trh.run([&results, i]() { results[i] = i; });
+            }
+
+            // all functions have finished after waiting
+            trh.wait();
+            for (std::size_t i = 0; i != count; ++i)
+            {
+                HPX_TEST_EQ(results[i], i);
+                results[i] = 0;
+            }
+
+            // the task block can be reused after waiting
+            for (std::size_t i = 0; i != count; ++i)
+            {
+                trh.run([&results, i]() { results[i] = 2 * i; });
+            }
+        });
+
+    for (std::size_t i = 0; i != count; ++i)
+    {
+        HPX_TEST_EQ(results[i], 2 * i);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void define_task_block_work_first_exceptions_test()
+{
+    std::atomic<int> executed(0);
+    try
+    {
+        define_task_block(hpx::execution::par, task_block_mode::work_first,
+            [&](task_block<>& trh) {
+                trh.run([&]() {
+                    ++executed;
+                    throw 1;
+                });
+
+                trh.run([&]() {
+                    ++executed;
+                    throw 2;
+                });
+
+                // the errors are reported once the task block is complete
+                trh.wait();
+                HPX_TEST_EQ(executed.load(), 2);
+
+                trh.run([&]() { ++executed; });
+                throw 100;
+            });
+
+        HPX_TEST(false);
+    }
+    catch (hpx::parallel::exception_list const& e)
+    {
+        HPX_TEST_EQ(e.size(), 3u);
+    }
+    catch (...)
+    {
+        HPX_TEST(false);
+    }
+
+    HPX_TEST_EQ(executed.load(), 3);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void define_task_block_work_first_async_test()
+{
+    using policy_type = hpx::execution::parallel_task_policy;
+
+    std::size_t const count = 1000;
+    std::vector<std::size_t> results(count, 0);
+
+    // the recorded functions are executed asynchronously, this would
+    // deadlock if define_task_block waited for them
+    hpx::lcos::local::promise<void> p;
+    hpx::shared_future<void> started = p.get_future();
+
+    hpx::future<void> f = define_task_block(
+        hpx::execution::par(hpx::execution::task), task_block_mode::work_first,
+        [&](task_block<policy_type>& trh) {
+            trh.run([started]() { started.get(); });
+            for (std::size_t i = 0; i != count; ++i)
+            {
+                trh.run([&results, i]() { results[i] = i + 1; });
+            }
+        });
+
+    p.set_value();
+    f.get();
+
+    for (std::size_t i = 0; i != count; ++i)
+    {
+        HPX_TEST_EQ(results[i], i + 1);
+    }
+
+    // errors are reported through the returned future
+    f = define_task_block(hpx::execution::par(hpx::execution::task),
+        task_block_mode::work_first, [](task_block<policy_type>& trh) {
+            trh.run([]() { throw 1; });
+            trh.run([]() { throw 2; });
+        });
+
+    try
+    {
+        f.get();
+        HPX_TEST(false);
+    }
+    catch (hpx::parallel::exception_list const& e)
+    {
+        HPX_TEST_EQ(e.size(), 2u);
+    }
+    catch (...)
+    {
+        HPX_TEST(false);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    define_task_block_work_first_test();
+    define_task_block_work_first_many_test();
+    define_task_block_work_first_exceptions_test();
+    define_task_block_work_first_async_test();
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::init_params init_args;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::init(argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
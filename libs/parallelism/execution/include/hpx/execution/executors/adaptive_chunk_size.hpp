@@ -0,0 +1,269 @@
+//  Copyright (c) 2020 STE||AR Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/executors/adaptive_chunk_size.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/execution/traits/is_executor_parameters.hpp>
+#include <hpx/modules/timing.hpp>
+#include <hpx/serialization/serialize.hpp>
+#include <hpx/serialization/string.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <type_traits>
+#include <typeinfo>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace execution {
+    ///////////////////////////////////////////////////////////////////////////
+    /// \cond NOINTERNAL
+    namespace detail {
+        // The profile collected for one call site, defined in
+        // adaptive_chunk_size.cpp
+        struct adaptive_chunk_size_profile;
+
+        // Find or create the profile for the call site identified by the
+        // given type and user supplied tag.
+        HPX_EXPORT adaptive_chunk_size_profile& get_adaptive_chunk_size_profile(
+            std::type_info const& site, std::string const& tag);
+
+        // Select the configuration to use for the next invocation of the
+        // given call site, returns the chunk size to use.
+        HPX_EXPORT std::size_t select_adaptive_chunk_size(
+            adaptive_chunk_size_profile& profile, std::size_t cores,
+            std::size_t count, std::size_t& config);
+
+        // Record the wall time measured for an invocation which used the
+        // given configuration.
+        HPX_EXPORT void update_adaptive_chunk_size(
+            adaptive_chunk_size_profile& profile, std::size_t config,
+            std::size_t count, std::uint64_t elapsed);
+
+        // The state of the invocation currently being measured, shared
+        // between all copies of an adaptive_chunk_size object.
+        struct adaptive_chunk_size_invocation
+        {
+            hpx::lcos::local::spinlock mtx_;
+
+            std::uint64_t start_ = 0;
+            adaptive_chunk_size_profile* profile_ = nullptr;
+            std::size_t config_ = 0;
+            std::size_t count_ = 0;
+            bool overlapped_ = false;
+
+            // avoid looking up the profile for each invocation
+            std::type_info const* site_ = nullptr;
+            adaptive_chunk_size_profile* site_profile_ = nullptr;
+        };
+    }    // namespace detail
+    /// \endcond
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Loop iterations are divided into pieces and then assigned to threads.
+    /// The number of loop iterations combined and the number of cores used
+    /// are tuned online, based on the wall time measured for previous
+    /// invocations of the same call site.
+    ///
+    /// A call site is identified by the algorithm and the iterator types it
+    /// was invoked with and an optional user supplied tag. For each call site
+    /// a profile of the measured time per iteration is kept for a set of
+    /// candidate configurations (number of cores used and number of chunks
+    /// created per core). Each configuration is tried once, after that the
+    /// best performing one is used, while its neighbors are re-measured
+    /// periodically to track changes in the workload.
+    ///
+    /// The learned values are exposed through the performance counters
+    /// /runtime/adaptive-chunk-size/<name>@<tag> (all call sites using the
+    /// tag combined) or /runtime/adaptive-chunk-size/<name>@<tag>#<n> (the
+    /// n-th call site using the tag) and can be saved to and
+    /// restored from a file, see \a save_adaptive_chunk_size_profiles and
+    /// \a load_adaptive_chunk_size_profiles.
+    ///
+    /// \note This executor parameters type measures whole invocations. It
+    ///       is safe to use the same instance for concurrently running
+    ///       algorithms, however measurements of overlapping invocations are
+    ///       discarded.
+    ///
+    struct adaptive_chunk_size
+    {
+    public:
+        /// Construct an \a adaptive_chunk_size executor parameters object
+        ///
+        /// \param tag          [in] The user supplied tag used to distinguish
+        ///                     otherwise identical call sites. This is also
+        ///                     used as the parameter of the related
+        ///                     performance counters.
+        ///
+        explicit adaptive_chunk_size(std::string tag = std::string())
+          : tag_(std::move(tag))
+          , invocation_(
+                std::make_shared<detail::adaptive_chunk_size_invocation>())
+        {
+        }
+
+        /// \cond NOINTERNAL
+        template <typename Executor>
+        void mark_begin_execution(Executor&& /* exec */) const
+        {
+            detail::adaptive_chunk_size_invocation& inv = *invocation_;
+            std::lock_guard<hpx::lcos::local::spinlock> l(inv.mtx_);
+
+            if (inv.start_ != 0)
+            {
+                inv.overlapped_ = true;
+                return;
+            }
+
+            inv.profile_ = nullptr;
+            inv.start_ = hpx::chrono::high_resolution_clock::now();
+        }
+
+        // Select a chunk size based on the profile of the call site.
+        template <typename Executor, typename F>
+        std::size_t get_chunk_size(Executor& /* exec */, F&& /* f */,
+            std::size_t cores, std::size_t count) const
+        {
+            using site_type = typename std::decay<F>::type;
+
+            detail::adaptive_chunk_size_invocation& inv = *invocation_;
+            std::lock_guard<hpx::lcos::local::spinlock> l(inv.mtx_);
+
+            if (inv.site_ == nullptr || *inv.site_ != typeid(site_type))
+            {
+                inv.site_ = &typeid(site_type);
+                inv.site_profile_ = &detail::get_adaptive_chunk_size_profile(
+                    typeid(site_type), tag_);
+            }
+
+            std::size_t config = 0;
+            std::size_t chunk_size = detail::select_adaptive_chunk_size(
+                *inv.site_profile_, cores, count, config);
+
+            // measure only if this is part of a scoped invocation
+            if (inv.start_ != 0 && !inv.overlapped_)
+            {
+                inv.profile_ = inv.site_profile_;
+                inv.config_ = config;
+                inv.count_ = count;
+            }
+
+            return chunk_size;
+        }
+
+        template <typename Executor>
+        void mark_end_execution(Executor&& /* exec */) const
+        {
+            detail::adaptive_chunk_size_invocation& inv = *invocation_;
+            std::lock_guard<hpx::lcos::local::spinlock> l(inv.mtx_);
+
+            if (inv.start_ == 0)
+                return;
+
+            if (!inv.overlapped_ && inv.profile_ != nullptr)
+            {
+                std::uint64_t elapsed =
+                    hpx::chrono::high_resolution_clock::now() - inv.start_;
+                detail::update_adaptive_chunk_size(
+                    *inv.profile_, inv.config_, inv.count_, elapsed);
+            }
+
+            inv.start_ = 0;
+            inv.profile_ = nullptr;
+            inv.overlapped_ = false;
+        }
+        /// \endcond
+
+    private:
+        /// \cond NOINTERNAL
+        friend class hpx::serialization::access;
+
+        template <typename Archive>
+        void serialize(Archive& ar, const unsigned int /* version */)
+        {
+            // clang-format off
+            ar & tag_;
+            // clang-format on
+        }
+        /// \endcond
+
+    private:
+        /// \cond NOINTERNAL
+        std::string tag_;
+        std::shared_ptr<detail::adaptive_chunk_size_invocation> invocation_;
+        /// \endcond
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Write the profiles collected by all \a adaptive_chunk_size executor
+    /// parameters objects to the given file.
+    ///
+    /// \note Call sites are identified by their mangled type names, the
+    ///       written profiles can be reused only by the same executable.
+    ///
+    HPX_EXPORT void save_adaptive_chunk_size_profiles(
+        std::string const& filename);
+
+    /// Initialize the profiles used by \a adaptive_chunk_size executor
+    /// parameters objects from the given file, previously written by
+    /// \a save_adaptive_chunk_size_profiles. The loaded configurations are
+    /// used right away, without re-running the initial exploration.
+    HPX_EXPORT void load_adaptive_chunk_size_profiles(
+        std::string const& filename);
+
+    /// Discard all profiles collected by \a adaptive_chunk_size executor
+    /// parameters objects.
+    HPX_EXPORT void reset_adaptive_chunk_size_profiles();
+
+    /// \cond NOINTERNAL
+    namespace detail {
+        // The values exposed by the adaptive chunk size performance counters
+        struct adaptive_chunk_size_statistics
+        {
+            std::int64_t chunk_size = 0;
+            std::int64_t cores = 0;
+            std::int64_t time_per_iteration = 0;    // picoseconds
+            // time spent by all used cores relative to the fastest
+            // measured configuration, in percent
+            std::int64_t parallel_overhead = 0;
+            std::int64_t invocations = 0;
+            std::int64_t sites = 0;
+        };
+
+        // Retrieve the values learned for all call sites with the given tag
+        // which have been invoked at least once, ordered by call site.
+        HPX_EXPORT void get_adaptive_chunk_size_statistics(
+            std::string const& tag,
+            std::vector<adaptive_chunk_size_statistics>& stats);
+
+        // Retrieve the values learned for the call site with the given index
+        // (as returned by the overload above), or the values of all call
+        // sites with the given tag combined (weighted by their number of
+        // invocations) if site is std::size_t(-1). Returns false if no such
+        // call site exists.
+        HPX_EXPORT bool get_adaptive_chunk_size_statistics(
+            std::string const& tag, std::size_t site,
+            adaptive_chunk_size_statistics& stats);
+    }    // namespace detail
+    /// \endcond
+}}    // namespace hpx::execution
+
+namespace hpx { namespace parallel { namespace execution {
+    /// \cond NOINTERNAL
+    template <>
+    struct is_executor_parameters<hpx::execution::adaptive_chunk_size>
+      : std::true_type
+    {
+    };
+    /// \endcond
+}}}    // namespace hpx::parallel::execution
@@ -0,0 +1,523 @@
+//  Copyright (c) 2020 STE||AR Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/execution/executors/adaptive_chunk_size.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <typeinfo>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace execution { namespace detail {
+
+    // The candidate configurations are all combinations of the number of
+    // cores used (all, half, or a quarter of the available cores) and the
+    // number of chunks created per used core (1, 2, 4, ..., 32).
+    static constexpr std::size_t num_core_steps = 3;
+    static constexpr std::size_t num_chunk_steps = 6;
+    static constexpr std::size_t num_configs = num_core_steps * num_chunk_steps;
+
+    // the configuration tried first corresponds to 4 chunks per core on all
+    // cores, which is what auto_chunk_size aims for
+    static constexpr std::size_t initial_config = 2;
+
+    // every probe_interval invocations a neighbor of the best configuration
+    // is re-measured
+    static constexpr std::size_t probe_interval = 16;
+
+    // weight of new measurements in the exponential moving average
+    static constexpr double ema_weight = 0.25;
+
+    // Each profile is protected by its own lock, the lock of the registry is
+    // held only while profiles are created or enumerated. If both are
+    // needed, the lock of the registry is acquired first.
+    struct adaptive_chunk_size_profile
+    {
+        using mutex_type = hpx::lcos::local::spinlock;
+
+        struct measurement
+        {
+            double time_per_iteration = 0.0;    // nanoseconds
+            std::size_t samples = 0;
+        };
+
+        adaptive_chunk_size_profile(std::string site, std::string tag)
+          : site_(std::move(site))
+          , tag_(std::move(tag))
+        {
+        }
+
+        void reset(std::size_t cores)
+        {
+            cores_ = cores;
+            best_ = initial_config;
+            probe_ = 0;
+            explored_ = false;
+            measurements_.fill(measurement());
+        }
+
+        std::size_t used_cores(std::size_t config) const
+        {
+            return (std::max)(
+                std::size_t(1), cores_ >> (config / num_chunk_steps));
+        }
+
+        static std::size_t chunks_per_core(std::size_t config)
+        {
+            return std::size_t(1) << (config % num_chunk_steps);
+        }
+
+        std::size_t chunk_size(std::size_t config, std::size_t count) const
+        {
+            std::size_t chunks = used_cores(config) * chunks_per_core(config);
+            return (std::max)(
+                std::size_t(1), (count + chunks - 1) / chunks);
+        }
+
+        // The estimated sequential time per iteration, this is the smallest
+        // amount of work done by all used cores per iteration.
+        double sequential_time_per_iteration() const
+        {
+            double result = 0.0;
+            for (std::size_t i = 0; i != num_configs; ++i)
+            {
+                measurement const& m = measurements_[i];
+                if (m.samples == 0)
+                    continue;
+
+                double t = m.time_per_iteration * double(used_cores(i));
+                if (result == 0.0 || t < result)
+                    result = t;
+            }
+            return result;
+        }
+
+        // Fill in the values exposed by the performance counters
+        void get_statistics(adaptive_chunk_size_statistics& stats) const
+        {
+            measurement const& m = measurements_[best_];
+
+            stats.chunk_size = std::int64_t(chunk_size(best_, last_count_));
+            stats.cores = std::int64_t(used_cores(best_));
+            stats.time_per_iteration =
+                std::int64_t(m.time_per_iteration * 1000.0);
+            stats.invocations = std::int64_t(invocations_);
+            stats.sites = 1;
+
+            double sequential = sequential_time_per_iteration();
+            if (sequential != 0.0)
+            {
+                double used = m.time_per_iteration * double(used_cores(best_));
+                stats.parallel_overhead =
+                    std::int64_t(100.0 * (used / sequential - 1.0));
+            }
+            else
+            {
+                stats.parallel_overhead = 0;
+            }
+        }
+
+        mutable mutex_type mtx_;
+
+        std::string const site_;
+        std::string const tag_;
+
+        std::size_t cores_ = 0;
+        std::size_t best_ = initial_config;
+        std::size_t probe_ = 0;
+        std::size_t invocations_ = 0;
+        std::size_t last_count_ = 0;
+        bool explored_ = false;
+
+        std::array<measurement, num_configs> measurements_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    struct adaptive_chunk_size_registry
+    {
+        using mutex_type = hpx::lcos::local::spinlock;
+        using key_type = std::pair<std::string, std::string>;
+
+        static adaptive_chunk_size_registry& instance()
+        {
+            static adaptive_chunk_size_registry registry;
+            return registry;
+        }
+
+        mutex_type mtx_;
+        std::map<key_type, std::unique_ptr<adaptive_chunk_size_profile>>
+            profiles_;
+    };
+
+    adaptive_chunk_size_profile& get_adaptive_chunk_size_profile(
+        std::type_info const& site, std::string const& tag)
+    {
+        adaptive_chunk_size_registry& registry =
+            adaptive_chunk_size_registry::instance();
+
+        std::lock_guard<adaptive_chunk_size_registry::mutex_type> l(
+            registry.mtx_);
+
+        auto& profile = registry.profiles_[std::make_pair(site.name(), tag)];
+        if (!profile)
+        {
+            profile.reset(new adaptive_chunk_size_profile(site.name(), tag));
+        }
+        return *profile;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Return the configuration next to the best one to be re-measured, this
+    // cycles through all (valid) direct neighbors.
+    static std::size_t next_probe(adaptive_chunk_size_profile& profile)
+    {
+        std::size_t const best = profile.best_;
+        std::size_t const core_step = best / num_chunk_steps;
+        std::size_t const chunk_step = best % num_chunk_steps;
+
+        for (std::size_t i = 0; i != 4; ++i)
+        {
+            std::size_t probe = profile.probe_++ % 4;
+            switch (probe)
+            {
+            case 0:
+                if (chunk_step != 0)
+                    return best - 1;
+                break;
+
+            case 1:
+                if (chunk_step + 1 != num_chunk_steps)
+                    return best + 1;
+                break;
+
+            case 2:
+                if (core_step != 0)
+                    return best - num_chunk_steps;
+                break;
+
+            case 3:
+                if (core_step + 1 != num_core_steps &&
+                    (profile.cores_ >> (core_step + 1)) != 0)
+                {
+                    return best + num_chunk_steps;
+                }
+                break;
+            }
+        }
+        return best;
+    }
+
+    std::size_t select_adaptive_chunk_size(adaptive_chunk_size_profile& p,
+        std::size_t cores, std::size_t count, std::size_t& config)
+    {
+        HPX_ASSERT(cores != 0);
+
+        std::lock_guard<adaptive_chunk_size_profile::mutex_type> l(p.mtx_);
+
+        // the profile is valid only for the number of cores it was
+        // collected for
+        if (p.cores_ != cores)
+        {
+            p.reset(cores);
+        }
+
+        ++p.invocations_;
+        p.last_count_ = count;
+
+        config = p.best_;
+        if (!p.explored_)
+        {
+            // try all configurations once, starting with the initial one,
+            // skipping configurations which would use the same number of
+            // cores as an already tried one
+            for (std::size_t i = 0; i != num_configs; ++i)
+            {
+                std::size_t c = (initial_config + i) % num_configs;
+                if (c >= num_chunk_steps &&
+                    p.used_cores(c) == p.used_cores(c - num_chunk_steps))
+                {
+                    continue;
+                }
+                if (p.measurements_[c].samples == 0)
+                {
+                    config = c;
+                    return p.chunk_size(config, count);
+                }
+            }
+            p.explored_ = true;
+        }
+
+        if (p.invocations_ % probe_interval == 0)
+        {
+            config = next_probe(p);
+        }
+
+        return p.chunk_size(config, count);
+    }
+
+    void update_adaptive_chunk_size(adaptive_chunk_size_profile& p,
+        std::size_t config, std::size_t count, std::uint64_t elapsed)
+    {
+        if (count == 0)
+            return;
+
+        std::lock_guard<adaptive_chunk_size_profile::mutex_type> l(p.mtx_);
+
+        HPX_ASSERT(config < num_configs);
+
+        double t = double(elapsed) / double(count);
+
+        adaptive_chunk_size_profile::measurement& m = p.measurements_[config];
+        if (m.samples++ == 0)
+        {
+            m.time_per_iteration = t;
+        }
+        else
+        {
+            m.time_per_iteration += ema_weight * (t - m.time_per_iteration);
+        }
+
+        // re-evaluate best configuration
+        adaptive_chunk_size_profile::measurement const& best =
+            p.measurements_[p.best_];
+        if (best.samples == 0 ||
+            m.time_per_iteration < best.time_per_iteration)
+        {
+            p.best_ = config;
+        }
+        else if (config == p.best_)
+        {
+            // the best configuration got worse, check whether another one
+            // is better now
+            for (std::size_t i = 0; i != num_configs; ++i)
+            {
+                adaptive_chunk_size_profile::measurement const& other =
+                    p.measurements_[i];
+                if (other.samples != 0 &&
+                    other.time_per_iteration <
+                        p.measurements_[p.best_].time_per_iteration)
+                {
+                    p.best_ = i;
+                }
+            }
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void get_adaptive_chunk_size_statistics(std::string const& tag,
+        std::vector<adaptive_chunk_size_statistics>& stats)
+    {
+        adaptive_chunk_size_registry& registry =
+            adaptive_chunk_size_registry::instance();
+
+        std::lock_guard<adaptive_chunk_size_registry::mutex_type> l(
+            registry.mtx_);
+
+        // the profiles are ordered by call site
+        for (auto const& profile : registry.profiles_)
+        {
+            adaptive_chunk_size_profile const& p = *profile.second;
+            if (p.tag_ != tag)
+                continue;
+
+            std::lock_guard<adaptive_chunk_size_profile::mutex_type> lp(
+                p.mtx_);
+            if (p.invocations_ == 0)
+                continue;
+
+            adaptive_chunk_size_statistics site_stats;
+            p.get_statistics(site_stats);
+            stats.push_back(site_stats);
+        }
+    }
+
+    bool get_adaptive_chunk_size_statistics(std::string const& tag,
+        std::size_t site, adaptive_chunk_size_statistics& stats)
+    {
+        std::vector<adaptive_chunk_size_statistics> sites;
+        get_adaptive_chunk_size_statistics(tag, sites);
+
+        if (site != std::size_t(-1))
+        {
+            if (site >= sites.size())
+                return false;
+
+            stats = sites[site];
+            return true;
+        }
+
+        if (sites.empty())
+            return false;
+
+        // combine all call sites, weighted by their number of invocations
+        std::int64_t invocations = 0;
+        double chunk_size = 0.0, cores = 0.0, time_per_iteration = 0.0,
+               parallel_overhead = 0.0;
+        for (adaptive_chunk_size_statistics const& s : sites)
+        {
+            double const weight = double(s.invocations);
+            invocations += s.invocations;
+            chunk_size += weight * double(s.chunk_size);
+            cores += weight * double(s.cores);
+            time_per_iteration += weight * double(s.time_per_iteration);
+            parallel_overhead += weight * double(s.parallel_overhead);
+        }
+
+        double const total = double(invocations);
+        stats.chunk_size = std::int64_t(chunk_size / total + 0.5);
+        stats.cores = std::int64_t(cores / total + 0.5);
+        stats.time_per_iteration =
+            std::int64_t(time_per_iteration / total + 0.5);
+        stats.parallel_overhead = std::int64_t(parallel_overhead / total);
+        stats.invocations = invocations;
+        stats.sites = std::int64_t(sites.size());
+        return true;
+    }
+}}}    // namespace hpx::execution::detail
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace execution {
+
+    // Each line of a profile file describes the best configuration found for
+    // one call site:
+    //
+    //      <tag>\t<site>\t<cores>\t<config>\t<time per iteration>
+    //
+    void save_adaptive_chunk_size_profiles(std::string const& filename)
+    {
+        using detail::adaptive_chunk_size_registry;
+
+        std::ofstream out(filename);
+        if (!out)
+        {
+            HPX_THROW_EXCEPTION(filesystem_error,
+                "hpx::execution::save_adaptive_chunk_size_profiles",
+                "could not open file for writing: " + filename);
+            return;
+        }
+
+        adaptive_chunk_size_registry& registry =
+            adaptive_chunk_size_registry::instance();
+
+        // write the measured times without losing precision
+        out.precision(std::numeric_limits<double>::max_digits10);
+
+        std::lock_guard<adaptive_chunk_size_registry::mutex_type> l(
+            registry.mtx_);
+
+        for (auto const& profile : registry.profiles_)
+        {
+            detail::adaptive_chunk_size_profile const& p = *profile.second;
+
+            std::lock_guard<detail::adaptive_chunk_size_profile::mutex_type>
+                lp(p.mtx_);
+            if (p.cores_ == 0 || p.measurements_[p.best_].samples == 0)
+                continue;
+
+            out << p.tag_ << '\t' << p.site_ << '\t' << p.cores_ << '\t'
+                << p.best_ << '\t'
+                << p.measurements_[p.best_].time_per_iteration << '\n';
+        }
+    }
+
+    void load_adaptive_chunk_size_profiles(std::string const& filename)
+    {
+        using detail::adaptive_chunk_size_profile;
+        using detail::adaptive_chunk_size_registry;
+
+        std::ifstream in(filename);
+        if (!in)
+        {
+            HPX_THROW_EXCEPTION(filesystem_error,
+                "hpx::execution::load_adaptive_chunk_size_profiles",
+                "could not open file for reading: " + filename);
+            return;
+        }
+
+        adaptive_chunk_size_registry& registry =
+            adaptive_chunk_size_registry::instance();
+
+        std::string line;
+        std::size_t lineno = 0;
+        while (std::getline(in, line))
+        {
+            ++lineno;
+            if (line.empty())
+                continue;
+
+            std::string tag, site;
+            std::size_t cores = 0, config = 0;
+            double time_per_iteration = 0.0;
+
+            std::istringstream strm(line);
+            if (!std::getline(strm, tag, '\t') ||
+                !std::getline(strm, site, '\t') ||
+                !(strm >> cores >> config >> time_per_iteration) ||
+                cores == 0 || config >= detail::num_configs)
+            {
+                HPX_THROW_EXCEPTION(bad_parameter,
+                    "hpx::execution::load_adaptive_chunk_size_profiles",
+                    "invalid profile entry in " + filename + ", line " +
+                        std::to_string(lineno));
+                return;
+            }
+
+            std::lock_guard<adaptive_chunk_size_registry::mutex_type> l(
+                registry.mtx_);
+
+            auto& profile = registry.profiles_[std::make_pair(site, tag)];
+            if (!profile)
+            {
+                profile.reset(new adaptive_chunk_size_profile(site, tag));
+            }
+
+            std::lock_guard<adaptive_chunk_size_profile::mutex_type> lp(
+                profile->mtx_);
+            profile->reset(cores);
+            profile->best_ = config;
+            profile->explored_ = true;
+            profile->measurements_[config].time_per_iteration =
+                time_per_iteration;
+            profile->measurements_[config].samples = 1;
+        }
+    }
+
+    void reset_adaptive_chunk_size_profiles()
+    {
+        using detail::adaptive_chunk_size_registry;
+
+        adaptive_chunk_size_registry& registry =
+            adaptive_chunk_size_registry::instance();
+
+        std::lock_guard<adaptive_chunk_size_registry::mutex_type> l(
+            registry.mtx_);
+
+        // profiles may still be referenced by executor parameters objects
+        for (auto& profile : registry.profiles_)
+        {
+            std::lock_guard<detail::adaptive_chunk_size_profile::mutex_type>
+                lp(profile.second->mtx_);
+            profile.second->reset(0);
+            profile.second->invocations_ = 0;
+            profile.second->last_count_ = 0;
+        }
+    }
+}}    // namespace hpx::execution
@@ -9,14 +9,18 @@
 #include <hpx/include/parallel_executor_parameters.hpp>
 #include <hpx/include/parallel_executors.hpp>
 #include <hpx/iterator_support/iterator_range.hpp>
+#include <hpx/modules/filesystem.hpp>
 #include <hpx/modules/testing.hpp>
 
 #include <algorithm>
 #include <chrono>
+#include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <iostream>
 #include <iterator>
 #include <numeric>
+#include <random>
 #include <string>
 #include <utility>
 #include <vector>
@@ -131,6 +135,126 @@ void test_persistent_auto_chunk_size()
     }
 }
 
+// distinct types of the loop bodies identify distinct call sites
+template <int N>
+struct adaptive_chunk_size_site
+{
+};
+
+template <int N>
+std::size_t adaptive_chunk_size_invoke(
+    hpx::execution::adaptive_chunk_size const& acs, std::size_t cores,
+    std::size_t count, bool measure = true)
+{
+    hpx::execution::parallel_executor exec;
+    if (measure)
+        acs.mark_begin_execution(exec);
+
+    std::size_t chunk_size = acs.get_chunk_size(
+        exec, adaptive_chunk_size_site<N>(), cores, count);
+
+    if (measure)
+        acs.mark_end_execution(exec);
+    return chunk_size;
+}
+
+void test_adaptive_chunk_size()
+{
+    using hpx::execution::detail::adaptive_chunk_size_statistics;
+
+    {
+        hpx::execution::adaptive_chunk_size acs;
+        parameters_test(acs);
+    }
+
+    {
+        hpx::execution::adaptive_chunk_size acs("test");
+        parameters_test(acs);
+    }
+
+    std::size_t const cores = 4;
+    std::size_t const count = 10000;
+
+    hpx::execution::adaptive_chunk_size acs("adaptive_chunk_size_test");
+
+    // explore all configurations of two call sites
+    std::size_t chunk_size = 0;
+    for (int i = 0; i != 50; ++i)
+    {
+        chunk_size = adaptive_chunk_size_invoke<0>(acs, cores, count);
+        HPX_TEST(chunk_size >= 1 && chunk_size <= count);
+    }
+    for (int i = 0; i != 30; ++i)
+    {
+        adaptive_chunk_size_invoke<1>(acs, cores, count / 10);
+    }
+
+    // both call sites are reported
+    std::vector<adaptive_chunk_size_statistics> sites;
+    hpx::execution::detail::get_adaptive_chunk_size_statistics(
+        "adaptive_chunk_size_test", sites);
+    HPX_TEST_EQ(sites.size(), std::size_t(2));
+
+    std::int64_t invocations = 0;
+    for (adaptive_chunk_size_statistics const& s : sites)
+    {
+        HPX_TEST(s.invocations == 50 || s.invocations == 30);
+        HPX_TEST(s.cores >= 1 && s.cores <= std::int64_t(cores));
+        HPX_TEST(s.chunk_size >= 1);
+        HPX_TEST(s.parallel_overhead >= 0);
+        HPX_TEST_EQ(s.sites, std::int64_t(1));
+        invocations += s.invocations;
+    }
+
+    adaptive_chunk_size_statistics combined;
+    HPX_TEST(hpx::execution::detail::get_adaptive_chunk_size_statistics(
+        "adaptive_chunk_size_test", std::size_t(-1), combined));
+    HPX_TEST_EQ(combined.invocations, invocations);
+    HPX_TEST_EQ(combined.sites, std::int64_t(2));
+
+    adaptive_chunk_size_statistics site;
+    HPX_TEST(!hpx::execution::detail::get_adaptive_chunk_size_statistics(
+        "adaptive_chunk_size_test", 2, site));
+    HPX_TEST(!hpx::execution::detail::get_adaptive_chunk_size_statistics(
+        "adaptive_chunk_size_unknown", std::size_t(-1), site));
+
+    // the statistics of the first call site reflect the chunk size selected
+    // for it, unless the last invocation was probing another configuration
+    std::size_t first = sites[0].invocations == 50 ? 0 : 1;
+    adaptive_chunk_size_statistics before = sites[first];
+    chunk_size = adaptive_chunk_size_invoke<0>(acs, cores, count, false);
+    HPX_TEST_EQ(std::int64_t(chunk_size), before.chunk_size);
+
+    // the learned profiles survive a round trip through a file
+    hpx::filesystem::path filename = hpx::filesystem::temp_directory_path() /
+        ("hpx_adaptive_chunk_size_" + std::to_string(std::random_device()()) +
+            ".txt");
+    hpx::execution::save_adaptive_chunk_size_profiles(filename.string());
+    hpx::execution::reset_adaptive_chunk_size_profiles();
+
+    sites.clear();
+    hpx::execution::detail::get_adaptive_chunk_size_statistics(
+        "adaptive_chunk_size_test", sites);
+    HPX_TEST(sites.empty());
+
+    hpx::execution::load_adaptive_chunk_size_profiles(filename.string());
+    hpx::filesystem::remove(filename);
+
+    // the loaded configuration is used right away
+    HPX_TEST_EQ(
+        adaptive_chunk_size_invoke<0>(acs, cores, count, false), chunk_size);
+
+    adaptive_chunk_size_statistics after;
+    HPX_TEST(hpx::execution::detail::get_adaptive_chunk_size_statistics(
+        "adaptive_chunk_size_test", 0, after));
+    HPX_TEST_EQ(after.chunk_size, before.chunk_size);
+    HPX_TEST_EQ(after.cores, before.cores);
+    HPX_TEST_EQ(after.time_per_iteration, before.time_per_iteration);
+    HPX_TEST_EQ(after.invocations, std::int64_t(1));
+
+    parameters_test(acs);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 struct timer_hooks_parameters
 {
@@ -188,6 +312,7 @@ int hpx_main(hpx::program_options::variables_map& vm)
     test_guided_chunk_size();
     test_auto_chunk_size();
     test_persistent_auto_chunk_size();
+    test_adaptive_chunk_size();
 
     test_combined_hooks();
 
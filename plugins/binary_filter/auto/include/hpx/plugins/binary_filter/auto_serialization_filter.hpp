@@ -0,0 +1,68 @@
+//  Copyright (c) 2020 STE||AR Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/plugins/binary_filter/auto_serialization_filter_registration.hpp>
+
+#if defined(HPX_HAVE_COMPRESSION_LZ4) && defined(HPX_HAVE_COMPRESSION_ZSTD)
+
+#include <hpx/serialization/binary_filter.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace plugins { namespace compression
+{
+    // Decides for every message whether and how it is compressed. Small and
+    // incompressible messages are sent as they are. Otherwise a sample of the
+    // message is compressed to estimate how much time compression saves on
+    // the wire, which selects between LZ4 and the Zstandard level to use.
+    // Large messages are split into blocks which are compressed (and
+    // decompressed) concurrently.
+    struct HPX_LIBRARY_EXPORT auto_serialization_filter
+      : public serialization::binary_filter
+    {
+        auto_serialization_filter(bool /* compress */ = false,
+                serialization::binary_filter* /* next_filter */ = nullptr)
+          : current_(0), codec_(0), level_(0), selected_(false)
+        {}
+
+        void load(void* dst, std::size_t dst_count);
+        void save(void const* src, std::size_t src_count);
+        bool flush(void* dst, std::size_t dst_count, std::size_t& written);
+
+        void set_max_length(std::size_t size);
+        std::size_t init_data(char const* buffer,
+            std::size_t size, std::size_t buffer_size);
+
+    private:
+        // serialization support
+        friend class hpx::serialization::access;
+
+        template <typename Archive>
+        HPX_FORCEINLINE void serialize(Archive& ar, const unsigned int) {}
+
+        HPX_SERIALIZATION_POLYMORPHIC(auto_serialization_filter);
+
+        std::vector<char> buffer_;
+        std::size_t current_;
+
+        // the codec is selected once, flush may be called more than once
+        std::uint8_t codec_;
+        int level_;
+        bool selected_;
+    };
+}}}
+
+#include <hpx/config/warnings_suffix.hpp>
+
+#endif
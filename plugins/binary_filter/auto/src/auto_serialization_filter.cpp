@@ -0,0 +1,471 @@
+//  Copyright (c) 2020 STE||AR Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/executors/execution_policy.hpp>
+#include <hpx/modules/actions.hpp>
+#include <hpx/modules/format.hpp>
+#include <hpx/parallel/algorithms/for_loop.hpp>
+#include <hpx/plugin/traits/plugin_config_data.hpp>
+#include <hpx/runtime_local/config_entry.hpp>
+#include <hpx/threading_base/thread_data.hpp>
+#include <hpx/timing/high_resolution_clock.hpp>
+#include <hpx/util/from_string.hpp>
+
+#include <hpx/plugins/plugin_registry.hpp>
+#include <hpx/plugins/binary_filter_factory.hpp>
+#include <hpx/plugins/binary_filter/auto_serialization_filter.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <lz4.h>
+#include <zstd.h>
+
+namespace hpx { namespace traits
+{
+    // Inject additional configuration data into the factory registry for this
+    // type. This information ends up in the system wide configuration database
+    // under the plugin specific section:
+    //
+    //      [hpx.plugins.auto_serialization_filter]
+    //      ...
+    //      min_size = 4096         # smaller messages are not compressed
+    //      max_ratio = 0.9         # compressed/original size worth sending
+    //      bandwidth = 1250        # network bandwidth [MB/s]
+    //      max_level = 9           # highest Zstandard level, 0: LZ4 only
+    //      block_size = 1048576    # size of concurrently compressed blocks
+    //
+    template <>
+    struct plugin_config_data<
+        hpx::plugins::compression::auto_serialization_filter>
+    {
+        static char const* call()
+        {
+            return "min_size = 4096\n"
+                   "max_ratio = 0.9\n"
+                   "bandwidth = 1250\n"
+                   "max_level = 9\n"
+                   "block_size = 1048576";
+        }
+    };
+}}
+
+///////////////////////////////////////////////////////////////////////////////
+HPX_REGISTER_PLUGIN_MODULE();
+HPX_REGISTER_BINARY_FILTER_FACTORY(
+    hpx::plugins::compression::auto_serialization_filter,
+    auto_serialization_filter);
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace plugins { namespace compression
+{
+    namespace detail
+    {
+        enum codec_type : std::uint8_t
+        {
+            codec_none = 0,
+            codec_lz4 = 1,
+            codec_zstd = 2
+        };
+
+        template <typename T>
+        T get_auto_entry(char const* name, T dflt)
+        {
+            return hpx::util::from_string<T>(hpx::get_config_entry(
+                std::string("hpx.plugins.auto_serialization_filter.") + name,
+                ""), dflt);
+        }
+
+        struct auto_compression_parameters
+        {
+            auto_compression_parameters()
+              : min_size(get_auto_entry<std::size_t>("min_size", 4096))
+              , max_ratio(get_auto_entry<double>("max_ratio", 0.9))
+              , bandwidth(get_auto_entry<double>("bandwidth", 1250.) * 1e-3)
+              , max_level((std::min)(
+                    get_auto_entry<int>("max_level", 9), ZSTD_maxCLevel()))
+              , block_size((std::max)(std::size_t(65536),
+                    (std::min)(std::size_t(LZ4_MAX_INPUT_SIZE),
+                        get_auto_entry<std::size_t>("block_size", 1048576))))
+            {
+            }
+
+            std::size_t min_size;
+            double max_ratio;
+            double bandwidth;       // [bytes/ns]
+            int max_level;
+            std::size_t block_size;
+        };
+
+        auto_compression_parameters const& get_parameters()
+        {
+            // filters are created for every message, read the settings once
+            static auto_compression_parameters const params;
+            return params;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // The compressed data starts with a header:
+        //
+        //      codec                   1 byte
+        //      uncompressed size       8 bytes
+        //      block size              8 bytes
+        //      number of blocks        4 bytes
+        //      compressed block sizes  4 bytes each
+        //
+        // Uncompressed data consists of the codec byte followed by the data.
+        constexpr std::size_t header_size(std::size_t num_blocks)
+        {
+            return 1 + 8 + 8 + 4 + 4 * num_blocks;
+        }
+
+        std::size_t compress_bound(std::uint8_t codec, std::size_t size)
+        {
+            if (codec == codec_lz4)
+                return std::size_t(LZ4_compressBound(static_cast<int>(size)));
+            return ZSTD_compressBound(size);
+        }
+
+        std::uint32_t compress_block(std::uint8_t codec, int level,
+            char const* src, std::size_t size, char* dst, std::size_t capacity)
+        {
+            if (codec == codec_lz4)
+            {
+                int result = LZ4_compress_default(src, dst,
+                    static_cast<int>(size), static_cast<int>(capacity));
+                if (result <= 0)
+                {
+                    HPX_THROW_EXCEPTION(serialization_error,
+                        "auto_serialization_filter::flush",
+                        "LZ4 compression failure");
+                }
+                return static_cast<std::uint32_t>(result);
+            }
+
+            std::size_t result = ZSTD_compress(dst, capacity, src, size, level);
+            if (ZSTD_isError(result))
+            {
+                HPX_THROW_EXCEPTION(serialization_error,
+                    "auto_serialization_filter::flush",
+                    hpx::util::format("Zstandard compression failure: {}",
+                        ZSTD_getErrorName(result)));
+            }
+            return static_cast<std::uint32_t>(result);
+        }
+
+        void decompress_block(std::uint8_t codec, char const* src,
+            std::size_t size, char* dst, std::size_t expected)
+        {
+            bool success = false;
+            if (codec == codec_lz4)
+            {
+                int result = LZ4_decompress_safe(src, dst,
+                    static_cast<int>(size), static_cast<int>(expected));
+                success = result >= 0 && std::size_t(result) == expected;
+            }
+            else
+            {
+                std::size_t result = ZSTD_decompress(dst, expected, src, size);
+                success = !ZSTD_isError(result) && result == expected;
+            }
+
+            if (!success)
+            {
+                HPX_THROW_EXCEPTION(serialization_error,
+                    "auto_serialization_filter::init_data",
+                    hpx::util::format("decompression failure, number of "
+                        "bytes expected: {}", expected));
+            }
+        }
+
+        template <typename F>
+        void for_each_block(std::size_t num_blocks, F&& f)
+        {
+            // don't block threads which are not managed by HPX (e.g. the
+            // parcelport's io threads) while waiting for the blocks
+            if (num_blocks > 1 && threads::get_self_ptr() != nullptr)
+            {
+                hpx::for_loop(hpx::execution::par, std::size_t(0), num_blocks,
+                    std::forward<F>(f));
+                return;
+            }
+
+            for (std::size_t i = 0; i != num_blocks; ++i)
+                f(i);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // Compress a couple of samples spread over the message with LZ4 to
+        // estimate the achievable compression ratio and the speed of the
+        // compression. Compressing pays off only if the time it saves on the
+        // wire is larger than the time it takes. The larger the savings
+        // compared to the cost of LZ4, the higher the Zstandard level which
+        // may be used: Zstandard level 1 is roughly four times slower than
+        // LZ4 and every other level roughly doubles its cost.
+        std::pair<std::uint8_t, int> select_codec(
+            std::vector<char> const& buffer)
+        {
+            auto_compression_parameters const& params = get_parameters();
+
+            std::size_t const size = buffer.size();
+            if (size < params.min_size || size == 0)
+                return std::make_pair(codec_none, 0);
+
+            std::size_t const num_samples = 4;
+            std::size_t const sample_size = 4096;
+            std::size_t const stride = size / num_samples;
+
+            std::vector<char> scratch(std::size_t(
+                LZ4_compressBound(static_cast<int>(sample_size))));
+
+            std::size_t sampled = 0;
+            std::size_t compressed = 0;
+
+            std::int64_t started_at = hpx::chrono::high_resolution_clock::now();
+            for (std::size_t i = 0; i != num_samples; ++i)
+            {
+                std::size_t offset = i * stride;
+                std::size_t count = (std::min)(sample_size, size - offset);
+
+                int result = LZ4_compress_default(&buffer[offset],
+                    scratch.data(), static_cast<int>(count),
+                    static_cast<int>(scratch.size()));
+                if (result <= 0)
+                    return std::make_pair(codec_none, 0);
+
+                sampled += count;
+                compressed += std::size_t(result);
+            }
+            std::int64_t elapsed = (std::max)(std::int64_t(1),
+                std::int64_t(hpx::chrono::high_resolution_clock::now() -
+                    started_at));
+
+            double ratio = double(compressed) / double(sampled);
+            if (ratio > params.max_ratio)
+                return std::make_pair(codec_none, 0);
+
+            // time saved on the wire per time spent compressing with LZ4
+            double speed = double(sampled) / double(elapsed);
+            double gain = speed * (1.0 - ratio) / params.bandwidth;
+            if (gain < 1.0)
+                return std::make_pair(codec_none, 0);
+
+            if (gain < 8.0 || params.max_level <= 0)
+                return std::make_pair(codec_lz4, 0);
+
+            int level = 1;
+            for (gain /= 8.0; gain >= 2.0 && level + 2 <= params.max_level;
+                 gain /= 2.0)
+            {
+                level += 2;
+            }
+            return std::make_pair(codec_zstd, level);
+        }
+    }
+
+    void auto_serialization_filter::set_max_length(std::size_t size)
+    {
+        buffer_.reserve(size);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    std::size_t auto_serialization_filter::init_data(
+        char const* buffer, std::size_t size, std::size_t buffer_size)
+    {
+        if (size == 0)
+        {
+            HPX_THROW_EXCEPTION(serialization_error,
+                "auto_serialization_filter::init_data",
+                "archive data bstream is too short");
+            return 0;
+        }
+
+        buffer_.resize(buffer_size);
+        current_ = 0;
+
+        std::uint8_t const codec = static_cast<std::uint8_t>(buffer[0]);
+        if (codec == detail::codec_none)
+        {
+            if (size - 1 > buffer_size)
+            {
+                HPX_THROW_EXCEPTION(serialization_error,
+                    "auto_serialization_filter::init_data",
+                    "archive data bstream is too long");
+                return 0;
+            }
+
+            std::memcpy(buffer_.data(), buffer + 1, size - 1);
+            return buffer_.size();
+        }
+
+        std::uint64_t raw_size = 0;
+        std::uint64_t block_size = 0;
+        std::uint32_t num_blocks = 0;
+        if (size >= detail::header_size(0))
+        {
+            std::memcpy(&raw_size, buffer + 1, sizeof(raw_size));
+            std::memcpy(&block_size, buffer + 9, sizeof(block_size));
+            std::memcpy(&num_blocks, buffer + 17, sizeof(num_blocks));
+        }
+
+        if ((codec != detail::codec_lz4 && codec != detail::codec_zstd) ||
+            size < detail::header_size(num_blocks) || raw_size > buffer_size ||
+            block_size == 0 ||
+            num_blocks != (raw_size + block_size - 1) / block_size)
+        {
+            HPX_THROW_EXCEPTION(serialization_error,
+                "auto_serialization_filter::init_data",
+                "archive data bstream is corrupted");
+            return 0;
+        }
+
+        // locate the compressed blocks
+        std::vector<std::uint32_t> sizes(num_blocks);
+        std::vector<std::size_t> offsets(num_blocks);
+
+        std::size_t const header = detail::header_size(num_blocks);
+        std::size_t pos = header;
+        for (std::uint32_t i = 0; i != num_blocks; ++i)
+        {
+            std::memcpy(&sizes[i], buffer + 21 + 4 * i, sizeof(std::uint32_t));
+            offsets[i] = pos;
+            pos += sizes[i];
+        }
+
+        if (pos > size)
+        {
+            HPX_THROW_EXCEPTION(serialization_error,
+                "auto_serialization_filter::init_data",
+                "archive data bstream is too short");
+            return 0;
+        }
+
+        detail::for_each_block(num_blocks, [&](std::size_t i) {
+            std::size_t offset = i * std::size_t(block_size);
+            detail::decompress_block(codec, buffer + offsets[i], sizes[i],
+                &buffer_[offset],
+                (std::min)(std::size_t(block_size),
+                    std::size_t(raw_size) - offset));
+        });
+
+        return buffer_.size();
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void auto_serialization_filter::load(void* dst, std::size_t dst_count)
+    {
+        if (current_+dst_count > buffer_.size())
+        {
+            HPX_THROW_EXCEPTION(serialization_error,
+                    "auto_serialization_filter::load",
+                    "archive data bstream is too short");
+            return;
+        }
+
+        std::memcpy(dst, &buffer_[current_], dst_count);
+        current_ += dst_count;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void auto_serialization_filter::save(void const* src,
+        std::size_t src_count)
+    {
+        char const* src_begin = static_cast<char const*>(src);
+        std::copy(src_begin, src_begin+src_count, std::back_inserter(buffer_));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    bool auto_serialization_filter::flush(void* dst, std::size_t dst_count,
+        std::size_t& written)
+    {
+        if (!selected_)
+        {
+            std::pair<std::uint8_t, int> codec = detail::select_codec(buffer_);
+            codec_ = codec.first;
+            level_ = codec.second;
+            selected_ = true;
+        }
+
+        char* out = static_cast<char*>(dst);
+        std::size_t const size = buffer_.size();
+
+        if (codec_ != detail::codec_none)
+        {
+            std::size_t const block_size =
+                detail::get_parameters().block_size;
+            std::size_t const num_blocks = (size + block_size - 1) / block_size;
+            std::size_t const header = detail::header_size(num_blocks);
+            std::size_t const bound = detail::compress_bound(
+                codec_, (std::min)(size, block_size));
+
+            // make sure we have enough memory
+            if (header + num_blocks * bound > dst_count)
+            {
+                written = 0;
+                return false;
+            }
+
+            // all blocks are compressed into separate slots first, which are
+            // compacted afterwards
+            std::vector<std::uint32_t> sizes(num_blocks);
+            detail::for_each_block(num_blocks, [&](std::size_t i) {
+                std::size_t offset = i * block_size;
+                sizes[i] = detail::compress_block(codec_, level_,
+                    &buffer_[offset], (std::min)(block_size, size - offset),
+                    out + header + i * bound, bound);
+            });
+
+            std::size_t pos = header;
+            for (std::size_t i = 0; i != num_blocks; ++i)
+            {
+                if (pos != header + i * bound)
+                    std::memmove(out + pos, out + header + i * bound, sizes[i]);
+                pos += sizes[i];
+            }
+
+            // send the data as is if compression did not pay off after all
+            if (pos < size + 1)
+            {
+                std::uint64_t raw_size = size;
+                std::uint64_t block_size64 = block_size;
+                std::uint32_t num_blocks32 =
+                    static_cast<std::uint32_t>(num_blocks);
+
+                out[0] = static_cast<char>(codec_);
+                std::memcpy(out + 1, &raw_size, sizeof(raw_size));
+                std::memcpy(out + 9, &block_size64, sizeof(block_size64));
+                std::memcpy(out + 17, &num_blocks32, sizeof(num_blocks32));
+                std::memcpy(out + 21, sizes.data(),
+                    num_blocks * sizeof(std::uint32_t));
+
+                written = pos;
+                return true;
+            }
+
+            codec_ = detail::codec_none;
+        }
+
+        if (size + 1 > dst_count)
+        {
+            written = 0;
+            return false;
+        }
+
+        out[0] = static_cast<char>(detail::codec_none);
+        if (size != 0)
+            std::memcpy(out + 1, buffer_.data(), size);
+
+        written = size + 1;
+        return true;
+    }
+}}}
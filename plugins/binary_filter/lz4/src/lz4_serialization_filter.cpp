@@ -0,0 +1,171 @@
+//  Copyright (c) 2020 STE||AR Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/modules/actions.hpp>
+#include <hpx/modules/format.hpp>
+#include <hpx/plugin/traits/plugin_config_data.hpp>
+#include <hpx/runtime_local/config_entry.hpp>
+#include <hpx/util/from_string.hpp>
+
+#include <hpx/plugins/plugin_registry.hpp>
+#include <hpx/plugins/binary_filter_factory.hpp>
+#include <hpx/plugins/binary_filter/lz4_serialization_filter.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+
+#include <lz4.h>
+
+namespace hpx { namespace traits
+{
+    // Inject additional configuration data into the factory registry for this
+    // type. This information ends up in the system wide configuration database
+    // under the plugin specific section:
+    //
+    //      [hpx.plugins.lz4_serialization_filter]
+    //      ...
+    //      acceleration = 1
+    //
+    template <>
+    struct plugin_config_data<
+        hpx::plugins::compression::lz4_serialization_filter>
+    {
+        static char const* call()
+        {
+            return "acceleration = 1";
+        }
+    };
+}}
+
+///////////////////////////////////////////////////////////////////////////////
+HPX_REGISTER_PLUGIN_MODULE();
+HPX_REGISTER_BINARY_FILTER_FACTORY(
+    hpx::plugins::compression::lz4_serialization_filter,
+    lz4_serialization_filter);
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace plugins { namespace compression
+{
+    namespace detail
+    {
+        int get_lz4_acceleration()
+        {
+            // filters are created for every message, read the setting once
+            static int const acceleration =
+                (std::max)(1, hpx::util::from_string<int>(
+                    hpx::get_config_entry(
+                        "hpx.plugins.lz4_serialization_filter.acceleration",
+                        "1"), 1));
+            return acceleration;
+        }
+    }
+
+    lz4_serialization_filter::lz4_serialization_filter(bool compress,
+            serialization::binary_filter* /* next_filter */)
+      : current_(0)
+      , acceleration_(compress ? detail::get_lz4_acceleration() : 1)
+    {
+    }
+
+    void lz4_serialization_filter::set_max_length(std::size_t size)
+    {
+        buffer_.reserve(size);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    std::size_t lz4_serialization_filter::init_data(
+        char const* buffer, std::size_t size, std::size_t buffer_size)
+    {
+        if (size > std::size_t(LZ4_MAX_INPUT_SIZE) ||
+            buffer_size > std::size_t(LZ4_MAX_INPUT_SIZE))
+        {
+            HPX_THROW_EXCEPTION(serialization_error,
+                "lz4_serialization_filter::init_data",
+                "archive data bstream is too large");
+            return 0;
+        }
+
+        buffer_.resize(buffer_size);
+        int decompressed = LZ4_decompress_safe(buffer, buffer_.data(),
+            static_cast<int>(size), static_cast<int>(buffer_size));
+        if (decompressed < 0)
+        {
+            HPX_THROW_EXCEPTION(serialization_error,
+                "lz4_serialization_filter::init_data",
+                hpx::util::format("decompression failure, number of "
+                    "bytes expected: {}, error code: {}",
+                    buffer_size, decompressed));
+            return 0;
+        }
+
+        current_ = 0;
+        return buffer_.size();
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void lz4_serialization_filter::load(void* dst, std::size_t dst_count)
+    {
+        if (current_+dst_count > buffer_.size())
+        {
+            HPX_THROW_EXCEPTION(serialization_error,
+                    "lz4_serialization_filter::load",
+                    "archive data bstream is too short");
+            return;
+        }
+
+        std::memcpy(dst, &buffer_[current_], dst_count);
+        current_ += dst_count;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void lz4_serialization_filter::save(void const* src,
+        std::size_t src_count)
+    {
+        char const* src_begin = static_cast<char const*>(src);
+        std::copy(src_begin, src_begin+src_count, std::back_inserter(buffer_));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    bool lz4_serialization_filter::flush(void* dst, std::size_t dst_count,
+        std::size_t& written)
+    {
+        if (buffer_.size() > std::size_t(LZ4_MAX_INPUT_SIZE))
+        {
+            HPX_THROW_EXCEPTION(serialization_error,
+                "lz4_serialization_filter::flush",
+                "archive data bstream is too large");
+            return false;
+        }
+
+        // make sure we have enough memory
+        int const size = static_cast<int>(buffer_.size());
+        std::size_t needed = std::size_t(LZ4_compressBound(size));
+        if (needed > dst_count)
+        {
+            written = 0;
+            return false;
+        }
+
+        // compress everything in one go
+        int compressed_length = LZ4_compress_fast(buffer_.data(),
+            static_cast<char*>(dst), size, static_cast<int>(needed),
+            acceleration_);
+
+        if (compressed_length <= 0 && size != 0)
+        {
+            HPX_THROW_EXCEPTION(serialization_error,
+                "lz4_serialization_filter::flush",
+                "compression failure, flushing did not reach end of data");
+            return false;
+        }
+
+        written = std::size_t(compressed_length);
+        return true;
+    }
+}}}
@@ -0,0 +1,151 @@
+//  Copyright (c) 2020 STE||AR Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/modules/actions.hpp>
+#include <hpx/modules/format.hpp>
+#include <hpx/plugin/traits/plugin_config_data.hpp>
+#include <hpx/runtime_local/config_entry.hpp>
+#include <hpx/util/from_string.hpp>
+
+#include <hpx/plugins/plugin_registry.hpp>
+#include <hpx/plugins/binary_filter_factory.hpp>
+#include <hpx/plugins/binary_filter/zstd_serialization_filter.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+
+#include <zstd.h>
+
+namespace hpx { namespace traits
+{
+    // Inject additional configuration data into the factory registry for this
+    // type. This information ends up in the system wide configuration database
+    // under the plugin specific section:
+    //
+    //      [hpx.plugins.zstd_serialization_filter]
+    //      ...
+    //      level = 3
+    //
+    template <>
+    struct plugin_config_data<
+        hpx::plugins::compression::zstd_serialization_filter>
+    {
+        static char const* call()
+        {
+            return "level = 3";
+        }
+    };
+}}
+
+///////////////////////////////////////////////////////////////////////////////
+HPX_REGISTER_PLUGIN_MODULE();
+HPX_REGISTER_BINARY_FILTER_FACTORY(
+    hpx::plugins::compression::zstd_serialization_filter,
+    zstd_serialization_filter);
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace plugins { namespace compression
+{
+    namespace detail
+    {
+        int get_zstd_level()
+        {
+            // filters are created for every message, read the setting once
+            static int const level = (std::min)(ZSTD_maxCLevel(),
+                hpx::util::from_string<int>(hpx::get_config_entry(
+                    "hpx.plugins.zstd_serialization_filter.level", "3"), 3));
+            return level;
+        }
+    }
+
+    zstd_serialization_filter::zstd_serialization_filter(bool compress,
+            serialization::binary_filter* /* next_filter */)
+      : current_(0)
+      , level_(compress ? detail::get_zstd_level() : 0)
+    {
+    }
+
+    void zstd_serialization_filter::set_max_length(std::size_t size)
+    {
+        buffer_.reserve(size);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    std::size_t zstd_serialization_filter::init_data(
+        char const* buffer, std::size_t size, std::size_t buffer_size)
+    {
+        buffer_.resize(buffer_size);
+        std::size_t decompressed =
+            ZSTD_decompress(buffer_.data(), buffer_size, buffer, size);
+        if (ZSTD_isError(decompressed))
+        {
+            HPX_THROW_EXCEPTION(serialization_error,
+                "zstd_serialization_filter::init_data",
+                hpx::util::format("decompression failure, number of "
+                    "bytes expected: {}, error: {}",
+                    buffer_size, ZSTD_getErrorName(decompressed)));
+            return 0;
+        }
+
+        current_ = 0;
+        return buffer_.size();
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void zstd_serialization_filter::load(void* dst, std::size_t dst_count)
+    {
+        if (current_+dst_count > buffer_.size())
+        {
+            HPX_THROW_EXCEPTION(serialization_error,
+                    "zstd_serialization_filter::load",
+                    "archive data bstream is too short");
+            return;
+        }
+
+        std::memcpy(dst, &buffer_[current_], dst_count);
+        current_ += dst_count;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void zstd_serialization_filter::save(void const* src,
+        std::size_t src_count)
+    {
+        char const* src_begin = static_cast<char const*>(src);
+        std::copy(src_begin, src_begin+src_count, std::back_inserter(buffer_));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    bool zstd_serialization_filter::flush(void* dst, std::size_t dst_count,
+        std::size_t& written)
+    {
+        // make sure we have enough memory
+        std::size_t needed = ZSTD_compressBound(buffer_.size());
+        if (needed > dst_count)
+        {
+            written = 0;
+            return false;
+        }
+
+        // compress everything in one go
+        std::size_t compressed_length = ZSTD_compress(
+            dst, dst_count, buffer_.data(), buffer_.size(), level_);
+
+        if (ZSTD_isError(compressed_length))
+        {
+            HPX_THROW_EXCEPTION(serialization_error,
+                "zstd_serialization_filter::flush",
+                hpx::util::format("compression failure: {}",
+                    ZSTD_getErrorName(compressed_length)));
+            return false;
+        }
+
+        written = compressed_length;
+        return true;
+    }
+}}}
@@ -36,7 +36,8 @@ namespace hpx { namespace plugins { namespace parcel
         get_counter_type num_parcels, get_counter_type num_messages,
         get_counter_type num_parcels_per_message,
         get_counter_type average_time_between_parcels,
-        get_counter_values_creator_type time_between_parcels_histogram_creator)
+        get_counter_values_creator_type time_between_parcels_histogram_creator,
+        get_counter_type num_messages_limit, get_counter_type flush_interval)
     {
         if (name.empty())
         {
@@ -55,7 +56,8 @@ namespace hpx { namespace plugins { namespace parcel
                 num_parcels, num_messages,
                 num_parcels_per_message, average_time_between_parcels,
                 time_between_parcels_histogram_creator,
-                0, 0, 1
+                0, 0, 1,
+                num_messages_limit, flush_interval
             };
 
             map_.emplace(name, std::move(data));
@@ -70,6 +72,8 @@ namespace hpx { namespace plugins { namespace parcel
                 average_time_between_parcels;
             (*it).second.time_between_parcels_histogram_creator =
                 time_between_parcels_histogram_creator;
+            (*it).second.num_messages_limit = num_messages_limit;
+            (*it).second.flush_interval = flush_interval;
 
             if ((*it).second.min_boundary != (*it).second.max_boundary)
             {
@@ -86,6 +90,8 @@ namespace hpx { namespace plugins { namespace parcel
             (void) (*it).second.num_parcels_per_message;
             (void) (*it).second.average_time_between_parcels;
             (void) (*it).second.time_between_parcels_histogram_creator;
+            (void) (*it).second.num_messages_limit;
+            (void) (*it).second.flush_interval;
         }
     }
 
@@ -181,6 +187,42 @@ namespace hpx { namespace plugins { namespace parcel
         return (*it).second.average_time_between_parcels;
     }
 
+    coalescing_counter_registry::get_counter_type
+        coalescing_counter_registry::get_num_messages_limit_counter(
+            std::string const& name) const
+    {
+        std::unique_lock<mutex_type> l(mtx_);
+
+        map_type::const_iterator it = map_.find(name);
+        if (it == map_.end())
+        {
+            l.unlock();
+            HPX_THROW_EXCEPTION(bad_parameter,
+                "coalescing_counter_registry::get_num_messages_limit_counter",
+                "unknown action type");
+            return get_counter_type();
+        }
+        return (*it).second.num_messages_limit;
+    }
+
+    coalescing_counter_registry::get_counter_type
+        coalescing_counter_registry::get_flush_interval_counter(
+            std::string const& name) const
+    {
+        std::unique_lock<mutex_type> l(mtx_);
+
+        map_type::const_iterator it = map_.find(name);
+        if (it == map_.end())
+        {
+            l.unlock();
+            HPX_THROW_EXCEPTION(bad_parameter,
+                "coalescing_counter_registry::get_flush_interval_counter",
+                "unknown action type");
+            return get_counter_type();
+        }
+        return (*it).second.flush_interval;
+    }
+
     coalescing_counter_registry::get_counter_values_type
         coalescing_counter_registry::get_time_between_parcels_histogram_counter(
             std::string const& name, std::int64_t min_boundary,
@@ -25,11 +25,14 @@
 
 #include <boost/accumulators/accumulators.hpp>
 
+#include <algorithm>
+#include <atomic>
 #include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <mutex>
 #include <string>
+#include <system_error>
 #include <utility>
 #include <vector>
 
@@ -43,6 +46,7 @@ namespace hpx { namespace traits
     //      ...
     //      num_messages = 50
     //      interval = 100
+    //      adaptive = 0
     //
     template <>
     struct plugin_config_data<hpx::plugins::parcel::coalescing_message_handler>
@@ -51,7 +55,8 @@ namespace hpx { namespace traits
         {
             return "num_messages = 50\n"
                    "interval = 100\n"
-                   "allow_background_flush = 1";
+                   "allow_background_flush = 1\n"
+                   "adaptive = 0";
         }
     };
 }}
@@ -87,6 +92,13 @@ namespace hpx { namespace plugins { namespace parcel
                 "1");
             return !value.empty() && value[0] != '0';
         }
+
+        bool get_adaptive()
+        {
+            std::string value = hpx::get_config_entry(
+                "hpx.plugins.coalescing_message_handler.adaptive", "0");
+            return !value.empty() && value[0] != '0';
+        }
     }
 
     void coalescing_message_handler::update_num_messages()
@@ -102,6 +114,60 @@ namespace hpx { namespace plugins { namespace parcel
         interval_ = detail::get_interval(interval_);
     }
 
+    void coalescing_message_handler::update_adaptive()
+    {
+        std::lock_guard<mutex_type> l(mtx_);
+        adaptive_ = detail::get_adaptive();
+    }
+
+    // New samples are weighted with 1/8 for all moving averages below. The
+    // batch size and interval are recomputed for every parcel:
+    //
+    //  - waiting for more parcels longer than it takes to write a message
+    //    adds more latency than coalescing can save, so the flush interval
+    //    is the average write time (bounded by the configured interval)
+    //  - the batch size is the number of parcels expected to arrive within
+    //    that interval (bounded by the configured number of messages)
+    //
+    // Sparse traffic leads to a batch size of one, i.e. parcels are sent
+    // immediately, while a storm of parcels fills the largest allowed
+    // batches.
+    void coalescing_message_handler::adapt(std::int64_t time_since_last_parcel)
+    {
+        std::int64_t const max_interval = std::int64_t(interval_) * 1000;
+
+        // all gaps larger than the interval mean the same: traffic is sparse,
+        // limiting the sample allows to quickly react to a starting storm
+        std::int64_t const sample =
+            (std::min)(time_since_last_parcel, 2 * max_interval);
+        average_time_between_parcels_ +=
+            (sample - average_time_between_parcels_) / 8;
+
+        std::int64_t interval = (std::min)(
+            average_write_time_.load(std::memory_order_relaxed), max_interval);
+        interval = (std::max)(interval, std::int64_t(1000));
+
+        std::int64_t num = std::int64_t(num_coalesced_parcels_);
+        if (average_time_between_parcels_ > 0)
+        {
+            num = (std::min)(num, interval / average_time_between_parcels_);
+        }
+
+        adaptive_num_messages_ = std::size_t((std::max)(num, std::int64_t(1)));
+        adaptive_interval_ = std::size_t(interval / 1000);
+    }
+
+    void coalescing_message_handler::message_written(std::int64_t started_at)
+    {
+        // concurrent updates may lose a sample, which is benign here
+        std::int64_t const sample =
+            hpx::chrono::high_resolution_clock::now() - started_at;
+        std::int64_t average =
+            average_write_time_.load(std::memory_order_relaxed);
+        average_write_time_.store(
+            average + (sample - average) / 8, std::memory_order_relaxed);
+    }
+
     coalescing_message_handler::coalescing_message_handler(
             char const* action_name, parcelset::parcelport* pp, std::size_t num,
             std::size_t interval)
@@ -116,6 +182,11 @@ namespace hpx { namespace plugins { namespace parcel
         stopped_(false),
         allow_background_flush_(detail::get_background_flush()),
         action_name_(action_name),
+        adaptive_(detail::get_adaptive()),
+        adaptive_num_messages_(1),
+        adaptive_interval_(interval_),
+        average_time_between_parcels_(std::int64_t(interval_) * 1000),
+        average_write_time_(std::int64_t(interval_) * 1000),
         num_parcels_(0), reset_num_parcels_(0),
             reset_num_parcels_per_message_parcels_(0),
         num_messages_(0), reset_num_messages_(0),
@@ -136,7 +207,11 @@ namespace hpx { namespace plugins { namespace parcel
             util::bind_front(&coalescing_message_handler::
                 get_average_time_between_parcels, this),
             util::bind_front(&coalescing_message_handler::
-                get_time_between_parcels_histogram_creator, this));
+                get_time_between_parcels_histogram_creator, this),
+            util::bind_front(
+                &coalescing_message_handler::get_num_messages_limit, this),
+            util::bind_front(
+                &coalescing_message_handler::get_flush_interval, this));
 
         // register parameter update callbacks
         set_config_entry_callback(
@@ -145,6 +220,9 @@ namespace hpx { namespace plugins { namespace parcel
         set_config_entry_callback(
             "hpx.plugins.coalescing_message_handler.interval",
             util::bind(&coalescing_message_handler::update_interval, this));
+        set_config_entry_callback(
+            "hpx.plugins.coalescing_message_handler.adaptive",
+            util::bind(&coalescing_message_handler::update_adaptive, this));
     }
 
     void coalescing_message_handler::put_parcel(
@@ -163,14 +241,24 @@ namespace hpx { namespace plugins { namespace parcel
         if (time_between_parcels_)
             (*time_between_parcels_)(time_since_last_parcel);
 
+        std::size_t num_messages = num_coalesced_parcels_;
         std::chrono::microseconds interval(interval_);
 
+        if (adaptive_)
+        {
+            adapt(time_since_last_parcel);
+            num_messages = adaptive_num_messages_;
+            interval = std::chrono::microseconds(adaptive_interval_);
+        }
+
         // just send parcel if the coalescing was stopped or the buffer is
-        // empty and time since last parcel is larger than coalescing interval.
+        // empty and time since last parcel is larger than coalescing interval
+        // (or no other parcel is expected to arrive in time).
         if (stopped_ ||
             (buffer_.empty() &&
-                std::chrono::nanoseconds(time_since_last_parcel) > interval
-           ))
+                (num_messages <= 1 ||
+                    std::chrono::nanoseconds(time_since_last_parcel) >
+                        interval)))
         {
             ++num_messages_;
             l.unlock();
@@ -183,6 +271,13 @@ namespace hpx { namespace plugins { namespace parcel
         detail::message_buffer::message_buffer_append_state s =
             buffer_.append(dest, std::move(p), std::move(f));
 
+        // the buffer is allocated for the largest allowed batch size
+        if (s != detail::message_buffer::buffer_now_full &&
+            buffer_.size() >= num_messages)
+        {
+            s = detail::message_buffer::buffer_now_full;
+        }
+
         switch(s) {
         case detail::message_buffer::first_message:
             HPX_FALLTHROUGH;
@@ -271,6 +366,13 @@ namespace hpx { namespace plugins { namespace parcel
         detail::message_buffer buff (num_coalesced_parcels_);
         std::swap(buff, buffer_);
 
+        if (adaptive_)
+        {
+            buff.on_written(
+                [this, started_at = hpx::chrono::high_resolution_clock::now()](
+                    std::error_code const&) { message_written(started_at); });
+        }
+
         ++num_messages_;
         l.unlock();
 
@@ -421,6 +523,21 @@ namespace hpx { namespace plugins { namespace parcel
             get_time_between_parcels_histogram, this);
     }
 
+    std::int64_t coalescing_message_handler::get_num_messages_limit(
+        bool /* reset */)
+    {
+        std::lock_guard<mutex_type> l(mtx_);
+        return std::int64_t(
+            adaptive_ ? adaptive_num_messages_ : num_coalesced_parcels_);
+    }
+
+    std::int64_t coalescing_message_handler::get_flush_interval(
+        bool /* reset */)
+    {
+        std::lock_guard<mutex_type> l(mtx_);
+        return std::int64_t(adaptive_ ? adaptive_interval_ : interval_);
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     // register the given action (called during startup)
     void coalescing_message_handler::register_action(char const* action,
@@ -0,0 +1,241 @@
+//  Copyright (c) 2020 STE||AR Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/config/asio.hpp>
+#include <hpx/execution_base/this_thread.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/plugins/parcelport/shmem/connection_handler.hpp>
+#include <hpx/plugins/parcelport/shmem/inbox.hpp>
+#include <hpx/plugins/parcelport/shmem/receiver.hpp>
+#include <hpx/plugins/parcelport/shmem/sender.hpp>
+#include <hpx/plugins/parcelport/shmem/shared_memory.hpp>
+#include <hpx/runtime/parcelset/locality.hpp>
+#include <hpx/runtime_configuration/runtime_configuration.hpp>
+#include <hpx/threading_base/thread_data.hpp>
+#include <hpx/threading_base/thread_helpers.hpp>
+#include <hpx/util/get_entry_as.hpp>
+
+#include <boost/asio/ip/host_name.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+
+#include <unistd.h>
+
+namespace hpx { namespace parcelset { namespace policies { namespace shmem
+{
+    namespace {
+        std::int32_t this_pid()
+        {
+            return static_cast<std::int32_t>(::getpid());
+        }
+
+        parcelset::locality parcelport_address()
+        {
+            return parcelset::locality(
+                locality(boost::asio::ip::host_name(), this_pid()));
+        }
+
+        // the capacity of the ring buffers has to be a power of two
+        std::size_t ring_size(util::runtime_configuration const& ini)
+        {
+            std::size_t size = hpx::util::get_entry_as<std::size_t>(
+                ini, "hpx.parcel.shmem.ring_size", 1048576);
+
+            std::size_t capacity = 4096;
+            while (capacity < size)
+                capacity <<= 1;
+            return capacity;
+        }
+    }    // namespace
+
+    ///////////////////////////////////////////////////////////////////////////
+    sender::connection_ptr sender::create_connection(
+        parcelset::locality const& dest, parcelset::parcelport* pp,
+        error_code& ec)
+    {
+        std::int32_t const dst = dest.get<locality>().pid();
+        std::uint32_t const seq = ++next_seq_;
+
+        if (!process_exists(dst))
+        {
+            HPX_THROWS_IF(ec, network_error,
+                "shmem::sender::create_connection",
+                "the destination process does not exist anymore: " +
+                    std::to_string(dst));
+            return connection_ptr();
+        }
+
+        // a shared memory object using our id is a leftover of a previous
+        // process which was not shut down cleanly
+        std::string name = ring_name(dst, pid_, seq);
+        shared_memory::unlink(name);
+
+        shared_memory segment;
+        if (!segment.create(name, ring_buffer::segment_size(ring_size_)))
+        {
+            HPX_THROWS_IF(ec, network_error,
+                "shmem::sender::create_connection",
+                "could not create the shared memory object: " + name);
+            return connection_ptr();
+        }
+
+        connection_ptr connection = std::make_shared<connection_type>(
+            this, ring_buffer(std::move(segment)), name, dest, pp);
+
+        // tell the destination about the new connection
+        shared_memory inbox_segment;
+        if (!inbox_segment.open(inbox_name(dst)) ||
+            inbox_segment.size() < sizeof(inbox))
+        {
+            shared_memory::unlink(name);
+            HPX_THROWS_IF(ec, network_error,
+                "shmem::sender::create_connection",
+                "could not open the inbox of the destination: " +
+                    inbox_name(dst));
+            return connection_ptr();
+        }
+
+        // the inbox stays full if the destination has gone away
+        inbox* in = static_cast<inbox*>(inbox_segment.data());
+        bool gone = false;
+        hpx::util::yield_while(
+            [&]() {
+                if (in->announce(pid_, seq))
+                    return false;
+                gone = !process_exists(dst);
+                return !gone;
+            },
+            "shmem::sender::create_connection");
+
+        if (gone)
+        {
+            HPX_THROWS_IF(ec, network_error,
+                "shmem::sender::create_connection",
+                "the destination process does not exist anymore: " +
+                    std::to_string(dst));
+            return connection_ptr();
+        }
+
+        return connection;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    connection_handler::connection_handler(
+        util::runtime_configuration const& ini,
+        threads::policies::callback_notifier const& notifier)
+      : base_type(ini, parcelport_address(), notifier)
+      , stopped_(false)
+      , sender_(this_pid(), ring_size(ini))
+      , receiver_(*this, this_pid())
+    {
+    }
+
+    connection_handler::~connection_handler()
+    {
+        receiver_.stop();
+    }
+
+    bool connection_handler::do_run()
+    {
+        if (!receiver_.run())
+        {
+            HPX_THROW_EXCEPTION(network_error, "shmem::parcelport::run",
+                "could not create the shared memory object: " +
+                    inbox_name(this_pid()));
+            return false;
+        }
+        return true;
+    }
+
+    void connection_handler::do_stop()
+    {
+        while (do_background_work(0, parcelport_background_mode_all))
+        {
+            if (threads::get_self_ptr())
+                hpx::this_thread::suspend(
+                    hpx::threads::thread_schedule_state::pending,
+                    "shmem::parcelport::do_stop");
+        }
+        stopped_ = true;
+
+        receiver_.stop();
+    }
+
+    std::string connection_handler::get_locality_name() const
+    {
+        return boost::asio::ip::host_name();
+    }
+
+    bool connection_handler::can_connect(
+        parcelset::locality const& dest, bool use_alternative_parcelport)
+    {
+        if (!use_alternative_parcelport || stopped_)
+            return false;
+
+        locality const& l = dest.get<locality>();
+        if (l.host() != here_.get<locality>().host())
+            return false;
+
+        // the destination may run in a separate container sharing the
+        // host name, but not the shared memory objects
+        std::lock_guard<lcos::local::spinlock> lk(reachable_mtx_);
+
+        auto it = reachable_.find(l.pid());
+        if (it == reachable_.end())
+        {
+            shared_memory segment;
+            it = reachable_.emplace(l.pid(),
+                segment.open(inbox_name(l.pid()))).first;
+        }
+        return it->second;
+    }
+
+    std::shared_ptr<sender_connection> connection_handler::create_connection(
+        parcelset::locality const& l, error_code& ec)
+    {
+        return sender_.create_connection(l, this, ec);
+    }
+
+    parcelset::locality connection_handler::agas_locality(
+        util::runtime_configuration const&) const
+    {
+        // this parcelport is never used for bootstrapping
+        return parcelset::locality(locality());
+    }
+
+    parcelset::locality connection_handler::create_locality() const
+    {
+        return parcelset::locality(locality());
+    }
+
+    bool connection_handler::background_work(
+        std::size_t num_thread, parcelport_background_mode mode)
+    {
+        if (stopped_)
+            return false;
+
+        bool has_work = false;
+        if (mode & parcelport_background_mode_send)
+        {
+            has_work = sender_.background_work();
+        }
+        if (mode & parcelport_background_mode_receive)
+        {
+            has_work = receiver_.background_work(num_thread) || has_work;
+        }
+        return has_work;
+    }
+}}}}
+
+#endif
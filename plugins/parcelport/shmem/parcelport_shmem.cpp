@@ -0,0 +1,57 @@
+//  Copyright (c) 2020 STE||AR Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/plugin/traits/plugin_config_data.hpp>
+
+#include <hpx/plugins/parcelport/shmem/connection_handler.hpp>
+#include <hpx/plugins/parcelport/shmem/sender.hpp>
+#include <hpx/plugins/parcelport_factory.hpp>
+
+namespace hpx { namespace traits
+{
+    // Inject additional configuration data into the factory registry for this
+    // type. This information ends up in the system wide configuration database
+    // under the plugin specific section:
+    //
+    //      [hpx.parcel.shmem]
+    //      ...
+    //      priority = 200
+    //
+    // The priority is higher than the one of all other parcelports which
+    // makes sure that destinations on the same host use shared memory.
+    template <>
+    struct plugin_config_data<
+        hpx::parcelset::policies::shmem::connection_handler>
+    {
+        static char const* priority()
+        {
+            return "200";
+        }
+
+        static void init(int* /* argc */, char*** /* argv */,
+            util::command_line_handling& /* cfg */)
+        {
+        }
+
+        static void destroy() {}
+
+        static char const* call()
+        {
+            return
+                "ring_size = ${HPX_PARCEL_SHMEM_RING_SIZE:1048576}\n"
+                ;
+        }
+    };
+}}
+
+HPX_REGISTER_PARCELPORT(
+    hpx::parcelset::policies::shmem::connection_handler,
+    shmem);
+
+#endif
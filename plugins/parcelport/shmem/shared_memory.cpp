@@ -0,0 +1,174 @@
+//  Copyright (c) 2020 STE||AR Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/execution_base/this_thread.hpp>
+#include <hpx/plugins/parcelport/shmem/inbox.hpp>
+#include <hpx/plugins/parcelport/shmem/shared_memory.hpp>
+
+#include <atomic>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include <fcntl.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace hpx { namespace parcelset { namespace policies { namespace shmem
+{
+    ///////////////////////////////////////////////////////////////////////////
+    std::string inbox_name(std::int32_t pid)
+    {
+        return "/hpx.shmem." + std::to_string(pid);
+    }
+
+    std::string ring_name(
+        std::int32_t dst, std::int32_t src, std::uint32_t seq)
+    {
+        return "/hpx.shmem." + std::to_string(dst) + "." +
+            std::to_string(src) + "." + std::to_string(seq);
+    }
+
+    bool process_exists(std::int32_t pid) noexcept
+    {
+        // a process we are not allowed to signal exists nevertheless
+        return ::kill(static_cast<pid_t>(pid), 0) == 0 || errno != ESRCH;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    bool shared_memory::create(std::string const& name, std::size_t size)
+    {
+        close();
+
+        int fd = ::shm_open(name.c_str(), O_RDWR | O_CREAT | O_EXCL, 0600);
+        if (fd == -1)
+            return false;
+
+        if (::ftruncate(fd, static_cast<off_t>(size)) == -1)
+        {
+            ::close(fd);
+            ::shm_unlink(name.c_str());
+            return false;
+        }
+
+        void* data =
+            ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        ::close(fd);
+
+        if (data == MAP_FAILED)
+        {
+            ::shm_unlink(name.c_str());
+            return false;
+        }
+
+        data_ = data;
+        size_ = size;
+        return true;
+    }
+
+    bool shared_memory::open(std::string const& name)
+    {
+        close();
+
+        int fd = ::shm_open(name.c_str(), O_RDWR, 0600);
+        if (fd == -1)
+            return false;
+
+        struct stat st;
+        if (::fstat(fd, &st) == -1 || st.st_size == 0)
+        {
+            ::close(fd);
+            return false;
+        }
+
+        std::size_t size = static_cast<std::size_t>(st.st_size);
+        void* data =
+            ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        ::close(fd);
+
+        if (data == MAP_FAILED)
+            return false;
+
+        data_ = data;
+        size_ = size;
+        return true;
+    }
+
+    void shared_memory::close() noexcept
+    {
+        if (data_ != nullptr)
+        {
+            ::munmap(data_, size_);
+            data_ = nullptr;
+            size_ = 0;
+        }
+    }
+
+    void shared_memory::unlink(std::string const& name) noexcept
+    {
+        ::shm_unlink(name.c_str());
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    namespace {
+        struct inbox_lock
+        {
+            explicit inbox_lock(std::atomic<std::uint32_t>& lock)
+              : lock_(lock)
+            {
+                for (std::size_t k = 0;
+                     lock_.exchange(1, std::memory_order_acquire) != 0; ++k)
+                {
+                    hpx::util::detail::yield_k(
+                        k, "hpx::parcelset::policies::shmem::inbox_lock");
+                }
+            }
+
+            ~inbox_lock()
+            {
+                lock_.store(0, std::memory_order_release);
+            }
+
+            std::atomic<std::uint32_t>& lock_;
+        };
+    }    // namespace
+
+    bool inbox::announce(std::int32_t src, std::uint32_t seq)
+    {
+        inbox_lock l(lock_);
+
+        std::uint32_t count = count_.load(std::memory_order_relaxed);
+        if (count == capacity)
+            return false;
+
+        src_[count] = src;
+        seq_[count] = seq;
+        count_.store(count + 1, std::memory_order_relaxed);
+        return true;
+    }
+
+    std::size_t inbox::take(std::int32_t* src, std::uint32_t* seq)
+    {
+        inbox_lock l(lock_);
+
+        std::size_t count = count_.load(std::memory_order_relaxed);
+        for (std::size_t i = 0; i != count; ++i)
+        {
+            src[i] = src_[i];
+            seq[i] = seq_[i];
+        }
+        count_.store(0, std::memory_order_relaxed);
+        return count;
+    }
+}}}}
+
+#endif
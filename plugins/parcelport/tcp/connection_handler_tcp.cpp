@@ -20,15 +20,19 @@
 #include <hpx/asio/asio_util.hpp>
 #include <hpx/assert.hpp>
 #include <hpx/functional/bind.hpp>
+#include <hpx/execution_base/this_thread.hpp>
 #include <hpx/futures/future.hpp>
 #include <hpx/modules/errors.hpp>
 #include <hpx/plugins/parcelport/tcp/connection_handler.hpp>
+#include <hpx/plugins/parcelport/tcp/io_uring_service.hpp>
 #include <hpx/plugins/parcelport/tcp/receiver.hpp>
 #include <hpx/plugins/parcelport/tcp/sender.hpp>
 #include <hpx/runtime/parcelset/locality.hpp>
 #include <hpx/runtime_configuration/runtime_configuration.hpp>
+#include <hpx/runtime_local/runtime_local_fwd.hpp>
 #include <hpx/util/get_entry_as.hpp>
 
+#include <boost/asio/buffer.hpp>
 #include <boost/asio/ip/tcp.hpp>
 #include <boost/system/error_code.hpp>
 #include <boost/system/system_error.hpp>
@@ -44,6 +48,10 @@
 #include <string>
 #include <system_error>
 
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+#include <unistd.h>
+#endif
+
 namespace hpx { namespace parcelset { namespace policies { namespace tcp
 {
     parcelset::locality parcelport_address(util::runtime_configuration const & ini)
@@ -75,12 +83,43 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
         threads::policies::callback_notifier const& notifier)
       : base_type(ini, parcelport_address(ini), notifier)
       , acceptor_(nullptr)
+      , stopped_(false)
     {
         if (here_.type() != std::string("tcp")) {
             HPX_THROW_EXCEPTION(network_error, "tcp::parcelport::parcelport",
                 "this parcelport was instantiated to represent an unexpected "
                 "locality type: " + std::string(here_.type()));
         }
+
+        std::string backend = ini.get_entry("hpx.parcel.tcp.backend", "asio");
+        if (backend == "io_uring")
+        {
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+            uring_.reset(new io_uring_service(
+                hpx::util::get_entry_as<std::size_t>(
+                    ini, "hpx.parcel.tcp.io_uring_entries", 256)));
+            uring_event_value_ = 0;
+            uring_waiting_.store(false);
+            if (!uring_->valid())
+            {
+                LPT_(warning)
+                    << "tcp::parcelport: io_uring is not supported by this "
+                       "system, falling back to asio";
+                uring_.reset();
+            }
+#else
+            LPT_(warning)
+                << "tcp::parcelport: io_uring support was not enabled at "
+                   "configuration time (HPX_WITH_PARCELPORT_TCP_IO_URING), "
+                   "falling back to asio";
+#endif
+        }
+        else if (backend != "asio")
+        {
+            HPX_THROW_EXCEPTION(bad_parameter, "tcp::parcelport::parcelport",
+                "unknown value for hpx.parcel.tcp.backend: " + backend +
+                " (expected asio or io_uring)");
+        }
     }
 
     connection_handler::~connection_handler()
@@ -105,7 +144,8 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
         {
             try {
                 std::shared_ptr<receiver> receiver_conn(
-                    new receiver(io_service, get_max_inbound_message_size(), *this));
+                    new receiver(io_service, get_max_inbound_message_size(),
+                        *this, get_io_uring()));
 
                 tcp::endpoint ep = *it;
                 acceptor_->open(ep.protocol());
@@ -129,9 +169,101 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
                 "tcp::parcelport::run", errors.get_message());
             return false;
         }
+
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+        if (uring_)
+        {
+            {
+                // the eventfd itself is owned by the io_uring instance
+                std::lock_guard<lcos::local::spinlock> l(uring_event_mtx_);
+                uring_event_.reset(new boost::asio::posix::stream_descriptor(
+                    io_service, ::dup(uring_->event_fd())));
+            }
+            start_io_uring_wait();
+        }
+#endif
         return true;
     }
 
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+    // The scheduler reaps the completions of the io_uring instance while HPX
+    // is running. While the runtime is starting up or shutting down the
+    // io_service waits for the eventfd of the io_uring instance to be
+    // signalled and reaps the completions instead.
+    void connection_handler::start_io_uring_wait()
+    {
+        bool expected = false;
+        if (!uring_waiting_.compare_exchange_strong(expected, true))
+            return;
+
+        // operations queued from now on signal the eventfd as well, pick up
+        // the ones queued before
+        uring_->notify_on_enqueue(true);
+        uring_->poll();
+
+        std::lock_guard<lcos::local::spinlock> l(uring_event_mtx_);
+        if (stopped_ || !uring_event_)
+        {
+            uring_->notify_on_enqueue(false);
+            uring_waiting_ = false;
+            return;
+        }
+        wait_for_io_uring();
+    }
+
+    void connection_handler::wait_for_io_uring()
+    {
+        uring_event_->async_read_some(
+            boost::asio::buffer(
+                &uring_event_value_, sizeof(uring_event_value_)),
+            [this](std::error_code const& e, std::size_t) {
+                handle_io_uring_event(e);
+            });
+    }
+
+    void connection_handler::handle_io_uring_event(std::error_code const& e)
+    {
+        if (!e && !hpx::is_running())
+        {
+            uring_->poll();
+
+            std::lock_guard<lcos::local::spinlock> l(uring_event_mtx_);
+            if (!stopped_)
+            {
+                wait_for_io_uring();
+                return;
+            }
+        }
+
+        // the scheduler takes over
+        uring_->notify_on_enqueue(false);
+        uring_waiting_ = false;
+    }
+#endif
+
+    io_uring_service* connection_handler::get_io_uring() const
+    {
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+        return uring_.get();
+#else
+        return nullptr;
+#endif
+    }
+
+    bool connection_handler::background_work(
+        std::size_t /* num_thread */, parcelport_background_mode /* mode */)
+    {
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+        if (uring_ && !stopped_)
+        {
+            if (!hpx::is_running())
+                start_io_uring_wait();
+            return uring_->poll();
+        }
+#endif
+        return false;
+    }
+
     void connection_handler::do_stop()
     {
         {
@@ -154,6 +286,31 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
             delete acceptor_;
             acceptor_ = nullptr;
         }
+
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+        // complete all operations still in flight, the receive operations
+        // fail as their sockets have been shut down above
+        if (uring_)
+        {
+            hpx::util::yield_while(
+                [this]() {
+                    uring_->poll();
+                    return uring_->outstanding() != 0;
+                },
+                "tcp::connection_handler::do_stop");
+
+            // finish waiting for the eventfd to let the io_service run out
+            // of work
+            std::lock_guard<lcos::local::spinlock> l(uring_event_mtx_);
+            stopped_ = true;
+            if (uring_event_)
+            {
+                boost::system::error_code ec;
+                uring_event_->close(ec);
+            }
+        }
+#endif
+        stopped_ = true;
     }
 
     std::shared_ptr<sender> connection_handler::create_connection(
@@ -163,7 +320,8 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
 
         // The parcel gets serialized inside the connection constructor, no
         // need to keep the original parcel alive after this call returned.
-        std::shared_ptr<sender> sender_connection(new sender(io_service, l, this));
+        std::shared_ptr<sender> sender_connection(
+            new sender(io_service, l, this, get_io_uring()));
 
         // Connect to the target locality, retry if needed
         boost::system::error_code error = boost::asio::error::try_again;
@@ -298,7 +456,7 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
 
             boost::asio::io_service& io_service = io_service_pool_.get_io_service();
             receiver_conn.reset(new receiver(io_service, get_max_inbound_message_size(),
-                *this));
+                *this, get_io_uring()));
             acceptor_->async_accept(receiver_conn->socket(),
                 util::bind(&connection_handler::handle_accept,
                     this,
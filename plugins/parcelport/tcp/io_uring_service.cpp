@@ -0,0 +1,515 @@
+//  Copyright (c) 2020 STE||AR Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// hpxinspect:nodeprecatedinclude:boost/system/error_code.hpp
+// hpxinspect:nodeprecatedname:boost::system::error_code
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_TCP) &&        \
+    defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+#include <hpx/assert.hpp>
+#include <hpx/plugins/parcelport/tcp/io_uring_service.hpp>
+
+#include <boost/asio/error.hpp>
+#include <boost/system/error_code.hpp>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#include <linux/io_uring.h>
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+namespace hpx { namespace parcelset { namespace policies { namespace tcp
+{
+    namespace {
+        int io_uring_setup(unsigned entries, io_uring_params* p)
+        {
+            return static_cast<int>(::syscall(__NR_io_uring_setup, entries, p));
+        }
+
+        int io_uring_enter(int fd, unsigned to_submit)
+        {
+            return static_cast<int>(::syscall(__NR_io_uring_enter, fd,
+                to_submit, 0, 0, nullptr, 0));
+        }
+
+        int io_uring_register(int fd, unsigned opcode, void* arg,
+            unsigned nr_args)
+        {
+            return static_cast<int>(::syscall(__NR_io_uring_register, fd,
+                opcode, arg, nr_args));
+        }
+
+        void* map_ring(int fd, std::size_t size, std::uint64_t offset)
+        {
+            void* p = ::mmap(nullptr, size, PROT_READ | PROT_WRITE,
+                MAP_SHARED | MAP_POPULATE, fd, static_cast<off_t>(offset));
+            return p == MAP_FAILED ? nullptr : p;
+        }
+
+        unsigned* ring_field(void* ring, std::uint32_t offset)
+        {
+            return reinterpret_cast<unsigned*>(
+                static_cast<char*>(ring) + offset);
+        }
+
+        std::error_code make_system_error(int err)
+        {
+            return std::error_code(boost::system::error_code(
+                err, boost::system::system_category()));
+        }
+    }    // namespace
+
+    ///////////////////////////////////////////////////////////////////////////
+    struct io_uring_service::operation
+    {
+        operation(int fd, bool send, std::vector<iovec>&& buffers,
+                handler_type&& handler)
+          : fd_(fd)
+          , send_(send)
+          , buffers_(std::move(buffers))
+          , first_(0)
+          , transferred_(0)
+          , cancelled_(false)
+          , prev_(nullptr)
+          , next_(nullptr)
+          , handler_(std::move(handler))
+        {
+            // empty buffers would be reported as a closed connection
+            buffers_.erase(std::remove_if(buffers_.begin(), buffers_.end(),
+                    [](iovec const& v) { return v.iov_len == 0; }),
+                buffers_.end());
+        }
+
+        // Account for the given number of transferred bytes, returns true
+        // if all buffers have been handled.
+        bool consume(std::size_t bytes)
+        {
+            transferred_ += bytes;
+            while (first_ != buffers_.size() &&
+                bytes >= buffers_[first_].iov_len)
+            {
+                bytes -= buffers_[first_].iov_len;
+                ++first_;
+            }
+            if (first_ == buffers_.size())
+                return true;
+
+            iovec& v = buffers_[first_];
+            v.iov_base = static_cast<char*>(v.iov_base) + bytes;
+            v.iov_len -= bytes;
+            return false;
+        }
+
+        int fd_;
+        bool send_;
+        std::vector<iovec> buffers_;
+        std::size_t first_;
+        std::size_t transferred_;
+        bool cancelled_;
+
+        // links the operations in flight
+        operation* prev_;
+        operation* next_;
+
+        // referenced by the kernel until the operation has completed
+        msghdr msg_;
+
+        handler_type handler_;
+        std::error_code error_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    io_uring_service::io_uring_service(std::size_t entries)
+      : ring_fd_(-1)
+      , event_fd_(-1)
+      , sq_ring_(nullptr)
+      , sq_ring_size_(0)
+      , cq_ring_(nullptr)
+      , cq_ring_size_(0)
+      , sqes_(nullptr)
+      , sqes_size_(0)
+      , sq_head_(nullptr)
+      , sq_tail_(nullptr)
+      , sq_mask_(0)
+      , sq_array_(nullptr)
+      , sq_entries_(0)
+      , cq_head_(nullptr)
+      , cq_tail_(nullptr)
+      , cq_mask_(0)
+      , cqes_(nullptr)
+      , cq_entries_(0)
+      , in_flight_(0)
+      , in_flight_ops_(nullptr)
+      , outstanding_(0)
+      , notify_(false)
+    {
+        io_uring_params p;
+        std::memset(&p, 0, sizeof(p));
+
+        // the completion queue is sized such that all connections can have
+        // an operation in flight without overflowing it
+        p.flags = IORING_SETUP_CQSIZE;
+        p.cq_entries = static_cast<std::uint32_t>(4 * entries);
+
+        int fd = io_uring_setup(static_cast<unsigned>(entries), &p);
+        if (fd < 0)
+            return;
+
+        // we rely on the kernel not to drop completions
+        if (!(p.features & IORING_FEAT_NODROP))
+        {
+            ::close(fd);
+            return;
+        }
+
+        sq_ring_size_ = p.sq_off.array + p.sq_entries * sizeof(unsigned);
+        cq_ring_size_ = p.cq_off.cqes + p.cq_entries * sizeof(io_uring_cqe);
+        bool const single_mmap = (p.features & IORING_FEAT_SINGLE_MMAP) != 0;
+        if (single_mmap)
+        {
+            sq_ring_size_ = (std::max)(sq_ring_size_, cq_ring_size_);
+            cq_ring_size_ = 0;
+        }
+
+        sq_ring_ = map_ring(fd, sq_ring_size_, IORING_OFF_SQ_RING);
+        cq_ring_ = single_mmap ? sq_ring_ :
+            map_ring(fd, cq_ring_size_, IORING_OFF_CQ_RING);
+        sqes_size_ = p.sq_entries * sizeof(io_uring_sqe);
+        sqes_ = map_ring(fd, sqes_size_, IORING_OFF_SQES);
+
+        ring_fd_ = fd;
+        if (sq_ring_ == nullptr || cq_ring_ == nullptr || sqes_ == nullptr)
+        {
+            release();
+            return;
+        }
+
+        sq_head_ = ring_field(sq_ring_, p.sq_off.head);
+        sq_tail_ = ring_field(sq_ring_, p.sq_off.tail);
+        sq_mask_ = *ring_field(sq_ring_, p.sq_off.ring_mask);
+        sq_array_ = ring_field(sq_ring_, p.sq_off.array);
+        sq_entries_ = p.sq_entries;
+
+        cq_head_ = ring_field(cq_ring_, p.cq_off.head);
+        cq_tail_ = ring_field(cq_ring_, p.cq_off.tail);
+        cq_mask_ = *ring_field(cq_ring_, p.cq_off.ring_mask);
+        cqes_ = static_cast<char*>(cq_ring_) + p.cq_off.cqes;
+        cq_entries_ = p.cq_entries;
+
+        // have the kernel signal all completions on an eventfd
+        event_fd_ = ::eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+        if (event_fd_ < 0 ||
+            io_uring_register(
+                ring_fd_, IORING_REGISTER_EVENTFD, &event_fd_, 1) < 0)
+        {
+            release();
+        }
+    }
+
+    io_uring_service::~io_uring_service()
+    {
+        release();
+
+        // Operations still in flight are cancelled asynchronously by the
+        // kernel once the ring has been closed, those are leaked on purpose
+        // as the kernel might still reference them. The parcelport waits
+        // for all operations to complete before it is stopped.
+        for (operation* op : pending_)
+            delete op;
+        pending_.clear();
+
+        for (operation* op : aborted_)
+            delete op;
+        aborted_.clear();
+    }
+
+    void io_uring_service::release()
+    {
+        if (ring_fd_ < 0)
+            return;
+
+        if (sqes_ != nullptr)
+            ::munmap(sqes_, sqes_size_);
+        if (cq_ring_ != nullptr && cq_ring_ != sq_ring_)
+            ::munmap(cq_ring_, cq_ring_size_);
+        if (sq_ring_ != nullptr)
+            ::munmap(sq_ring_, sq_ring_size_);
+        ::close(ring_fd_);
+        if (event_fd_ >= 0)
+            ::close(event_fd_);
+
+        sqes_ = nullptr;
+        cq_ring_ = nullptr;
+        sq_ring_ = nullptr;
+        ring_fd_ = -1;
+        event_fd_ = -1;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void io_uring_service::async_send(int fd, std::vector<iovec>&& buffers,
+        handler_type&& handler)
+    {
+        enqueue(new operation(fd, true, std::move(buffers),
+            std::move(handler)));
+    }
+
+    void io_uring_service::async_receive(int fd,
+        std::vector<iovec>&& buffers, handler_type&& handler)
+    {
+        enqueue(new operation(fd, false, std::move(buffers),
+            std::move(handler)));
+    }
+
+    void io_uring_service::enqueue(operation* op)
+    {
+        ++outstanding_;
+
+        {
+            std::lock_guard<mutex_type> l(pending_mtx_);
+            pending_.push_back(op);
+        }
+
+        if (notify_.load(std::memory_order_acquire))
+            ::eventfd_write(event_fd_, 1);
+    }
+
+    void io_uring_service::cancel(int fd)
+    {
+        if (ring_fd_ < 0)
+            return;
+
+        // poll_mtx_ is held only while submitting and reaping, which
+        // guarantees that no operation for this descriptor is moved between
+        // the queues while we look for them
+        std::lock_guard<mutex_type> ll(poll_mtx_);
+        for (operation* op = in_flight_ops_; op != nullptr; op = op->next_)
+        {
+            if (op->fd_ == fd)
+                op->cancelled_ = true;
+        }
+
+        std::lock_guard<mutex_type> l(pending_mtx_);
+        auto it = std::stable_partition(pending_.begin(), pending_.end(),
+            [fd](operation const* op) { return op->fd_ != fd; });
+        for (auto op_it = it; op_it != pending_.end(); ++op_it)
+        {
+            (*op_it)->error_ = std::error_code(
+                boost::asio::error::make_error_code(
+                    boost::asio::error::operation_aborted));
+            aborted_.push_back(*op_it);
+        }
+        pending_.erase(it, pending_.end());
+    }
+
+    void io_uring_service::link(operation* op)
+    {
+        op->prev_ = nullptr;
+        op->next_ = in_flight_ops_;
+        if (in_flight_ops_ != nullptr)
+            in_flight_ops_->prev_ = op;
+        in_flight_ops_ = op;
+        ++in_flight_;
+    }
+
+    void io_uring_service::unlink(operation* op)
+    {
+        if (op->prev_ != nullptr)
+            op->prev_->next_ = op->next_;
+        else
+            in_flight_ops_ = op->next_;
+        if (op->next_ != nullptr)
+            op->next_->prev_ = op->prev_;
+        op->prev_ = op->next_ = nullptr;
+
+        HPX_ASSERT(in_flight_ != 0);
+        --in_flight_;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Move as many of the pending operations into the submission queue as
+    // possible and hand all of them to the kernel with a single system
+    // call.
+    std::size_t io_uring_service::submit()
+    {
+        std::vector<operation*> ops;
+        {
+            std::lock_guard<mutex_type> l(pending_mtx_);
+            std::swap(ops, pending_);
+        }
+
+        unsigned tail = *sq_tail_;
+        unsigned const head = __atomic_load_n(sq_head_, __ATOMIC_ACQUIRE);
+
+        std::size_t count = 0;
+        for (/**/; count != ops.size(); ++count)
+        {
+            // don't overflow either of the queues
+            if (tail - head == sq_entries_ || in_flight_ == cq_entries_)
+                break;
+
+            operation* op = ops[count];
+
+            std::memset(&op->msg_, 0, sizeof(op->msg_));
+            op->msg_.msg_iov = op->buffers_.data() + op->first_;
+            op->msg_.msg_iovlen = op->buffers_.size() - op->first_;
+
+            unsigned const index = tail & sq_mask_;
+            io_uring_sqe* sqe = static_cast<io_uring_sqe*>(sqes_) + index;
+            std::memset(sqe, 0, sizeof(io_uring_sqe));
+
+            sqe->opcode = op->send_ ? IORING_OP_SENDMSG : IORING_OP_RECVMSG;
+            sqe->fd = op->fd_;
+            sqe->addr = reinterpret_cast<std::uint64_t>(&op->msg_);
+            sqe->len = 1;
+            sqe->msg_flags = op->send_ ? MSG_NOSIGNAL : MSG_WAITALL;
+            sqe->user_data = reinterpret_cast<std::uint64_t>(op);
+
+            sq_array_[index] = index;
+            ++tail;
+            link(op);
+        }
+
+        if (count != ops.size())
+        {
+            // put back what didn't fit, preserving the order of operations
+            std::lock_guard<mutex_type> l(pending_mtx_);
+            pending_.insert(pending_.begin(), ops.begin() + count, ops.end());
+        }
+
+        __atomic_store_n(sq_tail_, tail, __ATOMIC_RELEASE);
+
+        // submit everything the kernel hasn't consumed yet, this includes
+        // entries left over from previous calls
+        unsigned const to_submit =
+            tail - __atomic_load_n(sq_head_, __ATOMIC_ACQUIRE);
+        if (to_submit != 0)
+            io_uring_enter(ring_fd_, to_submit);
+
+        return count;
+    }
+
+    // Retrieve all available completions, returns the number of completion
+    // queue entries consumed.
+    std::size_t io_uring_service::reap(std::vector<operation*>& completed)
+    {
+        unsigned head = *cq_head_;
+        unsigned const tail = __atomic_load_n(cq_tail_, __ATOMIC_ACQUIRE);
+
+        std::size_t count = 0;
+        std::vector<operation*> resubmit;
+        for (/**/; head != tail; ++head, ++count)
+        {
+            io_uring_cqe const& cqe =
+                static_cast<io_uring_cqe const*>(cqes_)[head & cq_mask_];
+
+            operation* op = reinterpret_cast<operation*>(cqe.user_data);
+            int const res = cqe.res;
+
+            unlink(op);
+
+            bool done = true;
+            if (res < 0)
+            {
+                if (res == -EINTR || res == -EAGAIN)
+                    done = false;
+                else
+                    op->error_ = make_system_error(-res);
+            }
+            else if (res == 0 && !op->send_)
+            {
+                op->error_ = std::error_code(
+                    boost::asio::error::make_error_code(
+                        boost::asio::error::eof));
+            }
+            else
+            {
+                // continue with the remaining data of a partial transfer
+                done = op->consume(static_cast<std::size_t>(res));
+            }
+
+            if (!done)
+            {
+                // the descriptor might have been closed (and reused) since
+                if (!op->cancelled_)
+                {
+                    resubmit.push_back(op);
+                    continue;
+                }
+                op->error_ = std::error_code(
+                    boost::asio::error::make_error_code(
+                        boost::asio::error::operation_aborted));
+            }
+            completed.push_back(op);
+        }
+
+        __atomic_store_n(cq_head_, head, __ATOMIC_RELEASE);
+
+        if (!resubmit.empty())
+        {
+            std::lock_guard<mutex_type> l(pending_mtx_);
+            pending_.insert(
+                pending_.begin(), resubmit.begin(), resubmit.end());
+        }
+        return count;
+    }
+
+    bool io_uring_service::poll()
+    {
+        if (ring_fd_ < 0)
+            return false;
+
+        std::vector<operation*> completed;
+        {
+            std::unique_lock<mutex_type> l(poll_mtx_, std::try_to_lock);
+            if (!l)
+                return false;
+
+            std::size_t count = reap(completed);
+            count += submit();
+
+            {
+                std::lock_guard<mutex_type> ll(pending_mtx_);
+                count += aborted_.size();
+                completed.insert(
+                    completed.end(), aborted_.begin(), aborted_.end());
+                aborted_.clear();
+            }
+
+            if (count == 0)
+                return false;
+        }
+
+        // the handlers are invoked without holding any locks as they
+        // usually start the next operation on the same connection
+        for (operation* op : completed)
+        {
+            handler_type handler = std::move(op->handler_);
+            std::error_code const error = op->error_;
+            std::size_t const transferred = op->transferred_;
+            delete op;
+
+            --outstanding_;
+            handler(error, transferred);
+        }
+        return true;
+    }
+}}}}
+
+#endif
@@ -22,7 +22,11 @@ namespace hpx { namespace traits
     //      [hpx.parcel.tcp]
     //      ...
     //      priority = 1
+    //      backend = asio
+    //      io_uring_entries = 256
     //
+    // The backend can be set to io_uring on Linux, see
+    // HPX_WITH_PARCELPORT_TCP_IO_URING.
     template <>
     struct plugin_config_data<hpx::parcelset::policies::tcp::connection_handler>
     {
@@ -40,7 +44,10 @@ namespace hpx { namespace traits
 
         static char const* call()
         {
-            return "";
+            return
+                "backend = ${HPX_PARCEL_TCP_BACKEND:asio}\n"
+                "io_uring_entries = ${HPX_PARCEL_TCP_IO_URING_ENTRIES:256}\n"
+                ;
         }
     };
 }}
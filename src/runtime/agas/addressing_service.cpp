@@ -53,8 +53,10 @@
 #include <hpx/serialization/serialize.hpp>
 #include <hpx/serialization/vector.hpp>
 #include <hpx/thread_support/unlock_guard.hpp>
+#include <hpx/timing/high_resolution_clock.hpp>
 #include <hpx/traits/action_was_object_migrated.hpp>
 #include <hpx/type_support/unused.hpp>
+#include <hpx/util/get_and_reset_value.hpp>
 #include <hpx/util/get_entry_as.hpp>
 #include <hpx/util/insert_checked.hpp>
 
@@ -72,80 +74,21 @@
 
 namespace hpx { namespace agas
 {
-    struct addressing_service::gva_cache_key
-    {    // {{{ gva_cache_key implementation
-    private:
-        typedef std::pair<naming::gid_type, naming::gid_type> key_type;
-
-        key_type key_;
-
-    public:
-        gva_cache_key()
-          : key_()
-        {
-        }
-
-        explicit gva_cache_key(
-                naming::gid_type const& id, std::uint64_t count = 1)
-          : key_(naming::detail::get_stripped_gid(id),
-                naming::detail::get_stripped_gid(id) + (count - 1))
-        {
-            HPX_ASSERT(count);
-        }
-
-        naming::gid_type get_gid() const
-        {
-            return key_.first;
-        }
-
-        std::uint64_t get_count() const
-        {
-            naming::gid_type const size = key_.second - key_.first;
-            HPX_ASSERT(size.get_msb() == 0);
-            return size.get_lsb();
-        }
-
-        friend bool operator<(
-            gva_cache_key const& lhs, gva_cache_key const& rhs)
-        {
-            return lhs.key_.second < rhs.key_.first;
-        }
-
-        friend bool operator==(
-            gva_cache_key const& lhs, gva_cache_key const& rhs)
-        {
-            // Direct hit
-            if (lhs.key_ == rhs.key_)
-            {
-                return true;
-            }
-
-            // Is lhs in rhs?
-            if (1 == lhs.get_count() && 1 != rhs.get_count())
-            {
-                return rhs.key_.first <= lhs.key_.first &&
-                    lhs.key_.second <= rhs.key_.second;
-            }
-
-            // Is rhs in lhs?
-            else if (1 != lhs.get_count() && 1 == rhs.get_count())
-            {
-                return lhs.key_.first <= rhs.key_.first &&
-                    rhs.key_.second <= lhs.key_.second;
-            }
-
-            return false;
-        }
-    }; // }}}
-
     addressing_service::addressing_service(
         util::runtime_configuration const& ini_, runtime_mode runtime_type_)
       : gva_cache_(new gva_cache_type)
+      , migrated_objects_count_(0)
       , console_cache_(naming::invalid_locality_id)
       , max_refcnt_requests_(ini_.get_agas_max_pending_refcnt_requests())
+      , max_refcnt_requests_delay_(
+            ini_.get_agas_max_pending_refcnt_delay() * 1000)
       , refcnt_requests_count_(0)
+      , refcnt_requests_start_time_(0)
       , enable_refcnt_caching_(true)
       , refcnt_requests_(new refcnt_requests_type)
+      , refcnt_requests_cancelled_(0)
+      , refcnt_requests_coalesced_(0)
+      , refcnt_requests_sent_(0)
       , service_type(ini_.get_agas_service_mode())
       , runtime_type(runtime_type_)
       , caching_(ini_.get_agas_caching_mode())
@@ -911,6 +854,75 @@ hpx::future<bool> addressing_service::bind_range_async(
         )));
 }
 
+hpx::future<std::vector<bool>> addressing_service::bind_async(
+    std::vector<naming::gid_type> const& ids
+  , std::vector<naming::address> const& addrs
+  , naming::gid_type const& locality
+    )
+{
+    HPX_ASSERT(ids.size() == addrs.size());
+
+    // group the requests by the service instance managing the ids
+    std::map<naming::gid_type, std::vector<std::size_t>> indices;
+    for (std::size_t i = 0; i != ids.size(); ++i)
+    {
+        indices[primary_namespace::get_service_instance(ids[i])].push_back(i);
+    }
+
+    std::vector<hpx::future<std::vector<bool>>> requests;
+    requests.reserve(indices.size());
+
+    for (auto const& p : indices)
+    {
+        std::vector<primary_namespace::bind_request_type> bind_requests;
+        bind_requests.reserve(p.second.size());
+
+        for (std::size_t i : p.second)
+        {
+            naming::address const& addr = addrs[i];
+            bind_requests.emplace_back(
+                gva(addr.locality_, addr.type_, 1, addr.address_, 0),
+                naming::detail::get_stripped_gid_except_dont_cache(ids[i]),
+                locality);
+        }
+
+        requests.push_back(primary_ns_.bind_gids_async(
+            std::move(bind_requests)));
+    }
+
+    return hpx::when_all(std::move(requests)).then(hpx::launch::sync,
+        [this, ids, addrs, indices = std::move(indices)](
+            hpx::future<std::vector<hpx::future<std::vector<bool>>>> f)
+        {
+            std::vector<hpx::future<std::vector<bool>>> requests = f.get();
+            std::vector<bool> result(ids.size(), false);
+
+            std::size_t request = 0;
+            for (auto const& p : indices)
+            {
+                std::vector<bool> bound = requests[request++].get();
+                HPX_ASSERT(bound.size() == p.second.size());
+
+                for (std::size_t j = 0; j != p.second.size(); ++j)
+                {
+                    std::size_t i = p.second[j];
+                    result[i] = bound[j];
+                    if (!bound[j])
+                        continue;
+
+                    // a single id is bound, caching the range is the same
+                    // as caching the first id
+                    naming::address const& addr = addrs[i];
+                    update_cache_entry(
+                        naming::detail::get_stripped_gid_except_dont_cache(
+                            ids[i]),
+                        gva(addr.locality_, addr.type_, 1, addr.address_, 0));
+                }
+            }
+            return result;
+        });
+}
+
 hpx::future<naming::address> addressing_service::unbind_range_async(
     naming::gid_type const& lower_id
   , std::uint64_t count
@@ -969,7 +981,7 @@ bool addressing_service::is_local_address_cached(
     naming::gid_type id(naming::detail::get_stripped_gid_except_dont_cache(gid));
 
 #if defined(HPX_HAVE_NETWORKING)
-    if (naming::detail::is_migratable(gid))
+    if (naming::detail::is_migratable(gid) && has_migrated_objects())
     {
         std::lock_guard<mutex_type> lock(migrated_objects_mtx_);
         if (was_object_migrated_locked(id))
@@ -1222,7 +1234,7 @@ bool addressing_service::resolve_cached(
     }
 
     // force routing if target object was migrated
-    if (naming::detail::is_migratable(id))
+    if (naming::detail::is_migratable(id) && has_migrated_objects())
     {
         std::lock_guard<mutex_type> lock(migrated_objects_mtx_);
         if (was_object_migrated_locked(id))
@@ -1300,6 +1312,84 @@ hpx::future<naming::address> addressing_service::resolve_async(
     return resolve_full_async(gid);
 }
 
+hpx::future<std::vector<naming::address>> addressing_service::resolve_async(
+    std::vector<naming::gid_type> const& ids
+    )
+{
+    std::vector<naming::address> addrs(ids.size());
+
+    // Try the cache, group all remaining ids by the service instance
+    // managing them.
+    std::map<naming::gid_type, std::vector<std::size_t>> indices;
+    for (std::size_t i = 0; i != ids.size(); ++i)
+    {
+        naming::gid_type const& gid = ids[i];
+        if (!gid)
+        {
+            HPX_THROW_EXCEPTION(bad_parameter,
+                "addressing_service::resolve_async",
+                "invalid reference id");
+            return make_ready_future(std::vector<naming::address>());
+        }
+
+        if (caching_)
+        {
+            error_code ec;
+            if (resolve_cached(gid, addrs[i], ec))
+                continue;
+
+            if (ec)
+            {
+                return hpx::make_exceptional_future<
+                    std::vector<naming::address>>(
+                    hpx::detail::access_exception(ec));
+            }
+        }
+
+        indices[primary_namespace::get_service_instance(gid)].push_back(i);
+    }
+
+    if (indices.empty())
+        return make_ready_future(std::move(addrs));
+
+    // now ask the AGAS service instances, one request each
+    std::vector<hpx::future<std::vector<primary_namespace::resolved_type>>>
+        requests;
+    requests.reserve(indices.size());
+
+    for (auto const& p : indices)
+    {
+        std::vector<naming::gid_type> gids;
+        gids.reserve(p.second.size());
+        for (std::size_t i : p.second)
+            gids.push_back(ids[i]);
+
+        requests.push_back(primary_ns_.resolve_full(std::move(gids)));
+    }
+
+    return hpx::when_all(std::move(requests)).then(hpx::launch::sync,
+        [this, ids, addrs = std::move(addrs), indices = std::move(indices)](
+            hpx::future<std::vector<hpx::future<
+                std::vector<primary_namespace::resolved_type>>>> f) mutable
+        {
+            auto requests = f.get();
+
+            std::size_t request = 0;
+            for (auto const& p : indices)
+            {
+                auto reps = requests[request++].get();
+                HPX_ASSERT(reps.size() == p.second.size());
+
+                for (std::size_t j = 0; j != p.second.size(); ++j)
+                {
+                    std::size_t i = p.second[j];
+                    addrs[i] = resolved_address_postproc(ids[i], reps[j]);
+                }
+            }
+            return std::move(addrs);
+        });
+}
+
 hpx::future<naming::id_type> addressing_service::get_colocation_id_async(
     naming::id_type const& id
     )
@@ -1319,16 +1409,22 @@ hpx::future<naming::id_type> addressing_service::get_colocation_id_async(
 naming::address addressing_service::resolve_full_postproc(
     naming::gid_type const& id, future<primary_namespace::resolved_type> f
     )
+{
+    return resolved_address_postproc(id, f.get());
+}
+
+naming::address addressing_service::resolved_address_postproc(
+    naming::gid_type const& id, primary_namespace::resolved_type const& rep
+    )
 {
     using hpx::get;
 
     naming::address addr;
 
-    auto rep = f.get();
     if (get<0>(rep) == naming::invalid_gid || get<2>(rep) == naming::invalid_gid)
     {
         HPX_THROW_EXCEPTION(bad_parameter,
-            "addressing_service::resolve_full_postproc",
+            "addressing_service::resolved_address_postproc",
             "could no resolve global id");
         return addr;
     }
@@ -1616,10 +1712,12 @@ lcos::future<std::int64_t> addressing_service::incref_async(
                 // credit == decref (case no. 3): if the incref offsets any
                 // pending decref, just remove the pending decref request.
                 refcnt_requests_->erase(matches);
+                ++refcnt_requests_cancelled_;
             }
             else
             {
                 // credit < decref (case no. 2): do nothing
+                ++refcnt_requests_cancelled_;
             }
         }
         else
@@ -1694,9 +1792,16 @@ void addressing_service::decref(
         if (matches != refcnt_requests_->end())
         {
             matches->second -= credit;
+            ++refcnt_requests_coalesced_;
         }
         else
         {
+            if (refcnt_requests_->empty())
+            {
+                refcnt_requests_start_time_ = static_cast<std::int64_t>(
+                    hpx::chrono::high_resolution_clock::now());
+            }
+
             std::pair<iterator, bool> p =
                 refcnt_requests_->insert(mapping(raw, -credit));
 
@@ -1792,6 +1897,63 @@ lcos::future<bool> addressing_service::register_name_async(
     return f;
 } // }}}
 
+lcos::future<std::vector<bool>> addressing_service::register_names_async(
+    std::vector<std::string> const& names
+  , std::vector<naming::id_type> const& ids
+    )
+{ // {{{
+    HPX_ASSERT(names.size() == ids.size());
+
+    // We need to modify the reference counts.
+    std::vector<naming::gid_type> new_gids;
+    std::vector<std::int64_t> new_credits;
+    new_gids.reserve(ids.size());
+    new_credits.reserve(ids.size());
+
+    for (naming::id_type const& id : ids)
+    {
+        naming::gid_type& mutable_gid =
+            const_cast<naming::id_type&>(id).get_gid();
+        new_gids.push_back(
+            naming::detail::split_gid_if_needed(mutable_gid).get());
+        new_credits.push_back(
+            naming::detail::get_credit_from_gid(new_gids.back()));
+    }
+
+    future<std::vector<bool>> f =
+        symbol_ns_.bind_async(names, std::move(new_gids));
+
+    return f.then(hpx::launch::sync,
+        [ids = ids, new_credits = std::move(new_credits)](
+            future<std::vector<bool>> f) mutable
+        {
+            if (f.has_exception())
+            {
+                // Return the credits to the GIDs as the operation failed
+                for (std::size_t i = 0; i != ids.size(); ++i)
+                {
+                    if (new_credits[i] != 0)
+                    {
+                        naming::detail::add_credit_to_gid(
+                            ids[i].get_gid(), new_credits[i]);
+                    }
+                }
+                return f.get();
+            }
+
+            std::vector<bool> result = f.get();
+            for (std::size_t i = 0; i != ids.size(); ++i)
+            {
+                if (!result[i] && new_credits[i] != 0)
+                {
+                    naming::detail::add_credit_to_gid(
+                        ids[i].get_gid(), new_credits[i]);
+                }
+            }
+            return result;
+        });
+} // }}}
+
 ///////////////////////////////////////////////////////////////////////////////
 naming::id_type addressing_service::unregister_name(
     std::string const& name
@@ -1836,6 +1998,14 @@ lcos::future<naming::id_type> addressing_service::resolve_name_async(
     return symbol_ns_.resolve_async(name);
 } // }}}
 
+lcos::future<std::vector<naming::id_type>>
+addressing_service::resolve_names_async(
+    std::vector<std::string> const& names
+    )
+{ // {{{
+    return symbol_ns_.resolve_async(names);
+} // }}}
+
 namespace detail
 {
     hpx::future<hpx::id_type> on_register_event(hpx::future<bool> f,
@@ -1856,17 +2026,38 @@ namespace detail
 future<hpx::id_type> addressing_service::on_symbol_namespace_event(
     std::string const& name, bool call_for_past_events)
 {
+    // names already bound are served from the local name cache, if possible
+    if (call_for_past_events)
+    {
+        naming::id_type id;
+        if (symbol_ns_.get_cached_name(name, id))
+            return make_ready_future(std::move(id));
+    }
+
     lcos::promise<naming::id_type, naming::gid_type> p;
     auto result_f = p.get_future();
 
+    // the instance responsible for the name will notify this locality
+    // before the name is unbound, the result is cached only if no name was
+    // invalidated while waiting for it
+    std::uint64_t generation = symbol_ns_.get_cache_generation();
+
     hpx::future<bool> f =
         symbol_ns_.on_event(name, call_for_past_events, p.get_id());
 
-    return f.then(
+    hpx::future<hpx::id_type> result = f.then(
         hpx::launch::sync,
         util::one_shot(util::bind_back(
             &detail::on_register_event, std::move(result_f)
         )));
+
+    return result.then(hpx::launch::sync,
+        [this, name, generation](hpx::future<hpx::id_type> f)
+        {
+            hpx::id_type id = f.get();
+            symbol_ns_.cache_name(name, id, generation);
+            return id;
+        });
 }
 
 // Return all matching entries in the symbol namespace
@@ -1876,17 +2067,6 @@ hpx::future<addressing_service::iterate_names_return_type>
     return symbol_ns_.iterate_async(pattern);
 } // }}}
 
-// This function has to return false if the key is already in the cache (true
-// means go ahead with the cache update).
-bool check_for_collisions(
-    addressing_service::gva_cache_key const& new_key
-  , addressing_service::gva_cache_key const& old_key
-    )
-{
-    return (new_key.get_gid() != old_key.get_gid())
-        || (new_key.get_count() != old_key.get_count());
-}
-
 void addressing_service::update_cache_entry(
     naming::gid_type const& id
   , gva const& g
@@ -1946,33 +2126,33 @@ void addressing_service::update_cache_entry(
             "addressing_service::update_cache_entry, gid({1}), count({2})",
             gid, count);
 
-        const gva_cache_key key(gid, count);
-
+        if (!gva_cache_->update_if(gid, count, g))
         {
-            std::unique_lock<mutex_type> lock(gva_cache_mtx_);
-            if (!gva_cache_->update_if(key, g, check_for_collisions))
+            if (LAGAS_ENABLED(warning))
             {
-                if (LAGAS_ENABLED(warning))
-                {
-                    // Figure out who we collided with.
-                    addressing_service::gva_cache_key idbase;
-                    addressing_service::gva_cache_type::entry_type e;
-
-                    if (!gva_cache_->get_entry(key, idbase, e))
-                    {
-                        // This is impossible under sane conditions.
-                        lock.unlock();
-                        HPX_THROWS_IF(ec, invalid_data
-                          , "addressing_service::update_cache_entry"
-                          , "data corruption or lock error occurred in cache");
-                        return;
-                    }
+                // Figure out who we collided with.
+                naming::gid_type idbase;
+                gva e;
 
+                if (!gva_cache_->get_entry(gid, idbase, e))
+                {
+                    // The colliding entry may have been evicted concurrently
+                    // or the new range overlaps with an entry starting at a
+                    // different GID.
+                    LAGAS_(warning) << hpx::util::format(
+                        "addressing_service::update_cache_entry, "
+                        "aborting update due to key collision in cache, "
+                        "new_gid({1}), new_count({2})",
+                        gid, count);
+                }
+                else
+                {
                     LAGAS_(warning) << hpx::util::format(
                         "addressing_service::update_cache_entry, "
                         "aborting update due to key collision in cache, "
-                        "new_gid({1}), new_count({2}), old_gid({3}), old_count({4})",
-                        gid, count, idbase.get_gid(), idbase.get_count());
+                        "new_gid({1}), new_count({2}), old_gid({3}), "
+                        "old_count({4})",
+                        gid, count, idbase, e.count);
                 }
             }
         }
@@ -1997,24 +2177,20 @@ bool addressing_service::get_cache_entry(
     {
         return false;
     }
-    gva_cache_key k(gid);
-    gva_cache_key idbase_key;
-
-    std::unique_lock<mutex_type> lock(gva_cache_mtx_);
-    if(gva_cache_->get_entry(k, idbase_key, gva))
+    naming::gid_type idbase_gid;
+    if (gva_cache_->get_entry(gid, idbase_gid, gva))
     {
         const std::uint64_t id_msb =
             naming::detail::strip_internal_bits_from_gid(gid.get_msb());
 
-        if (HPX_UNLIKELY(id_msb != idbase_key.get_gid().get_msb()))
+        if (HPX_UNLIKELY(id_msb != idbase_gid.get_msb()))
         {
-            lock.unlock();
             HPX_THROWS_IF(ec, internal_server_error
               , "addressing_service::get_cache_entry"
               , "bad entry in cache, MSBs of GID base and GID do not match");
             return false;
         }
-        idbase = idbase_key.get_gid();
+        idbase = idbase_gid;
         return true;
     }
 
@@ -2037,8 +2213,6 @@ void addressing_service::clear_cache(
     try {
         LAGAS_(warning) << "addressing_service::clear_cache, clearing cache";
 
-        std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-
         gva_cache_->clear();
 
         if (&ec != &throws)
@@ -2084,13 +2258,7 @@ void addressing_service::remove_cache_entry(
     try {
         LAGAS_(warning) << "addressing_service::remove_cache_entry";
 
-        std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-
-        gva_cache_->erase(
-            [&gid](std::pair<gva_cache_key, gva> const& p)
-            {
-                return gid == p.first.get_gid();
-            });
+        gva_cache_->erase(gid);
 
         if (&ec != &throws)
             ec = make_success_code();
@@ -2235,83 +2403,87 @@ namespace detail
 // Helper functions to access the current cache statistics
 std::uint64_t addressing_service::get_cache_entries(bool /* reset */)
 {
-    std::lock_guard<mutex_type> lock(gva_cache_mtx_);
     return gva_cache_->size();
 }
 
 std::uint64_t addressing_service::get_cache_hits(bool reset)
 {
-    std::lock_guard<mutex_type> lock(gva_cache_mtx_);
     return gva_cache_->get_statistics().hits(reset);
 }
 
 std::uint64_t addressing_service::get_cache_misses(bool reset)
 {
-    std::lock_guard<mutex_type> lock(gva_cache_mtx_);
     return gva_cache_->get_statistics().misses(reset);
 }
 
 std::uint64_t addressing_service::get_cache_evictions(bool reset)
 {
-    std::lock_guard<mutex_type> lock(gva_cache_mtx_);
     return gva_cache_->get_statistics().evictions(reset);
 }
 
 std::uint64_t addressing_service::get_cache_insertions(bool reset)
 {
-    std::lock_guard<mutex_type> lock(gva_cache_mtx_);
     return gva_cache_->get_statistics().insertions(reset);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 std::uint64_t addressing_service::get_cache_get_entry_count(bool reset)
 {
-    std::lock_guard<mutex_type> lock(gva_cache_mtx_);
     return gva_cache_->get_statistics().get_get_entry_count(reset);
 }
 
 std::uint64_t addressing_service::get_cache_insertion_entry_count(bool reset)
 {
-    std::lock_guard<mutex_type> lock(gva_cache_mtx_);
     return gva_cache_->get_statistics().get_insert_entry_count(reset);
 }
 
 std::uint64_t addressing_service::get_cache_update_entry_count(bool reset)
 {
-    std::lock_guard<mutex_type> lock(gva_cache_mtx_);
     return gva_cache_->get_statistics().get_update_entry_count(reset);
 }
 
 std::uint64_t addressing_service::get_cache_erase_entry_count(bool reset)
 {
-    std::lock_guard<mutex_type> lock(gva_cache_mtx_);
     return gva_cache_->get_statistics().get_erase_entry_count(reset);
 }
 
 std::uint64_t addressing_service::get_cache_get_entry_time(bool reset)
 {
-    std::lock_guard<mutex_type> lock(gva_cache_mtx_);
     return gva_cache_->get_statistics().get_get_entry_time(reset);
 }
 
 std::uint64_t addressing_service::get_cache_insertion_entry_time(bool reset)
 {
-    std::lock_guard<mutex_type> lock(gva_cache_mtx_);
     return gva_cache_->get_statistics().get_insert_entry_time(reset);
 }
 
 std::uint64_t addressing_service::get_cache_update_entry_time(bool reset)
 {
-    std::lock_guard<mutex_type> lock(gva_cache_mtx_);
     return gva_cache_->get_statistics().get_update_entry_time(reset);
 }
 
 std::uint64_t addressing_service::get_cache_erase_entry_time(bool reset)
 {
-    std::lock_guard<mutex_type> lock(gva_cache_mtx_);
     return gva_cache_->get_statistics().get_erase_entry_time(reset);
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// Helper functions to access the reference counting statistics
+std::uint64_t addressing_service::get_refcnt_requests_cancelled(bool reset)
+{
+    return util::get_and_reset_value(refcnt_requests_cancelled_, reset);
+}
+
+std::uint64_t addressing_service::get_refcnt_requests_coalesced(bool reset)
+{
+    return util::get_and_reset_value(refcnt_requests_coalesced_, reset);
+}
+
+std::uint64_t addressing_service::get_refcnt_requests_sent(bool reset)
+{
+    return util::get_and_reset_value(refcnt_requests_sent_, reset);
+}
+
 /// Install performance counter types exposing properties from the local cache.
 void addressing_service::register_counter_types()
 { // {{{
@@ -2353,6 +2525,16 @@ void addressing_service::register_counter_types()
         util::bind_front(
             &addressing_service::get_cache_erase_entry_time, this));
 
+    util::function_nonser<std::int64_t(bool)> refcnt_requests_cancelled(
+        util::bind_front(
+            &addressing_service::get_refcnt_requests_cancelled, this));
+    util::function_nonser<std::int64_t(bool)> refcnt_requests_coalesced(
+        util::bind_front(
+            &addressing_service::get_refcnt_requests_coalesced, this));
+    util::function_nonser<std::int64_t(bool)> refcnt_requests_sent(
+        util::bind_front(
+            &addressing_service::get_refcnt_requests_sent, this));
+
     using util::placeholders::_1;
     using util::placeholders::_2;
     performance_counters::generic_counter_type_data const counter_types[] =
@@ -2481,6 +2663,36 @@ void addressing_service::register_counter_types()
           &performance_counters::locality_counter_discoverer,
           ""
         },
+        { "/agas/count/refcnt/cancelled",
+            performance_counters::counter_monotonically_increasing,
+          "returns the number of credit increments which were compensated "
+                "by buffered credit decrements and were not sent to AGAS",
+          HPX_PERFORMANCE_COUNTER_V1,
+          util::bind(&performance_counters::locality_raw_counter_creator,
+              _1, refcnt_requests_cancelled, _2),
+          &performance_counters::locality_counter_discoverer,
+          ""
+        },
+        { "/agas/count/refcnt/coalesced",
+            performance_counters::counter_monotonically_increasing,
+          "returns the number of credit decrements which were combined with "
+                "other buffered credit decrements before being sent to AGAS",
+          HPX_PERFORMANCE_COUNTER_V1,
+          util::bind(&performance_counters::locality_raw_counter_creator,
+              _1, refcnt_requests_coalesced, _2),
+          &performance_counters::locality_counter_discoverer,
+          ""
+        },
+        { "/agas/count/refcnt/sent",
+            performance_counters::counter_monotonically_increasing,
+          "returns the number of messages carrying buffered credit "
+                "decrements sent to AGAS",
+          HPX_PERFORMANCE_COUNTER_V1,
+          util::bind(&performance_counters::locality_raw_counter_creator,
+              _1, refcnt_requests_sent, _2),
+          &performance_counters::locality_counter_discoverer,
+          ""
+        },
     };
     performance_counters::install_counter_types(
         counter_types, sizeof(counter_types)/sizeof(counter_types[0]));
@@ -2520,6 +2732,25 @@ void addressing_service::garbage_collect(
     send_refcnt_requests_sync(l, ec);
 }
 
+void addressing_service::garbage_collect_if_due(
+    error_code& ec
+    )
+{
+    std::unique_lock<mutex_type> l(refcnt_requests_mtx_, std::try_to_lock);
+    if (!l.owns_lock()) return;     // no need to compete for garbage collection
+
+    if (refcnt_requests_->empty() ||
+        static_cast<std::int64_t>(hpx::chrono::high_resolution_clock::now()) -
+                refcnt_requests_start_time_ < max_refcnt_requests_delay_)
+    {
+        if (&ec != &throws)
+            ec = make_success_code();
+        return;
+    }
+
+    send_refcnt_requests_non_blocking(l, ec);
+}
+
 void addressing_service::send_refcnt_requests(
     std::unique_lock<addressing_service::mutex_type>& l
   , error_code& ec
@@ -2533,11 +2764,62 @@ void addressing_service::send_refcnt_requests(
         return;
     }
 
-    if (!enable_refcnt_caching_ || max_refcnt_requests_ == ++refcnt_requests_count_)
+    if (!enable_refcnt_caching_ ||
+        max_refcnt_requests_ <= ++refcnt_requests_count_)
+    {
         send_refcnt_requests_non_blocking(l, ec);
-
+    }
     else if (&ec != &throws)
+    {
         ec = make_success_code();
+    }
+}
+
+addressing_service::refcnt_requests_per_locality_type
+addressing_service::collect_refcnt_requests(
+    refcnt_requests_type const& requests
+    )
+{
+    refcnt_requests_per_locality_type result;
+
+    // The requests are sorted by GID, which allows to combine requests for
+    // consecutive GIDs carrying the same credit into a single range. The
+    // upper bound of each range is inclusive.
+    std::vector<
+        hpx::tuple<std::int64_t, naming::gid_type, naming::gid_type>
+    >* current = nullptr;
+
+    for (refcnt_requests_type::const_reference e : requests)
+    {
+        HPX_ASSERT(e.second < 0);
+
+        naming::gid_type raw(e.first);
+
+        if (current != nullptr)
+        {
+            auto& last = current->back();
+            naming::gid_type next(hpx::get<2>(last));
+            ++next;
+
+            if (hpx::get<0>(last) == e.second && next == raw &&
+                next.get_msb() == hpx::get<1>(last).get_msb())
+            {
+                hpx::get<2>(last) = raw;
+                ++refcnt_requests_coalesced_;
+                continue;
+            }
+        }
+
+        naming::id_type target(
+            primary_namespace::get_service_instance(raw)
+          , naming::id_type::unmanaged);
+
+        current = &result[target];
+        current->push_back(hpx::make_tuple(e.second, raw, raw));
+    }
+
+    refcnt_requests_sent_ += result.size();
+    return result;
 }
 
 #if defined(HPX_HAVE_AGAS_DUMP_REFCNT_ENTRIES)
@@ -2605,28 +2887,8 @@ void addressing_service::send_refcnt_requests_non_blocking(
 #endif
 
         // collect all requests for each locality
-        typedef
-            std::map<
-                naming::id_type,
-                std::vector<
-                    hpx::tuple<std::int64_t, naming::gid_type, naming::gid_type>
-                >
-            >
-            requests_type;
-        requests_type requests;
-
-        for (refcnt_requests_type::const_reference e : *p)
-        {
-            HPX_ASSERT(e.second < 0);
-
-            naming::gid_type raw(e.first);
-
-            naming::id_type target(
-                primary_namespace::get_service_instance(raw)
-              , naming::id_type::unmanaged);
-
-            requests[target].push_back(hpx::make_tuple(e.second, raw, raw));
-        }
+        typedef refcnt_requests_per_locality_type requests_type;
+        requests_type requests = collect_refcnt_requests(*p);
 
         // send requests to all locality
         requests_type::iterator end = requests.end();
@@ -2684,29 +2946,10 @@ addressing_service::send_refcnt_requests_async(
 #endif
 
     // collect all requests for each locality
-    typedef
-        std::map<
-            naming::id_type,
-            std::vector<
-                hpx::tuple<std::int64_t, naming::gid_type, naming::gid_type>
-            >
-        >
-        requests_type;
-    requests_type requests;
+    typedef refcnt_requests_per_locality_type requests_type;
+    requests_type requests = collect_refcnt_requests(*p);
 
     std::vector<hpx::future<std::vector<std::int64_t> > > lazy_results;
-    for (refcnt_requests_type::const_reference e : *p)
-    {
-        HPX_ASSERT(e.second < 0);
-
-        naming::gid_type raw(e.first);
-
-        naming::id_type target(
-            primary_namespace::get_service_instance(raw)
-          , naming::id_type::unmanaged);
-
-        requests[target].push_back(hpx::make_tuple(e.second, raw, raw));
-    }
 
     // send requests to all locality
     requests_type::const_iterator end = requests.end();
@@ -2791,6 +3034,7 @@ hpx::future<void> addressing_service::mark_as_migrated(
         {
             HPX_ASSERT(!expect_to_be_marked_as_migrating);
             migrated_objects_table_.insert(gid);
+            ++migrated_objects_count_;
         }
         else
         {
@@ -2832,6 +3076,7 @@ void addressing_service::unmark_as_migrated(
     if (it != migrated_objects_table_.end())
     {
         migrated_objects_table_.erase(it);
+        --migrated_objects_count_;
 
         // remove entry from cache
         if (caching_ && naming::detail::store_in_cache(gid_))
@@ -0,0 +1,670 @@
+//  Copyright (c) 2020 STE||AR Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
+#include <hpx/execution_base/this_thread.hpp>
+#include <hpx/runtime/agas/detail/gva_cache.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+#include <hpx/timing/high_resolution_clock.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace hpx { namespace agas { namespace detail
+{
+    namespace
+    {
+        // GIDs are compared as unsigned 128 bit numbers, all GIDs stored in
+        // the cache have their internal bits stripped
+        struct key
+        {
+            std::uint64_t msb;
+            std::uint64_t lsb;
+
+            friend bool operator<(key const& lhs, key const& rhs)
+            {
+                return lhs.msb < rhs.msb ||
+                    (lhs.msb == rhs.msb && lhs.lsb < rhs.lsb);
+            }
+
+            friend bool operator==(key const& lhs, key const& rhs)
+            {
+                return lhs.msb == rhs.msb && lhs.lsb == rhs.lsb;
+            }
+        };
+
+        key make_key(naming::gid_type const& gid)
+        {
+            return key{
+                naming::detail::strip_internal_bits_from_gid(gid.get_msb()),
+                gid.get_lsb()};
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    struct gva_cache::entry
+    {
+        key first;
+        key last;
+        gva value;
+    };
+
+    // All members of a slot are accessed atomically as readers may look at a
+    // slot while it is being modified (the data read is discarded in this
+    // case).
+    struct gva_cache::slot
+    {
+        enum word
+        {
+            first_msb = 0,
+            first_lsb,
+            last_msb,
+            last_lsb,
+            prefix_msb,
+            prefix_lsb,
+            type,
+            count,
+            lva,
+            offset,
+            num_words
+        };
+
+        std::uint64_t get(word w) const
+        {
+            return words_[w].load(std::memory_order_relaxed);
+        }
+
+        void set(word w, std::uint64_t value)
+        {
+            words_[w].store(value, std::memory_order_relaxed);
+        }
+
+        key first() const
+        {
+            return key{get(first_msb), get(first_lsb)};
+        }
+
+        key last() const
+        {
+            return key{get(last_msb), get(last_lsb)};
+        }
+
+        void load(entry& e) const
+        {
+            e.first = first();
+            e.last = last();
+            e.value.prefix =
+                naming::gid_type(get(prefix_msb), get(prefix_lsb));
+            e.value.type = static_cast<gva::component_type>(get(type));
+            e.value.count = get(count);
+            e.value.lva(get(lva));
+            e.value.offset = get(offset);
+        }
+
+        void store(entry const& e)
+        {
+            set(first_msb, e.first.msb);
+            set(first_lsb, e.first.lsb);
+            set(last_msb, e.last.msb);
+            set(last_lsb, e.last.lsb);
+            set(prefix_msb, e.value.prefix.get_msb());
+            set(prefix_lsb, e.value.prefix.get_lsb());
+            set(type, static_cast<std::uint64_t>(e.value.type));
+            set(count, e.value.count);
+            set(lva, e.value.lva());
+            set(offset, e.value.offset);
+        }
+
+        void store(slot const& rhs)
+        {
+            for (std::size_t i = 0; i != num_words; ++i)
+                set(word(i), rhs.get(word(i)));
+            referenced_.store(rhs.referenced_.load(std::memory_order_relaxed),
+                std::memory_order_relaxed);
+        }
+
+        std::atomic<std::uint64_t> words_[num_words];
+        std::atomic<bool> referenced_;
+    };
+
+    // The slots of a shard are sorted by GID, an array is never freed while
+    // the cache exists as readers may still look at it after it has been
+    // replaced by a larger one.
+    struct gva_cache::slot_array
+    {
+        explicit slot_array(std::size_t capacity)
+          : capacity_(capacity)
+          , slots_(new slot[capacity])
+        {
+        }
+
+        std::size_t const capacity_;
+        std::unique_ptr<slot[]> slots_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    struct gva_cache::shard_data
+    {
+        typedef hpx::lcos::local::spinlock mutex_type;
+
+        shard_data()
+          : sequence_(0)
+          , slots_(nullptr)
+          , size_(0)
+          , capacity_(0)
+          , hand_(0)
+        {
+            for (std::atomic<std::int64_t>& c : counters_)
+                c.store(0, std::memory_order_relaxed);
+        }
+
+        // Writers serialize on the mutex and keep the sequence counter odd
+        // while modifying the shard
+        void begin_write()
+        {
+            sequence_.store(sequence_.load(std::memory_order_relaxed) + 1,
+                std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+        }
+
+        void end_write()
+        {
+            sequence_.store(sequence_.load(std::memory_order_relaxed) + 1,
+                std::memory_order_release);
+        }
+
+        mutex_type mtx_;
+        std::atomic<std::uint64_t> sequence_;
+        std::atomic<slot_array*> slots_;
+        std::atomic<std::size_t> size_;
+
+        // the members below are protected by the mutex
+        std::size_t capacity_;
+        std::size_t hand_;
+        std::vector<std::unique_ptr<slot_array>> storage_;
+
+        std::atomic<std::int64_t> counters_[num_counters];
+    };
+
+    struct gva_cache::shard
+      : util::cache_aligned_data_derived<gva_cache::shard_data>
+    {
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Helper class to update timings and counts on function exit
+    class gva_cache::update_on_exit
+    {
+    public:
+        update_on_exit(shard& s, counter count, counter time)
+          : s_(s)
+          , count_(count)
+          , time_(time)
+          , started_at_(hpx::chrono::high_resolution_clock::now())
+        {
+        }
+
+        ~update_on_exit()
+        {
+            s_.counters_[time_].fetch_add(
+                static_cast<std::int64_t>(
+                    hpx::chrono::high_resolution_clock::now() - started_at_),
+                std::memory_order_relaxed);
+            s_.counters_[count_].fetch_add(1, std::memory_order_relaxed);
+        }
+
+    private:
+        shard& s_;
+        counter const count_;
+        counter const time_;
+        std::uint64_t const started_at_;
+    };
+
+    namespace
+    {
+        // Return the index of the first slot which does not end before the
+        // given key
+        template <typename Slot>
+        std::size_t lower_bound(Slot const* slots, std::size_t size,
+            key const& k)
+        {
+            std::size_t first = 0;
+            while (size != 0)
+            {
+                std::size_t half = size / 2;
+                if (slots[first + half].last() < k)
+                {
+                    first += half + 1;
+                    size -= half + 1;
+                }
+                else
+                {
+                    size = half;
+                }
+            }
+            return first;
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    gva_cache::gva_cache(std::size_t max_size)
+      : shards_(new shard[num_shards])
+      , max_size_(max_size)
+    {
+    }
+
+    gva_cache::~gva_cache() = default;
+
+    std::size_t gva_cache::size() const
+    {
+        std::size_t size = 0;
+        for (std::size_t i = 0; i != num_shards; ++i)
+            size += shards_[i].size_.load(std::memory_order_relaxed);
+        return size;
+    }
+
+    // Each of the shards holds an equal part of the overall capacity
+    std::size_t gva_cache::get_shard_capacity() const
+    {
+        std::size_t max_size = max_size_.load(std::memory_order_relaxed);
+        if (max_size == 0)
+            return 0;
+        return (max_size + num_shards - 1) / num_shards;
+    }
+
+    void gva_cache::reserve(std::size_t max_size)
+    {
+        max_size_.store(max_size, std::memory_order_relaxed);
+
+        std::size_t const capacity = get_shard_capacity();
+        if (capacity == 0)
+            return;
+
+        for (std::size_t i = 0; i != num_shards; ++i)
+        {
+            shard& s = shards_[i];
+
+            std::lock_guard<shard_data::mutex_type> l(s.mtx_);
+            if (s.size_.load(std::memory_order_relaxed) > capacity)
+            {
+                s.begin_write();
+                while (s.size_.load(std::memory_order_relaxed) > capacity)
+                {
+                    std::size_t pos = 0;
+                    evict(s, pos);
+                }
+                s.end_write();
+            }
+        }
+    }
+
+    // Consecutive GIDs are assigned to consecutive shards, this spreads the
+    // objects created on a locality evenly over the shards.
+    std::size_t gva_cache::get_shard_index(naming::gid_type const& gid) const
+    {
+        std::uint64_t msb =
+            naming::detail::strip_internal_bits_from_gid(gid.get_msb());
+        return static_cast<std::size_t>((msb ^ (msb >> 32)) + gid.get_lsb()) %
+            num_shards;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    bool gva_cache::find(shard& s, naming::gid_type const& gid, entry& e)
+    {
+        key const k = make_key(gid);
+        for (std::size_t k_yield = 0; /**/; ++k_yield)
+        {
+            std::uint64_t sequence =
+                s.sequence_.load(std::memory_order_acquire);
+            if ((sequence & 1) != 0)
+            {
+                // a writer is modifying the shard
+                hpx::execution_base::this_thread::yield_k(
+                    k_yield, "hpx::agas::detail::gva_cache::find");
+                continue;
+            }
+
+            bool found = false;
+            slot* current = nullptr;
+
+            slot_array* slots = s.slots_.load(std::memory_order_acquire);
+            if (slots != nullptr)
+            {
+                // the size may not match the array if a writer is active,
+                // the result is discarded in this case
+                std::size_t size = s.size_.load(std::memory_order_relaxed);
+                if (size > slots->capacity_)
+                    size = slots->capacity_;
+
+                std::size_t pos = lower_bound(slots->slots_.get(), size, k);
+                if (pos != size && !(k < slots->slots_[pos].first()))
+                {
+                    current = &slots->slots_[pos];
+                    current->load(e);
+                    found = true;
+                }
+            }
+
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (s.sequence_.load(std::memory_order_relaxed) == sequence)
+            {
+                // give the entry a second chance before it gets evicted
+                if (found &&
+                    !current->referenced_.load(std::memory_order_relaxed))
+                {
+                    current->referenced_.store(
+                        true, std::memory_order_relaxed);
+                }
+                return found;
+            }
+        }
+    }
+
+    // This function must be called while the shard is locked.
+    void gva_cache::resize(shard& s, std::size_t capacity)
+    {
+        std::unique_ptr<slot_array> slots(new slot_array(capacity));
+
+        slot_array* current = s.slots_.load(std::memory_order_relaxed);
+        std::size_t const size = s.size_.load(std::memory_order_relaxed);
+        for (std::size_t i = 0; i != size; ++i)
+        {
+            slots->slots_[i].store(current->slots_[i]);
+        }
+
+        s.slots_.store(slots.get(), std::memory_order_release);
+        s.storage_.push_back(std::move(slots));
+        s.capacity_ = capacity;
+    }
+
+    // Remove an entry from the shard using the CLOCK algorithm, adjust the
+    // given position if the evicted entry precedes it. This function must be
+    // called while the shard is locked and being modified.
+    void gva_cache::evict(shard& s, std::size_t& pos)
+    {
+        slot* slots = s.slots_.load(std::memory_order_relaxed)->slots_.get();
+        std::size_t const size = s.size_.load(std::memory_order_relaxed);
+        HPX_ASSERT(size != 0);
+
+        std::size_t hand = s.hand_ % size;
+        while (slots[hand].referenced_.load(std::memory_order_relaxed))
+        {
+            slots[hand].referenced_.store(false, std::memory_order_relaxed);
+            hand = (hand + 1) % size;
+        }
+
+        for (std::size_t i = hand; i + 1 < size; ++i)
+        {
+            slots[i].store(slots[i + 1]);
+        }
+        s.size_.store(size - 1, std::memory_order_relaxed);
+        s.hand_ = hand;
+
+        if (hand < pos)
+            --pos;
+
+        s.counters_[counter_evictions].fetch_add(1, std::memory_order_relaxed);
+    }
+
+    bool gva_cache::insert_or_update(shard& s, entry const& e)
+    {
+        std::lock_guard<shard_data::mutex_type> l(s.mtx_);
+
+        slot_array* slots = s.slots_.load(std::memory_order_relaxed);
+        std::size_t size = s.size_.load(std::memory_order_relaxed);
+
+        std::size_t pos = 0;
+        if (slots != nullptr)
+        {
+            pos = lower_bound(slots->slots_.get(), size, e.first);
+            if (pos != size && !(e.last < slots->slots_[pos].first()))
+            {
+                // the new range overlaps with an existing entry, this is
+                // a collision if the ranges do not match
+                slot& current = slots->slots_[pos];
+                if (!(current.first() == e.first) ||
+                    !(current.last() == e.last))
+                {
+                    return false;
+                }
+
+                s.begin_write();
+                current.store(e);
+                current.referenced_.store(true, std::memory_order_relaxed);
+                s.end_write();
+
+                s.counters_[counter_hits].fetch_add(
+                    1, std::memory_order_relaxed);
+                return true;
+            }
+        }
+
+        s.counters_[counter_misses].fetch_add(1, std::memory_order_relaxed);
+        update_on_exit update(
+            s, counter_insert_entry_count, counter_insert_entry_time);
+
+        s.begin_write();
+
+        std::size_t const max_capacity = get_shard_capacity();
+        if (max_capacity != 0 && size >= max_capacity)
+        {
+            // make room for the new entry
+            while (s.size_.load(std::memory_order_relaxed) >= max_capacity)
+                evict(s, pos);
+            size = s.size_.load(std::memory_order_relaxed);
+        }
+        else if (size == s.capacity_)
+        {
+            std::size_t capacity = size == 0 ? 8 : 2 * size;
+            if (max_capacity != 0 && capacity > max_capacity)
+                capacity = max_capacity;
+            resize(s, capacity);
+        }
+
+        slot* storage = s.slots_.load(std::memory_order_relaxed)->slots_.get();
+        for (std::size_t i = size; i != pos; --i)
+        {
+            storage[i].store(storage[i - 1]);
+        }
+        storage[pos].store(e);
+        storage[pos].referenced_.store(false, std::memory_order_relaxed);
+        s.size_.store(size + 1, std::memory_order_relaxed);
+
+        s.end_write();
+
+        s.counters_[counter_insertions].fetch_add(
+            1, std::memory_order_relaxed);
+        return true;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    bool gva_cache::get_entry(
+        naming::gid_type const& gid, naming::gid_type& idbase, gva& g)
+    {
+        shard& s = shards_[get_shard_index(gid)];
+        update_on_exit update(s, counter_get_entry_count,
+            counter_get_entry_time);
+
+        entry e;
+        if (!find(s, gid, e))
+        {
+            s.counters_[counter_misses].fetch_add(
+                1, std::memory_order_relaxed);
+            return false;
+        }
+
+        s.counters_[counter_hits].fetch_add(1, std::memory_order_relaxed);
+
+        idbase = naming::gid_type(e.first.msb, e.first.lsb);
+        g = e.value;
+        return true;
+    }
+
+    // Ranges of GIDs are stored in all shards which are responsible for any
+    // of the GIDs in the range.
+    bool gva_cache::update_if(
+        naming::gid_type const& gid, std::uint64_t count, gva const& g)
+    {
+        HPX_ASSERT(count != 0);
+
+        entry e;
+        e.first = make_key(gid);
+        e.last = make_key(naming::gid_type(e.first.msb, e.first.lsb) +
+            naming::gid_type(count - 1));
+        e.value = g;
+
+        std::size_t const first_shard = get_shard_index(gid);
+        update_on_exit update(shards_[first_shard], counter_update_entry_count,
+            counter_update_entry_time);
+
+        std::size_t num = num_shards;
+        if (e.first.msb == e.last.msb && count < num_shards)
+            num = static_cast<std::size_t>(count);
+
+        bool result = true;
+        for (std::size_t i = 0; i != num; ++i)
+        {
+            shard& s = shards_[(first_shard + i) % num_shards];
+            if (!insert_or_update(s, e))
+                result = false;
+        }
+        return result;
+    }
+
+    std::size_t gva_cache::erase(naming::gid_type const& gid)
+    {
+        update_on_exit update(
+            shards_[0], counter_erase_entry_count, counter_erase_entry_time);
+
+        key const k = make_key(gid);
+
+        std::size_t erased = 0;
+        for (std::size_t i = 0; i != num_shards; ++i)
+        {
+            shard& s = shards_[i];
+
+            std::lock_guard<shard_data::mutex_type> l(s.mtx_);
+
+            slot_array* slots = s.slots_.load(std::memory_order_relaxed);
+            std::size_t const size = s.size_.load(std::memory_order_relaxed);
+            if (slots == nullptr)
+                continue;
+
+            std::size_t pos = lower_bound(slots->slots_.get(), size, k);
+            if (pos == size || !(slots->slots_[pos].first() == k))
+                continue;
+
+            s.begin_write();
+            for (std::size_t j = pos; j + 1 < size; ++j)
+            {
+                slots->slots_[j].store(slots->slots_[j + 1]);
+            }
+            s.size_.store(size - 1, std::memory_order_relaxed);
+            s.end_write();
+
+            s.counters_[counter_evictions].fetch_add(
+                1, std::memory_order_relaxed);
+            ++erased;
+        }
+        return erased;
+    }
+
+    std::size_t gva_cache::clear()
+    {
+        std::size_t erased = 0;
+        for (std::size_t i = 0; i != num_shards; ++i)
+        {
+            shard& s = shards_[i];
+
+            std::lock_guard<shard_data::mutex_type> l(s.mtx_);
+
+            s.begin_write();
+            erased += s.size_.exchange(0, std::memory_order_relaxed);
+            s.hand_ = 0;
+            s.end_write();
+        }
+        return erased;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    std::int64_t gva_cache::get_counter(counter c, bool reset)
+    {
+        std::int64_t result = 0;
+        for (std::size_t i = 0; i != num_shards; ++i)
+        {
+            std::atomic<std::int64_t>& value = shards_[i].counters_[c];
+            result += reset ? value.exchange(0, std::memory_order_relaxed) :
+                              value.load(std::memory_order_relaxed);
+        }
+        return result;
+    }
+
+    std::int64_t gva_cache::statistics::hits(bool reset)
+    {
+        return cache_.get_counter(counter_hits, reset);
+    }
+
+    std::int64_t gva_cache::statistics::misses(bool reset)
+    {
+        return cache_.get_counter(counter_misses, reset);
+    }
+
+    std::int64_t gva_cache::statistics::evictions(bool reset)
+    {
+        return cache_.get_counter(counter_evictions, reset);
+    }
+
+    std::int64_t gva_cache::statistics::insertions(bool reset)
+    {
+        return cache_.get_counter(counter_insertions, reset);
+    }
+
+    std::int64_t gva_cache::statistics::get_get_entry_count(bool reset)
+    {
+        return cache_.get_counter(counter_get_entry_count, reset);
+    }
+
+    std::int64_t gva_cache::statistics::get_insert_entry_count(bool reset)
+    {
+        return cache_.get_counter(counter_insert_entry_count, reset);
+    }
+
+    std::int64_t gva_cache::statistics::get_update_entry_count(bool reset)
+    {
+        return cache_.get_counter(counter_update_entry_count, reset);
+    }
+
+    std::int64_t gva_cache::statistics::get_erase_entry_count(bool reset)
+    {
+        return cache_.get_counter(counter_erase_entry_count, reset);
+    }
+
+    std::int64_t gva_cache::statistics::get_get_entry_time(bool reset)
+    {
+        return cache_.get_counter(counter_get_entry_time, reset);
+    }
+
+    std::int64_t gva_cache::statistics::get_insert_entry_time(bool reset)
+    {
+        return cache_.get_counter(counter_insert_entry_time, reset);
+    }
+
+    std::int64_t gva_cache::statistics::get_update_entry_time(bool reset)
+    {
+        return cache_.get_counter(counter_update_entry_time, reset);
+    }
+
+    std::int64_t gva_cache::statistics::get_erase_entry_time(bool reset)
+    {
+        return cache_.get_counter(counter_erase_entry_time, reset);
+    }
+}}}
@@ -534,6 +534,12 @@ void unmark_as_migrated(naming::gid_type const& gid)
     return resolver.unmark_as_migrated(gid);
 }
 
+bool has_migrated_objects()
+{
+    naming::resolver_client& resolver = naming::get_agas_client();
+    return resolver.has_migrated_objects();
+}
+
 hpx::future<symbol_namespace::iterate_names_return_type> find_symbols(
     std::string const& pattern)
 {
@@ -10,7 +10,9 @@
 
 #include <hpx/config.hpp>
 #include <hpx/assert.hpp>
+#include <hpx/async_combinators/wait_all.hpp>
 #include <hpx/async_distributed/applier/apply.hpp>
+#include <hpx/async_distributed/async.hpp>
 #include <hpx/functional/bind_back.hpp>
 #include <hpx/functional/bind_front.hpp>
 #include <hpx/lcos/base_lco_with_value.hpp>
@@ -24,6 +26,9 @@
 #include <hpx/runtime/agas/interface.hpp>
 #include <hpx/runtime/agas/namespace_action_code.hpp>
 #include <hpx/runtime/agas/server/symbol_namespace.hpp>
+#include <hpx/runtime/agas/symbol_namespace.hpp>
+#include <hpx/runtime_local/runtime_local_fwd.hpp>
+#include <hpx/thread_support/assert_owns_lock.hpp>
 #include <hpx/thread_support/unlock_guard.hpp>
 #include <hpx/timing/scoped_timer.hpp>
 #include <hpx/type_support/unused.hpp>
@@ -31,6 +36,7 @@
 #include <hpx/util/insert_checked.hpp>
 #include <hpx/util/regex_from_pattern.hpp>
 
+#include <algorithm>
 #include <atomic>
 #include <cstddef>
 #include <cstdint>
@@ -199,6 +205,14 @@ void symbol_namespace::finalize()
         error_code ec(lightweight);
         agas::unregister_name(launch::sync, instance_name_, ec);
     }
+
+    // release the cached ids outside of the lock
+    name_cache_type name_cache;
+    {
+        std::lock_guard<mutex_type> l(cache_mutex_);
+        name_cache.swap(name_cache_);
+        ++cache_generation_;
+    }
 }
 
 bool symbol_namespace::bind(
@@ -278,6 +292,18 @@ bool symbol_namespace::bind(
             ++it;
         }
 
+        // the localities waiting for this name will cache the binding
+        std::vector<std::uint32_t>& cached_by = cached_by_[key];
+        for (hpx::id_type const& id : lcos)
+        {
+            std::uint32_t locality_id = naming::get_locality_id_from_id(id);
+            if (std::find(cached_by.begin(), cached_by.end(), locality_id) ==
+                cached_by.end())
+            {
+                cached_by.push_back(locality_id);
+            }
+        }
+
         on_event_data_.erase(p.first, p.second);
 
         // notify all LCOS which were registered with this name
@@ -366,7 +392,7 @@ naming::gid_type symbol_namespace::unbind(std::string const& key)
     );
     counter_data_.increment_unbind_count();
 
-    std::lock_guard<mutex_type> l(mutex_);
+    std::unique_lock<mutex_type> l(mutex_);
 
     gid_table_type::iterator it = gids_.find(key);
     gid_table_type::iterator end = gids_.end();
@@ -384,6 +410,8 @@ naming::gid_type symbol_namespace::unbind(std::string const& key)
 
     gids_.erase(it);
 
+    invalidate_cached_name(l, key);
+
     LAGAS_(info) << hpx::util::format(
         "symbol_namespace::unbind, key({1}), gid({2})",
         key, gid);
@@ -401,46 +429,46 @@ symbol_namespace::iterate_names_return_type symbol_namespace::iterate(
     );
     counter_data_.increment_iterate_names_count();
 
-    std::map<std::string, naming::gid_type> found;
+    // collect the matching entries first, the iterators into the hashed
+    // table can't be held on to while the table is unlocked
+    std::vector<std::pair<std::string, std::shared_ptr<naming::gid_type> > >
+        entries;
 
     if (pattern.find_first_of("*?[]") != std::string::npos)
     {
         std::string str_rx(util::regex_from_pattern(pattern, throws));
         std::regex rx(str_rx);
 
-        std::unique_lock<mutex_type> l(mutex_);
+        std::lock_guard<mutex_type> l(mutex_);
         for (gid_table_type::iterator it = gids_.begin(); it != gids_.end();
              ++it)
         {
             if (!std::regex_match(it->first, rx))
                 continue;
 
-            // hold on to entry while map is unlocked
-            std::shared_ptr<naming::gid_type> current_gid(it->second);
-            util::unlock_guard<std::unique_lock<mutex_type> > ul(l);
-
-            found[it->first] =
-                naming::detail::split_gid_if_needed(*current_gid).get();
+            entries.emplace_back(it->first, it->second);
         }
     }
     else
     {
-        std::unique_lock<mutex_type> l(mutex_);
+        std::lock_guard<mutex_type> l(mutex_);
         for (gid_table_type::iterator it = gids_.begin(); it != gids_.end();
              ++it)
         {
             if (!pattern.empty() && pattern != it->first)
                 continue;
 
-            // hold on to entry while map is unlocked
-            std::shared_ptr<naming::gid_type> current_gid(it->second);
-            util::unlock_guard<std::unique_lock<mutex_type> > ul(l);
-
-            found[it->first] =
-                naming::detail::split_gid_if_needed(*current_gid).get();
+            entries.emplace_back(it->first, it->second);
         }
     }
 
+    std::map<std::string, naming::gid_type> found;
+    for (auto& entry : entries)
+    {
+        found[std::move(entry.first)] =
+            naming::detail::split_gid_if_needed(*entry.second).get();
+    }
+
     LAGAS_(info) << "symbol_namespace::iterate";
 
     return found;
@@ -469,6 +497,15 @@ bool symbol_namespace::on_event(
             // hold on to entry while map is unlocked
             std::shared_ptr<naming::gid_type> current_gid(it->second);
 
+            // the locality of the LCO will cache the binding
+            std::vector<std::uint32_t>& cached_by = cached_by_[name];
+            std::uint32_t locality_id = naming::get_locality_id_from_id(lco);
+            if (std::find(cached_by.begin(), cached_by.end(), locality_id) ==
+                cached_by.end())
+            {
+                cached_by.push_back(locality_id);
+            }
+
             // split the credit as the receiving end will expect to keep the
             // object alive
             {
@@ -502,6 +539,189 @@ bool symbol_namespace::on_event(
     return true;
 } // }}}
 
+std::vector<bool> symbol_namespace::bind_names(
+    std::vector<std::string> const& keys
+  , std::vector<naming::gid_type> const& gids
+    )
+{ // {{{ bind_names implementation
+    HPX_ASSERT(keys.size() == gids.size());
+
+    std::vector<bool> result;
+    result.reserve(keys.size());
+
+    for (std::size_t i = 0; i != keys.size(); ++i)
+    {
+        result.push_back(bind(keys[i], gids[i]));
+    }
+    return result;
+} // }}}
+
+std::vector<naming::gid_type> symbol_namespace::resolve_names(
+    std::vector<std::string> const& keys
+  , std::uint32_t cache_locality_id
+    )
+{ // {{{ resolve_names implementation
+    util::scoped_timer<std::atomic<std::int64_t> > update(
+        counter_data_.resolve_.time_,
+        counter_data_.resolve_.enabled_
+    );
+
+    // hold on to the entries while the table is unlocked
+    std::vector<std::shared_ptr<naming::gid_type> > entries;
+    entries.reserve(keys.size());
+
+    {
+        std::lock_guard<mutex_type> l(mutex_);
+        for (std::string const& key : keys)
+        {
+            counter_data_.increment_resolve_count();
+
+            gid_table_type::iterator it = gids_.find(key);
+            if (it == gids_.end())
+            {
+                entries.emplace_back();
+                continue;
+            }
+
+            entries.push_back(it->second);
+
+            if (cache_locality_id != naming::invalid_locality_id)
+            {
+                std::vector<std::uint32_t>& cached_by = cached_by_[key];
+                if (std::find(cached_by.begin(), cached_by.end(),
+                        cache_locality_id) == cached_by.end())
+                {
+                    cached_by.push_back(cache_locality_id);
+                }
+            }
+        }
+    }
+
+    std::vector<naming::gid_type> result;
+    result.reserve(keys.size());
+
+    for (std::shared_ptr<naming::gid_type> const& entry : entries)
+    {
+        if (!entry)
+        {
+            result.push_back(naming::invalid_gid);
+            continue;
+        }
+        result.push_back(naming::detail::split_gid_if_needed(*entry).get());
+    }
+
+    LAGAS_(info) << hpx::util::format(
+        "symbol_namespace::resolve_names, count({1})", keys.size());
+
+    return result;
+} // }}}
+
+void symbol_namespace::invalidate_cached_name(
+    std::unique_lock<mutex_type>& l, std::string const& key)
+{ // {{{
+    HPX_ASSERT_OWNS_LOCK(l);
+
+    cached_by_table_type::iterator it = cached_by_.find(key);
+    if (it == cached_by_.end())
+        return;
+
+    std::vector<std::uint32_t> localities = std::move(it->second);
+    cached_by_.erase(it);
+
+    util::unlock_guard<std::unique_lock<mutex_type> > ul(l);
+
+    std::vector<std::string> keys(1, key);
+    std::vector<hpx::future<void> > requests;
+    requests.reserve(localities.size());
+
+    std::uint32_t const here = agas::get_locality_id();
+    for (std::uint32_t locality_id : localities)
+    {
+        if (locality_id == here)
+        {
+            invalidate(keys);
+            continue;
+        }
+
+        naming::id_type dest(
+            agas::symbol_namespace::get_service_instance(locality_id),
+            naming::id_type::unmanaged);
+
+        // the name is unbound only after all caches have dropped it, unless
+        // the runtime is shutting down
+        if (hpx::is_running())
+        {
+            requests.push_back(
+                hpx::async(invalidate_action(), std::move(dest), keys));
+        }
+        else
+        {
+            hpx::apply(invalidate_action(), std::move(dest), keys);
+        }
+    }
+
+    // a locality which went away has dropped its cache already
+    hpx::wait_all(requests);
+} // }}}
+
+void symbol_namespace::invalidate(std::vector<std::string> const& keys)
+{ // {{{
+    // release the cached ids outside of the lock
+    std::vector<naming::id_type> ids;
+    ids.reserve(keys.size());
+
+    std::lock_guard<mutex_type> l(cache_mutex_);
+    for (std::string const& key : keys)
+    {
+        name_cache_type::iterator it = name_cache_.find(key);
+        if (it != name_cache_.end())
+        {
+            ids.push_back(std::move(it->second));
+            name_cache_.erase(it);
+        }
+    }
+
+    // results of requests issued before this point must not be cached
+    ++cache_generation_;
+} // }}}
+
+bool symbol_namespace::get_cached_name(
+    std::string const& key, naming::id_type& id) const
+{ // {{{
+    std::lock_guard<mutex_type> l(cache_mutex_);
+
+    name_cache_type::const_iterator it = name_cache_.find(key);
+    if (it == name_cache_.end())
+        return false;
+
+    id = it->second;
+    return true;
+} // }}}
+
+std::uint64_t symbol_namespace::get_cache_generation() const
+{
+    std::lock_guard<mutex_type> l(cache_mutex_);
+    return cache_generation_;
+}
+
+void symbol_namespace::cache_names(std::vector<std::string> const& keys,
+    std::vector<naming::id_type> const& ids, std::uint64_t generation)
+{ // {{{
+    HPX_ASSERT(keys.size() == ids.size());
+
+    std::lock_guard<mutex_type> l(cache_mutex_);
+
+    // some name was invalidated since the request was issued
+    if (generation != cache_generation_)
+        return;
+
+    for (std::size_t i = 0; i != keys.size(); ++i)
+    {
+        if (ids[i])
+            name_cache_[keys[i]] = ids[i];
+    }
+} // }}}
+
 naming::gid_type symbol_namespace::statistics_counter(std::string const& name)
 { // {{{ statistics_counter implementation
     LAGAS_(info) << "symbol_namespace::statistics_counter";
@@ -10,16 +10,19 @@
 #include <hpx/config.hpp>
 #include <hpx/actions_base/component_action.hpp>
 #include <hpx/assert.hpp>
+#include <hpx/async_combinators/when_all.hpp>
 #include <hpx/hashing/jenkins_hash.hpp>
 #include <hpx/lcos/base_lco_with_value.hpp>
 #include <hpx/modules/async_distributed.hpp>
 #include <hpx/modules/collectives.hpp>
 #include <hpx/modules/format.hpp>
+#include <hpx/runtime/agas/interface.hpp>
 #include <hpx/runtime/agas/server/symbol_namespace.hpp>
 #include <hpx/runtime/agas/symbol_namespace.hpp>
 #include <hpx/runtime/components/component_factory.hpp>
 #include <hpx/type_support/unused.hpp>
 
+#include <cstddef>
 #include <cstdint>
 #include <map>
 #include <string>
@@ -65,6 +68,21 @@ HPX_REGISTER_ACTION_ID(
     symbol_namespace_statistics_counter_action,
     hpx::actions::symbol_namespace_statistics_counter_action_id)
 
+HPX_REGISTER_ACTION_ID(
+    symbol_namespace::bind_names_action,
+    symbol_namespace_bind_names_action,
+    hpx::actions::symbol_namespace_bind_names_action_id)
+
+HPX_REGISTER_ACTION_ID(
+    symbol_namespace::resolve_names_action,
+    symbol_namespace_resolve_names_action,
+    hpx::actions::symbol_namespace_resolve_names_action_id)
+
+HPX_REGISTER_ACTION_ID(
+    symbol_namespace::invalidate_action,
+    symbol_namespace_invalidate_action,
+    hpx::actions::symbol_namespace_invalidate_action_id)
+
 namespace hpx { namespace agas
 {
     naming::gid_type symbol_namespace::get_service_instance(
@@ -188,8 +206,19 @@ namespace hpx { namespace agas
                 naming::id_type(raw_gid, naming::id_type::unmanaged));
         }
 #if !defined(HPX_COMPUTE_DEVICE_CODE)
-        server::symbol_namespace::resolve_action action;
-        return hpx::async(action, std::move(dest), std::move(key));
+        naming::id_type id;
+        if (server_->get_cached_name(key, id))
+            return hpx::make_ready_future(std::move(id));
+
+        return resolve_remote_async(
+            std::move(dest), std::vector<std::string>(1, std::move(key)))
+            .then(hpx::launch::sync,
+                [](hpx::future<std::vector<naming::id_type>>&& f)
+                {
+                    std::vector<naming::id_type> ids = f.get();
+                    HPX_ASSERT(ids.size() == 1);
+                    return std::move(ids.front());
+                });
 #else
         HPX_ASSERT(false);
         return hpx::make_ready_future(naming::id_type{});
@@ -201,6 +230,208 @@ namespace hpx { namespace agas
         return resolve_async(std::move(key)).get();
     }
 
+    hpx::future<std::vector<naming::id_type>>
+    symbol_namespace::resolve_remote_async(
+        naming::id_type dest, std::vector<std::string> keys) const
+    {
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+        // the results are cached only if no name was invalidated while the
+        // request was in flight
+        server_type* server = server_.get();
+        std::uint64_t generation = server->get_cache_generation();
+
+        server::symbol_namespace::resolve_names_action action;
+        hpx::future<std::vector<naming::id_type>> f = hpx::async(
+            action, std::move(dest), keys, agas::get_locality_id());
+
+        return f.then(hpx::launch::sync,
+            [server, generation, keys = std::move(keys)](
+                hpx::future<std::vector<naming::id_type>>&& f)
+            {
+                std::vector<naming::id_type> ids = f.get();
+                server->cache_names(keys, ids, generation);
+                return ids;
+            });
+#else
+        HPX_UNUSED(dest);
+        HPX_UNUSED(keys);
+        HPX_ASSERT(false);
+        return hpx::make_ready_future(std::vector<naming::id_type>{});
+#endif
+    }
+
+    hpx::future<std::vector<bool>> symbol_namespace::bind_async(
+        std::vector<std::string> keys, std::vector<naming::gid_type> gids)
+    {
+        HPX_ASSERT(keys.size() == gids.size());
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+        // group the names by the instance responsible for them
+        std::map<naming::gid_type, std::vector<std::size_t>> indices;
+        for (std::size_t i = 0; i != keys.size(); ++i)
+        {
+            indices[symbol_namespace_locality(keys[i]).get_gid()].push_back(i);
+        }
+
+        std::vector<hpx::future<std::vector<bool>>> requests;
+        requests.reserve(indices.size());
+
+        for (auto const& p : indices)
+        {
+            std::vector<std::string> group_keys;
+            std::vector<naming::gid_type> group_gids;
+            group_keys.reserve(p.second.size());
+            group_gids.reserve(p.second.size());
+
+            for (std::size_t i : p.second)
+            {
+                group_keys.push_back(std::move(keys[i]));
+                group_gids.push_back(std::move(gids[i]));
+            }
+
+            if (naming::get_locality_from_gid(p.first) == hpx::get_locality())
+            {
+                requests.push_back(hpx::make_ready_future(
+                    server_->bind_names(group_keys, group_gids)));
+                continue;
+            }
+
+            server::symbol_namespace::bind_names_action action;
+            requests.push_back(hpx::async(action,
+                naming::id_type(p.first, naming::id_type::unmanaged),
+                std::move(group_keys), std::move(group_gids)));
+        }
+
+        std::size_t count = keys.size();
+        return hpx::when_all(std::move(requests)).then(hpx::launch::sync,
+            [count, indices = std::move(indices)](
+                hpx::future<std::vector<hpx::future<std::vector<bool>>>>&& f)
+            {
+                std::vector<hpx::future<std::vector<bool>>> requests = f.get();
+                std::vector<bool> result(count, false);
+
+                std::size_t request = 0;
+                for (auto const& p : indices)
+                {
+                    std::vector<bool> bound = requests[request++].get();
+                    HPX_ASSERT(bound.size() == p.second.size());
+
+                    for (std::size_t j = 0; j != p.second.size(); ++j)
+                        result[p.second[j]] = bound[j];
+                }
+                return result;
+            });
+#else
+        HPX_UNUSED(keys);
+        HPX_UNUSED(gids);
+        HPX_ASSERT(false);
+        return hpx::make_ready_future(std::vector<bool>{});
+#endif
+    }
+
+    hpx::future<std::vector<naming::id_type>> symbol_namespace::resolve_async(
+        std::vector<std::string> keys) const
+    {
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+        std::vector<naming::id_type> ids(keys.size());
+
+        // try the cache first and group the remaining names by the
+        // instance responsible for them
+        std::map<naming::gid_type, std::vector<std::size_t>> indices;
+        for (std::size_t i = 0; i != keys.size(); ++i)
+        {
+            naming::id_type dest = symbol_namespace_locality(keys[i]);
+            if (naming::get_locality_from_gid(dest.get_gid()) !=
+                    hpx::get_locality() &&
+                server_->get_cached_name(keys[i], ids[i]))
+            {
+                continue;
+            }
+            indices[dest.get_gid()].push_back(i);
+        }
+
+        if (indices.empty())
+            return hpx::make_ready_future(std::move(ids));
+
+        std::vector<hpx::future<std::vector<naming::id_type>>> requests;
+        requests.reserve(indices.size());
+
+        for (auto const& p : indices)
+        {
+            std::vector<std::string> group_keys;
+            group_keys.reserve(p.second.size());
+            for (std::size_t i : p.second)
+                group_keys.push_back(keys[i]);
+
+            if (naming::get_locality_from_gid(p.first) == hpx::get_locality())
+            {
+                std::vector<naming::gid_type> gids = server_->resolve_names(
+                    group_keys, naming::invalid_locality_id);
+
+                std::vector<naming::id_type> group_ids;
+                group_ids.reserve(gids.size());
+                for (naming::gid_type& gid : gids)
+                {
+                    bool has_credits = naming::detail::has_credits(gid);
+                    group_ids.emplace_back(std::move(gid),
+                        has_credits ? naming::id_type::managed :
+                                      naming::id_type::unmanaged);
+                }
+
+                requests.push_back(hpx::make_ready_future(
+                    std::move(group_ids)));
+                continue;
+            }
+
+            requests.push_back(resolve_remote_async(
+                naming::id_type(p.first, naming::id_type::unmanaged),
+                std::move(group_keys)));
+        }
+
+        return hpx::when_all(std::move(requests)).then(hpx::launch::sync,
+            [ids = std::move(ids), indices = std::move(indices)](
+                hpx::future<std::vector<hpx::future<
+                    std::vector<naming::id_type>>>>&& f) mutable
+            {
+                auto requests = f.get();
+
+                std::size_t request = 0;
+                for (auto const& p : indices)
+                {
+                    std::vector<naming::id_type> resolved =
+                        requests[request++].get();
+                    HPX_ASSERT(resolved.size() == p.second.size());
+
+                    for (std::size_t j = 0; j != p.second.size(); ++j)
+                        ids[p.second[j]] = std::move(resolved[j]);
+                }
+                return std::move(ids);
+            });
+#else
+        HPX_UNUSED(keys);
+        HPX_ASSERT(false);
+        return hpx::make_ready_future(std::vector<naming::id_type>{});
+#endif
+    }
+
+    bool symbol_namespace::get_cached_name(
+        std::string const& key, naming::id_type& id) const
+    {
+        return server_->get_cached_name(key, id);
+    }
+
+    std::uint64_t symbol_namespace::get_cache_generation() const
+    {
+        return server_->get_cache_generation();
+    }
+
+    void symbol_namespace::cache_name(std::string const& key,
+        naming::id_type const& id, std::uint64_t generation)
+    {
+        server_->cache_names(std::vector<std::string>(1, key),
+            std::vector<naming::id_type>(1, id), generation);
+    }
+
     hpx::future<naming::id_type> symbol_namespace::unbind_async(std::string key)
     {
         naming::id_type dest = symbol_namespace_locality(key);
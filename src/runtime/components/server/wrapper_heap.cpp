@@ -181,10 +181,9 @@ namespace hpx { namespace components { namespace detail
 
 #if HPX_DEBUG_WRAPPER_HEAP != 0
         HPX_ASSERT(did_alloc(p));
-#endif
+
         scoped_lock l(mtx_);
 
-#if HPX_DEBUG_WRAPPER_HEAP != 0
         char* p1 = p;
         std::size_t const total_num_bytes =
             parameters_.capacity * parameters_.element_size;
@@ -202,6 +201,7 @@ namespace hpx { namespace components { namespace detail
 
         // give memory back to pool
         debug::fill_bytes(p1, freed_value, num_bytes);
+        l.unlock();
 #else
         HPX_UNUSED(p);
 #endif
@@ -209,10 +209,14 @@ namespace hpx { namespace components { namespace detail
 #if defined(HPX_DEBUG)
         free_count_ += count;
 #endif
-        free_size_ += count;
-
-        // release the pool if this one was the last allocated item
-        test_release(l);
+        // Freeing an element does not need to acquire the lock, only if this
+        // one was the last allocated item the pool might have to be released.
+        HPX_ASSERT(free_size_ + count <= parameters_.capacity);
+        if (free_size_.fetch_add(count) + count == parameters_.capacity)
+        {
+            scoped_lock ll(mtx_);
+            test_release(ll);
+        }
     }
 
     bool wrapper_heap::did_alloc (void *p) const
@@ -372,7 +376,7 @@ namespace hpx { namespace components { namespace detail
                 << ")"
 #if defined(HPX_DEBUG)
                 << ": releasing heap: alloc count: " << alloc_count_
-                << ", free count: " << free_count_
+                << ", free count: " << free_count_.load()
 #endif
                 << ".";
 
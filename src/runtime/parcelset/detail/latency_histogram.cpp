@@ -0,0 +1,284 @@
+//  Copyright (c) 2020 STE||AR Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING)
+#include <hpx/assert.hpp>
+#include <hpx/runtime/parcelset/detail/latency_histogram.hpp>
+#include <hpx/type_support/unused.hpp>
+#include <hpx/util/from_string.hpp>
+#if defined(HPX_HAVE_PARCELPORT_ACTION_COUNTERS)
+#include <hpx/actions_base/detail/action_factory.hpp>
+#endif
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace hpx { namespace parcelset { namespace detail
+{
+    ///////////////////////////////////////////////////////////////////////////
+    char const* get_latency_stage_name(latency_stage stage)
+    {
+        static char const* const names[] =
+        {
+            "queue",
+            "serialization",
+            "send",
+            "deserialization",
+            "schedule"
+        };
+
+        std::size_t index = static_cast<std::size_t>(stage);
+        HPX_ASSERT(index < sizeof(names) / sizeof(names[0]));
+        return names[index];
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    latency_histogram::latency_histogram()
+    {
+        for (std::atomic<std::int64_t>& count : counts_)
+        {
+            count.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    // values below 4 have their own bucket, all larger values are sorted
+    // into four buckets per power of two
+    std::size_t latency_histogram::get_bucket(std::int64_t value)
+    {
+        if (value < 4)
+            return value < 0 ? 0 : static_cast<std::size_t>(value);
+
+        std::uint64_t v = static_cast<std::uint64_t>(value);
+
+        std::size_t exponent = 0;
+#if defined(__GNUC__)
+        exponent = 63 - static_cast<std::size_t>(__builtin_clzll(v));
+#else
+        for (std::uint64_t i = v; i > 1; i >>= 1)
+            ++exponent;
+#endif
+        if (exponent >= max_exponent)
+            return bucket_count - 1;
+
+        std::size_t sub_bucket =
+            static_cast<std::size_t>(v >> (exponent - 2)) & 3;
+        return 4 * (exponent - 1) + sub_bucket;
+    }
+
+    std::int64_t latency_histogram::get_bucket_midpoint(std::size_t bucket)
+    {
+        if (bucket < 4)
+            return static_cast<std::int64_t>(bucket);
+
+        std::size_t exponent = bucket / 4 + 1;
+        std::uint64_t width = std::uint64_t(1) << (exponent - 2);
+        std::uint64_t lower = (4 + bucket % 4) * width;
+        return static_cast<std::int64_t>(lower + width / 2);
+    }
+
+    void latency_histogram::add(std::int64_t value)
+    {
+        counts_[get_bucket(value)].fetch_add(1, std::memory_order_relaxed);
+    }
+
+    std::vector<std::int64_t> latency_histogram::get(
+        std::int64_t min_boundary, std::int64_t max_boundary,
+        std::int64_t num_buckets, bool reset)
+    {
+        if (num_buckets <= 0)
+            num_buckets = 1;
+        if (max_boundary <= min_boundary)
+            max_boundary = min_boundary + 1;
+
+        // re-sample the collected data into the requested (linear) buckets,
+        // the first and the last bucket hold the values below and above the
+        // requested range
+        std::vector<std::int64_t> samples(std::size_t(num_buckets + 2), 0);
+        std::int64_t total = 0;
+        for (std::size_t i = 0; i != bucket_count; ++i)
+        {
+            std::int64_t count = reset ?
+                counts_[i].exchange(0, std::memory_order_relaxed) :
+                counts_[i].load(std::memory_order_relaxed);
+            if (count == 0)
+                continue;
+
+            std::int64_t value = get_bucket_midpoint(i);
+
+            std::size_t index = 0;
+            if (value >= max_boundary)
+            {
+                index = std::size_t(num_buckets + 1);
+            }
+            else if (value >= min_boundary)
+            {
+                index = std::size_t(1 +
+                    (value - min_boundary) * num_buckets /
+                        (max_boundary - min_boundary));
+            }
+
+            samples[index] += count;
+            total += count;
+        }
+
+        // first add histogram parameters
+        std::vector<std::int64_t> result;
+        result.reserve(samples.size() + 3);
+        result.push_back(min_boundary);
+        result.push_back(max_boundary);
+        result.push_back(num_buckets);
+
+        for (std::int64_t count : samples)
+        {
+            result.push_back(total == 0 ? 0 : (count * 1000) / total);
+        }
+        return result;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    latency_histograms::histogram_table::histogram_table()
+    {
+        for (std::atomic<entry_type*>& block : blocks_)
+        {
+            block.store(nullptr, std::memory_order_relaxed);
+        }
+    }
+
+    latency_histograms::histogram_table::~histogram_table()
+    {
+        for (std::atomic<entry_type*>& block : blocks_)
+        {
+            entry_type* entries = block.load(std::memory_order_relaxed);
+            if (entries == nullptr)
+                continue;
+
+            for (std::size_t i = 0; i != block_size; ++i)
+            {
+                delete entries[i].load(std::memory_order_relaxed);
+            }
+            delete[] entries;
+        }
+    }
+
+    latency_histograms::stage_histograms*
+    latency_histograms::histogram_table::get(std::uint32_t key)
+    {
+        std::size_t block_index = key / block_size;
+        if (block_index >= num_blocks)
+            return nullptr;
+
+        // blocks and entries are installed by the first thread needing
+        // them, threads losing the race discard their copy
+        std::atomic<entry_type*>& block = blocks_[block_index];
+        entry_type* entries = block.load(std::memory_order_acquire);
+        if (entries == nullptr)
+        {
+            entry_type* new_entries = new entry_type[block_size];
+            for (std::size_t i = 0; i != block_size; ++i)
+            {
+                new_entries[i].store(nullptr, std::memory_order_relaxed);
+            }
+
+            if (block.compare_exchange_strong(entries, new_entries,
+                    std::memory_order_acq_rel, std::memory_order_acquire))
+            {
+                entries = new_entries;
+            }
+            else
+            {
+                delete[] new_entries;
+            }
+        }
+
+        entry_type& entry = entries[key % block_size];
+        stage_histograms* histograms = entry.load(std::memory_order_acquire);
+        if (histograms == nullptr)
+        {
+            stage_histograms* new_histograms = new stage_histograms;
+            if (entry.compare_exchange_strong(histograms, new_histograms,
+                    std::memory_order_acq_rel, std::memory_order_acquire))
+            {
+                histograms = new_histograms;
+            }
+            else
+            {
+                delete new_histograms;
+            }
+        }
+        return histograms;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    latency_histograms::latency_histograms() = default;
+    latency_histograms::~latency_histograms() = default;
+
+    void latency_histograms::add(latency_stage stage,
+        std::uint32_t locality_id, std::uint32_t action_id,
+        std::int64_t value)
+    {
+        std::size_t index = static_cast<std::size_t>(stage);
+        overall_[index].add(value);
+
+        stage_histograms* histograms = per_locality_.get(locality_id);
+        if (histograms != nullptr)
+            (*histograms)[index].add(value);
+
+#if defined(HPX_HAVE_PARCELPORT_ACTION_COUNTERS)
+        histograms = per_action_.get(action_id);
+        if (histograms != nullptr)
+            (*histograms)[index].add(value);
+#else
+        HPX_UNUSED(action_id);
+#endif
+    }
+
+    std::vector<std::int64_t> latency_histograms::get(latency_stage stage,
+        std::string const& filter, std::int64_t min_boundary,
+        std::int64_t max_boundary, std::int64_t num_buckets, bool reset)
+    {
+        std::size_t index = static_cast<std::size_t>(stage);
+        if (filter.empty())
+        {
+            return overall_[index].get(
+                min_boundary, max_boundary, num_buckets, reset);
+        }
+
+        stage_histograms* histograms = nullptr;
+
+        std::string const prefix("locality#");
+        if (filter.compare(0, prefix.size(), prefix) == 0)
+        {
+            std::uint32_t locality_id = util::from_string<std::uint32_t>(
+                filter.substr(prefix.size()), std::uint32_t(-1));
+            histograms = per_locality_.get(locality_id);
+        }
+#if defined(HPX_HAVE_PARCELPORT_ACTION_COUNTERS)
+        else
+        {
+            // the data is collected by action id
+            histograms = per_action_.get(
+                actions::detail::action_registry::instance().try_get_id(
+                    filter));
+        }
+#endif
+
+        if (histograms == nullptr)
+        {
+            // no data is collected for the given filter
+            latency_histogram empty;
+            return empty.get(min_boundary, max_boundary, num_buckets, reset);
+        }
+        return (*histograms)[index].get(
+            min_boundary, max_boundary, num_buckets, reset);
+    }
+}}}
+
+#endif
@@ -168,6 +168,7 @@ namespace hpx { namespace parcelset
       , action_()
       , size_(0)
       , num_chunks_(0)
+      , stage_time_(0)
     {}
 
     parcel::~parcel() {}
@@ -178,6 +179,7 @@ namespace hpx { namespace parcelset
       , action_(std::move(act))
       , size_(0)
       , num_chunks_(0)
+      , stage_time_(0)
     {
 //         HPX_ASSERT(is_valid());
     }
@@ -187,7 +189,8 @@ namespace hpx { namespace parcelset
         action_(std::move(other.action_)),
         split_gids_(std::move(other.split_gids_)),
         size_(other.size_),
-        num_chunks_(other.num_chunks_)
+        num_chunks_(other.num_chunks_),
+        stage_time_(other.stage_time_)
     {
         HPX_ASSERT(is_valid());
     }
@@ -199,6 +202,7 @@ namespace hpx { namespace parcelset
         split_gids_ = std::move(other.split_gids_);
         size_ = other.size_;
         num_chunks_ = other.num_chunks_;
+        stage_time_ = other.stage_time_;
 
         other.reset();
 
@@ -258,6 +262,13 @@ namespace hpx { namespace parcelset
         return naming::get_locality_id_from_gid(destination_locality());
     }
 
+    std::uint32_t parcel::source_locality_id() const
+    {
+        if (!data_.source_id_)
+            return naming::invalid_locality_id;
+        return naming::get_locality_id_from_gid(data_.source_id_);
+    }
+
     naming::gid_type const& parcel::destination_locality() const
     {
         return addr().locality_;
@@ -295,6 +306,14 @@ namespace hpx { namespace parcelset
         return action_->get_thread_priority();
     }
 
+    bool parcel::is_high_priority() const
+    {
+        threads::thread_priority priority = get_thread_priority();
+        return priority == threads::thread_priority::high ||
+            priority == threads::thread_priority::high_recursive ||
+            priority == threads::thread_priority::boost;
+    }
+
 #if defined(HPX_HAVE_PARCEL_PROFILING)
     naming::gid_type const parcel::parcel_id() const
     {
@@ -356,6 +375,16 @@ namespace hpx { namespace parcelset
         return size_;
     }
 
+    std::int64_t const& parcel::stage_time() const
+    {
+        return stage_time_;
+    }
+
+    std::int64_t & parcel::stage_time()
+    {
+        return stage_time_;
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     // generate unique parcel id
     naming::gid_type parcel::generate_unique_id(
@@ -0,0 +1,242 @@
+//  Copyright (c) 2020 STE||AR Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING)
+#include <hpx/runtime/parcelset/parcel_buffer_pool.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+#include <hpx/threading_base/thread_num_tss.hpp>
+#include <hpx/topology/topology.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#if defined(__linux__)
+#include <sched.h>
+#endif
+
+namespace hpx { namespace parcelset
+{
+    namespace
+    {
+        // buffers are pooled in power of two size classes from 4kB to 1GB
+        constexpr std::size_t min_size_class_log2 = 12;
+        constexpr std::size_t max_size_class_log2 = 30;
+        constexpr std::size_t num_size_classes =
+            max_size_class_log2 - min_size_class_log2 + 1;
+
+        constexpr std::size_t invalid_size_class = std::size_t(-1);
+
+        std::size_t size_class_capacity(std::size_t size_class)
+        {
+            return std::size_t(1) << (size_class + min_size_class_log2);
+        }
+
+        // return the smallest size class able to hold the given size
+        std::size_t size_class_for_request(std::size_t size)
+        {
+            if (size > size_class_capacity(num_size_classes - 1))
+                return invalid_size_class;
+
+            std::size_t size_class = 0;
+            while (size_class_capacity(size_class) < size)
+                ++size_class;
+            return size_class;
+        }
+
+        // return the largest size class the given capacity can serve
+        std::size_t size_class_for_capacity(std::size_t capacity)
+        {
+            if (capacity < size_class_capacity(0))
+                return invalid_size_class;
+
+            std::size_t size_class = 0;
+            while (size_class + 1 != num_size_classes &&
+                size_class_capacity(size_class + 1) <= capacity)
+            {
+                ++size_class;
+            }
+            return size_class;
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    struct parcel_buffer_pool::domain
+    {
+        typedef hpx::lcos::local::spinlock mutex_type;
+
+        mutex_type mtx_;
+        std::vector<std::vector<char>> buffers_[num_size_classes];
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    parcel_buffer_pool::parcel_buffer_pool(std::size_t max_size)
+      : max_size_(max_size)
+      , num_domains_(1)
+      , cached_size_(0)
+    {
+        if (max_size_ != 0)
+        {
+            threads::topology const& topo = threads::create_topology();
+
+            num_domains_ = (std::max)(
+                std::size_t(1), topo.get_number_of_numa_nodes());
+            if (num_domains_ != 1)
+            {
+                // map each processing unit to its NUMA domain once, the
+                // topology is not queried on the fast path
+                std::size_t const num_pus = topo.get_number_of_pus();
+                pu_domains_.reserve(num_pus);
+                for (std::size_t pu = 0; pu != num_pus; ++pu)
+                {
+                    std::size_t node = topo.get_numa_node_number(pu);
+                    pu_domains_.push_back(node < num_domains_ ? node : 0);
+                }
+            }
+        }
+        domains_.reset(new domain[num_domains_]);
+    }
+
+    parcel_buffer_pool::~parcel_buffer_pool() = default;
+
+    std::size_t parcel_buffer_pool::current_domain() const
+    {
+        if (num_domains_ == 1)
+            return 0;
+
+        // The HPX worker threads are bound to their processing units, their
+        // domain is determined on first use only.
+        static thread_local std::size_t worker_domain = std::size_t(-1);
+
+        bool const is_worker =
+            hpx::get_worker_thread_num() != std::size_t(-1);
+        if (is_worker && worker_domain < num_domains_)
+            return worker_domain;
+
+        std::size_t domain = 0;
+#if defined(__linux__)
+        int cpu = sched_getcpu();
+        if (cpu >= 0 && std::size_t(cpu) < pu_domains_.size())
+            domain = pu_domains_[cpu];
+#endif
+        if (is_worker)
+            worker_domain = domain;
+
+        return domain;
+    }
+
+    void parcel_buffer_pool::acquire(
+        std::vector<char>& buffer, std::size_t size)
+    {
+        if (max_size_ == 0 || buffer.capacity() >= size)
+        {
+            buffer.reserve(size);
+            return;
+        }
+
+        std::size_t size_class = size_class_for_request(size);
+        if (size_class == invalid_size_class ||
+            size < size_class_capacity(0))
+        {
+            buffer.reserve(size);
+            return;
+        }
+
+        // look for a cached buffer of the matching size class
+        if (cached_size_.load(std::memory_order_relaxed) != 0)
+        {
+            domain& d = domains_[current_domain()];
+
+            std::lock_guard<domain::mutex_type> l(d.mtx_);
+            std::vector<std::vector<char>>& buffers = d.buffers_[size_class];
+            if (!buffers.empty())
+            {
+                std::vector<char> cached = std::move(buffers.back());
+                buffers.pop_back();
+                cached_size_ -= cached.capacity();
+
+                cached.clear();
+                buffer.swap(cached);
+                return;
+            }
+        }
+
+        // allocate a new buffer, rounding up to the capacity of the size
+        // class to allow for it to be reused later on
+        buffer.reserve(size_class_capacity(size_class));
+    }
+
+    void parcel_buffer_pool::release(std::vector<char>& buffer)
+    {
+        std::size_t capacity = buffer.capacity();
+        std::size_t size_class = size_class_for_capacity(capacity);
+        if (max_size_ == 0 || size_class == invalid_size_class ||
+            cached_size_.load(std::memory_order_relaxed) + capacity >
+                max_size_)
+        {
+            // not worth caching, free the memory right away
+            std::vector<char>().swap(buffer);
+            return;
+        }
+
+        std::vector<char> cached;
+        cached.swap(buffer);
+
+        domain& d = domains_[current_domain()];
+        {
+            std::lock_guard<domain::mutex_type> l(d.mtx_);
+            d.buffers_[size_class].push_back(std::move(cached));
+        }
+        cached_size_ += capacity;
+    }
+
+    void parcel_buffer_pool::trim()
+    {
+        std::size_t const low_watermark = max_size_ / 2;
+        if (cached_size_.load(std::memory_order_relaxed) <= low_watermark)
+            return;
+
+        // free the largest buffers first
+        for (std::size_t size_class = num_size_classes; size_class != 0;
+             --size_class)
+        {
+            for (std::size_t i = 0; i != num_domains_; ++i)
+            {
+                std::vector<std::vector<char>> released;
+                {
+                    domain& d = domains_[i];
+
+                    std::lock_guard<domain::mutex_type> l(d.mtx_);
+                    std::vector<std::vector<char>>& buffers =
+                        d.buffers_[size_class - 1];
+
+                    while (!buffers.empty() &&
+                        cached_size_.load(std::memory_order_relaxed) >
+                            low_watermark)
+                    {
+                        cached_size_ -= buffers.back().capacity();
+                        released.push_back(std::move(buffers.back()));
+                        buffers.pop_back();
+                    }
+                }
+
+                // the memory is freed outside of the lock
+                if (cached_size_.load(std::memory_order_relaxed) <=
+                    low_watermark)
+                {
+                    return;
+                }
+            }
+        }
+    }
+}}
+
+#endif
@@ -1050,6 +1050,36 @@ namespace hpx { namespace parcelset
         return pp ? pp->get_buffer_allocate_time_received(reset) : 0;
     }
 
+    std::int64_t parcelhandler::get_pending_outbound_size(
+        std::string const& pp_type, bool reset) const
+    {
+        error_code ec(lightweight);
+        parcelport* pp = find_parcelport(pp_type, ec);
+        return pp ? pp->get_pending_outbound_size(reset) : 0;
+    }
+
+    std::int64_t parcelhandler::get_outbound_stall_time(
+        std::string const& pp_type, bool reset) const
+    {
+        error_code ec(lightweight);
+        parcelport* pp = find_parcelport(pp_type, ec);
+        return pp ? pp->get_outbound_stall_time(reset) : 0;
+    }
+
+    std::vector<std::int64_t> parcelhandler::get_latency_histogram(
+        std::string const& pp_type, detail::latency_stage stage,
+        std::string const& filter, std::int64_t min_boundary,
+        std::int64_t max_boundary, std::int64_t num_buckets,
+        bool reset) const
+    {
+        error_code ec(lightweight);
+        parcelport* pp = find_parcelport(pp_type, ec);
+        if (!pp)
+            return std::vector<std::int64_t>();
+        return pp->get_latency_histogram(
+            stage, filter, min_boundary, max_boundary, num_buckets, reset);
+    }
+
     // connection stack statistics
     std::int64_t parcelhandler::get_connection_cache_statistics(
         std::string const& pp_type,
@@ -1177,6 +1207,66 @@ namespace hpx { namespace parcelset
             counter_types, sizeof(counter_types)/sizeof(counter_types[0]));
     }
 
+    namespace detail
+    {
+        typedef util::function_nonser<std::vector<std::int64_t>(
+                std::string const&, std::int64_t, std::int64_t, std::int64_t,
+                bool)>
+            get_latency_histogram_type;
+
+        // Creation function for the parcel latency histogram counters, the
+        // counter parameters are
+        //
+        //      [locality#<id>|<action-name>][,<min>[,<max>[,<buckets>]]]
+        //
+        naming::gid_type latency_histogram_counter_creator(
+            performance_counters::counter_info const& info,
+            get_latency_histogram_type const& get_histogram, error_code& ec)
+        {
+            performance_counters::counter_path_elements paths;
+            performance_counters::get_counter_path_elements(
+                info.fullname_, paths, ec);
+            if (ec)
+                return naming::invalid_gid;
+
+            // split parameters, extract separate values
+            std::vector<std::string> params;
+            hpx::string_util::split(params, paths.parameters_,
+                hpx::string_util::is_any_of(","),
+                hpx::string_util::token_compress_mode::off);
+
+            std::string filter;
+            std::int64_t min_boundary = 0;
+            std::int64_t max_boundary = 1000000;    // 1ms
+            std::int64_t num_buckets = 20;
+
+            if (!params.empty())
+                filter = params[0];
+            if (params.size() > 1 && !params[1].empty())
+                min_boundary = util::from_string<std::int64_t>(params[1]);
+            if (params.size() > 2 && !params[2].empty())
+                max_boundary = util::from_string<std::int64_t>(params[2]);
+            if (params.size() > 3 && !params[3].empty())
+                num_buckets = util::from_string<std::int64_t>(params[3]);
+
+            if (max_boundary <= min_boundary || num_buckets <= 0)
+            {
+                HPX_THROWS_IF(ec, bad_parameter,
+                    "latency_histogram_counter_creator",
+                    "invalid counter parameter for latency histogram: "
+                    "the upper boundary must be larger than the lower "
+                    "boundary and the number of buckets must be positive");
+                return naming::invalid_gid;
+            }
+
+            return performance_counters::locality_raw_values_counter_creator(
+                info,
+                util::bind_front(get_histogram, filter, min_boundary,
+                    max_boundary, num_buckets),
+                ec);
+        }
+    }
+
     void parcelhandler::register_counter_types(std::string const& pp_type)
     {
 #if defined(HPX_HAVE_NETWORKING)
@@ -1272,6 +1362,13 @@ namespace hpx { namespace parcelset
             util::bind_front(&parcelhandler::get_buffer_allocate_time_received, this,
                 pp_type));
 
+        util::function_nonser<std::int64_t(bool)> pending_outbound_size(
+            util::bind_front(&parcelhandler::get_pending_outbound_size, this,
+                pp_type));
+        util::function_nonser<std::int64_t(bool)> outbound_stall_time(
+            util::bind_front(&parcelhandler::get_outbound_stall_time, this,
+                pp_type));
+
         performance_counters::generic_counter_type_data const counter_types[] =
         {
             { hpx::util::format("/parcels/count/{}/sent", pp_type),
@@ -1492,9 +1589,62 @@ namespace hpx { namespace parcelset
               &performance_counters::locality_counter_discoverer,
               "ns"
             },
+            { hpx::util::format(
+                "/parcelport/count/{}/pending-outbound-data", pp_type),
+              performance_counters::counter_raw,
+              hpx::util::format(
+                  "returns the amount of parcel data queued or in flight "
+                  "using the {} connection type", pp_type),
+              HPX_PERFORMANCE_COUNTER_V1,
+              util::bind(&performance_counters::locality_raw_counter_creator,
+                  _1, std::move(pending_outbound_size), _2),
+              &performance_counters::locality_counter_discoverer,
+              "bytes"
+            },
+            { hpx::util::format(
+                "/parcelport/time/{}/outbound-stall", pp_type),
+              performance_counters::counter_elapsed_time,
+              hpx::util::format(
+                  "returns the time threads were suspended because too much "
+                  "parcel data was pending for the destination using the {} "
+                  "connection type", pp_type),
+              HPX_PERFORMANCE_COUNTER_V1,
+              util::bind(&performance_counters::locality_raw_counter_creator,
+                  _1, std::move(outbound_stall_time), _2),
+              &performance_counters::locality_counter_discoverer,
+              "ns"
+            },
         };
         performance_counters::install_counter_types(
             counter_types, sizeof(counter_types)/sizeof(counter_types[0]));
+
+        // histograms of the time parcels spent in their processing stages
+        for (std::size_t i = 0;
+             i != static_cast<std::size_t>(detail::latency_stage::num_stages);
+             ++i)
+        {
+            detail::latency_stage stage =
+                static_cast<detail::latency_stage>(i);
+            char const* stage_name = detail::get_latency_stage_name(stage);
+
+            detail::get_latency_histogram_type latency_histogram(
+                util::bind_front(&parcelhandler::get_latency_histogram, this,
+                    pp_type, stage));
+
+            performance_counters::install_counter_type(
+                hpx::util::format(
+                    "/parcelport/time/{}/{}-histogram", pp_type, stage_name),
+                performance_counters::counter_histogram,
+                hpx::util::format(
+                    "returns the histogram of the time parcels spent in the "
+                    "'{}' stage using the {} connection type for the "
+                    "locality or action given by the counter parameter",
+                    stage_name, pp_type),
+                util::bind(&detail::latency_histogram_counter_creator,
+                    _1, std::move(latency_histogram), _2),
+                &performance_counters::locality_counter_discoverer,
+                HPX_PERFORMANCE_COUNTER_V1, "ns/0.1%");
+        }
 #endif
     }
 
@@ -1672,6 +1822,16 @@ namespace hpx { namespace parcelset
             "max_outbound_message_size = "
             "${HPX_PARCEL_MAX_OUTBOUND_MESSAGE_SIZE:" HPX_PP_STRINGIZE(
                 HPX_PARCEL_MAX_OUTBOUND_MESSAGE_SIZE) "}");
+        ini_defs.push_back(
+            "max_pending_outbound_size = "
+            "${HPX_PARCEL_MAX_PENDING_OUTBOUND_SIZE:" HPX_PP_STRINGIZE(
+                HPX_PARCEL_MAX_PENDING_OUTBOUND_SIZE) "}");
+        ini_defs.push_back(
+            "buffer_pool_size = "
+            "${HPX_PARCEL_BUFFER_POOL_SIZE:" HPX_PP_STRINGIZE(
+                HPX_PARCEL_BUFFER_POOL_SIZE) "}");
+        ini_defs.push_back(
+            "latency_histograms = ${HPX_PARCEL_LATENCY_HISTOGRAMS:0}");
 #if BOOST_ENDIAN_BIG_BYTE
         ini_defs.push_back("endian_out = ${HPX_PARCEL_ENDIAN_OUT:big}");
 #else
@@ -18,6 +18,12 @@
 #include <hpx/runtime_configuration/runtime_configuration.hpp>
 #include <hpx/io_service/io_service_pool.hpp>
 #include <hpx/modules/errors.hpp>
+#include <hpx/threading_base/thread_data.hpp>
+#include <hpx/timing/high_resolution_clock.hpp>
+#include <hpx/util/get_and_reset_value.hpp>
+#if defined(HPX_HAVE_PARCELPORT_ACTION_COUNTERS)
+#include <hpx/actions/base_action.hpp>
+#endif
 #if defined(HPX_HAVE_APEX)
 #include <hpx/threading_base/external_timer.hpp>
 #endif
@@ -26,9 +32,11 @@
 #include <cstddef>
 #include <cstdint>
 #include <exception>
+#include <mutex>
 #include <string>
 #include <system_error>
 #include <utility>
+#include <vector>
 
 namespace hpx { namespace parcelset
 {
@@ -36,10 +44,21 @@ namespace hpx { namespace parcelset
     parcelport::parcelport(util::runtime_configuration const& ini,
             locality const & here, std::string const& type)
       : applier_(nullptr),
-        num_parcel_destinations_(0),
+        parcel_destinations_(std::make_shared<pending_parcels_map const>()),
+        num_pending_parcels_(0),
         here_(here),
         max_inbound_message_size_(ini.get_max_inbound_message_size()),
         max_outbound_message_size_(ini.get_max_outbound_message_size()),
+        max_pending_outbound_size_(hpx::util::get_entry_as<std::int64_t>(ini,
+            "hpx.parcel." + type + ".max_pending_outbound_size",
+            HPX_PARCEL_MAX_PENDING_OUTBOUND_SIZE)),
+        total_pending_outbound_size_(0),
+        outbound_stall_time_(0),
+        buffer_pool_(hpx::util::get_entry_as<std::size_t>(ini,
+            "hpx.parcel." + type + ".buffer_pool_size",
+            HPX_PARCEL_BUFFER_POOL_SIZE)),
+        collect_latency_data_(hpx::util::get_entry_as<int>(ini,
+            "hpx.parcel." + type + ".latency_histograms", 0) != 0),
         allow_array_optimizations_(true),
         allow_zero_copy_optimizations_(true),
         async_serialization_(false),
@@ -100,6 +119,23 @@ namespace hpx { namespace parcelset
     }
 #endif
 
+    void parcelport::add_latency_data_impl(detail::latency_stage stage,
+        std::uint32_t locality_id, parcel& p, std::int64_t timestamp)
+    {
+        // parcels which were not stamped before are not accounted for
+        if (p.stage_time() != 0)
+        {
+#if defined(HPX_HAVE_PARCELPORT_ACTION_COUNTERS)
+            std::uint32_t action_id = p.get_action()->get_action_id();
+#else
+            std::uint32_t action_id = 0;
+#endif
+            latency_histograms_.add(
+                stage, locality_id, action_id, timestamp - p.stage_time());
+        }
+        p.stage_time() = timestamp;
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     // number of parcels sent
     std::int64_t parcelport::get_parcel_send_count(bool reset)
@@ -189,16 +225,147 @@ namespace hpx { namespace parcelset
 
     std::int64_t parcelport::get_pending_parcels_count(bool /*reset*/)
     {
-        std::lock_guard<lcos::local::spinlock> l(mtx_);
-        std::int64_t count = 0;
-        for (auto && p : pending_parcels_)
+        // the count may include a few parcels which are being enqueued
+        // concurrently
+        return num_pending_parcels_.load(std::memory_order_relaxed);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    parcelport::pending_parcels_queue& parcelport::get_pending_parcels_queue(
+        locality const& dest)
+    {
+        pending_parcels_queue* q = find_pending_parcels_queue(dest);
+        if (q != nullptr)
+            return *q;
+
+        std::lock_guard<lcos::local::spinlock> l(destinations_mtx_);
+
+        // the destination might have been added concurrently
+        std::shared_ptr<pending_parcels_map const> dests =
+            get_pending_parcels_map();
+        auto it = dests->find(dest);
+        if (it != dests->end())
+            return *it->second;
+
+        std::shared_ptr<pending_parcels_map> new_dests =
+            std::make_shared<pending_parcels_map>(*dests);
+        std::shared_ptr<pending_parcels_queue>& new_q = (*new_dests)[dest];
+        new_q = std::make_shared<pending_parcels_queue>();
+
+        // the queue is kept alive by all later versions of the map
+        pending_parcels_queue& result = *new_q;
+        std::atomic_store(&parcel_destinations_,
+            std::shared_ptr<pending_parcels_map const>(std::move(new_dests)));
+        return result;
+    }
+
+    parcelport::pending_parcels_queue* parcelport::find_pending_parcels_queue(
+        locality const& dest) const
+    {
+        std::shared_ptr<pending_parcels_map const> dests =
+            get_pending_parcels_map();
+
+        auto it = dests->find(dest);
+        return it != dests->end() ? it->second.get() : nullptr;
+    }
+
+    void parcelport::get_pending_parcels_destinations(
+        std::vector<locality>& destinations) const
+    {
+        std::shared_ptr<pending_parcels_map const> dests =
+            get_pending_parcels_map();
+
+        for (auto const& dest : *dests)
+        {
+            if (dest.second->count_.load(std::memory_order_relaxed) > 0)
+                destinations.push_back(dest.first);
+        }
+    }
+
+    std::int64_t parcelport::get_pending_outbound_size(bool /*reset*/)
+    {
+        return total_pending_outbound_size_.load(std::memory_order_relaxed);
+    }
+
+    std::int64_t parcelport::get_outbound_stall_time(bool reset)
+    {
+        return util::get_and_reset_value(outbound_stall_time_, reset);
+    }
+
+    std::vector<std::int64_t> parcelport::get_latency_histogram(
+        detail::latency_stage stage, std::string const& filter,
+        std::int64_t min_boundary, std::int64_t max_boundary,
+        std::int64_t num_buckets, bool reset)
+    {
+        return latency_histograms_.get(
+            stage, filter, min_boundary, max_boundary, num_buckets, reset);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void parcelport::wait_for_outbound_credits(
+        pending_parcels_queue* q, parcel const& p)
+    {
+        // Only HPX threads are suspended, control traffic has to flow
+        // regardless of the amount of pending data.
+        if (q == nullptr || p.is_high_priority() ||
+            threads::get_self_ptr() == nullptr || has_outbound_credits(*q))
+        {
+            return;
+        }
+
+        std::uint64_t const start = hpx::chrono::high_resolution_clock::now();
+
+        // The credits are given back by release_outbound_credits once the
+        // pending data has been sent by the background work. The waiter is
+        // registered before the counter is checked again under the lock,
+        // which makes sure that no notification is missed.
+        ++q->credits_waiters_;
+        {
+            std::unique_lock<lcos::local::spinlock> l(credits_mtx_);
+            credits_cond_.wait(l, [&]() {
+                return has_outbound_credits(*q) ||
+                    !threads::threadmanager_is(state_running);
+            });
+        }
+        --q->credits_waiters_;
+
+        outbound_stall_time_ += static_cast<std::int64_t>(
+            hpx::chrono::high_resolution_clock::now() - start);
+    }
+
+    parcelport::write_handler_type parcelport::acquire_outbound_credits(
+        pending_parcels_queue* q, parcel const& p, write_handler_type&& f)
+    {
+        if (q == nullptr)
+            return std::move(f);
+
+        std::int64_t const size = static_cast<std::int64_t>(p.size());
+
+        q->outbound_size_ += size;
+        total_pending_outbound_size_ += size;
+
+        // the queues stay valid as long as the parcelport exists
+        return [this, q, size, f = std::move(f)](
+                   std::error_code const& ec, parcel const& p) {
+            release_outbound_credits(*q, size);
+            if (f)
+                f(ec, p);
+        };
+    }
+
+    void parcelport::release_outbound_credits(
+        pending_parcels_queue& q, std::int64_t size)
+    {
+        HPX_ASSERT(q.outbound_size_ >= size);
+        q.outbound_size_ -= size;
+        total_pending_outbound_size_ -= size;
+
+        // the lock is acquired only if somebody is waiting for the credits
+        if (q.credits_waiters_ != 0)
         {
-            count += hpx::get<0>(p.second).size();
-            HPX_ASSERT(
-                hpx::get<0>(p.second).size() ==
-                hpx::get<1>(p.second).size());
+            std::lock_guard<lcos::local::spinlock> l(credits_mtx_);
+            credits_cond_.notify_all();
         }
-        return count;
     }
 
     ///////////////////////////////////////////////////////////////////////////
@@ -339,7 +339,7 @@ namespace hpx {
 #endif
 
             if (0 == num_thread)
-                hpx::agas::garbage_collect_non_blocking();
+                naming::get_agas_client().garbage_collect_if_due();
             return result;
         }
 #else
@@ -356,7 +356,7 @@ namespace hpx {
 #endif
 
             if (0 == num_thread)
-                hpx::agas::garbage_collect_non_blocking();
+                naming::get_agas_client().garbage_collect_if_due();
             return result;
         }
 #endif
@@ -1176,6 +1176,85 @@ namespace hpx {
                     component_instance_counter_creator,
                 &performance_counters::locality_counter_discoverer, ""},
 
+            // adaptive chunk size counters
+            {"/runtime/adaptive-chunk-size/chunk-size",
+                performance_counters::counter_raw,
+                "returns the chunk size currently selected for the call sites "
+                "using an adaptive_chunk_size executor parameters object "
+                "(the tag of the parameters object has to be specified as "
+                "the counter parameter, append '#<n>' to select the n-th "
+                "call site using this tag, otherwise all call sites are "
+                "combined)",
+                HPX_PERFORMANCE_COUNTER_V1,
+                &performance_counters::detail::
+                    adaptive_chunk_size_counter_creator,
+                &performance_counters::locality_counter_discoverer, ""},
+            {"/runtime/adaptive-chunk-size/cores",
+                performance_counters::counter_raw,
+                "returns the number of cores currently selected for the call "
+                "sites using an adaptive_chunk_size executor parameters "
+                "object "
+                "(the tag of the parameters object has to be specified as "
+                "the counter parameter, append '#<n>' to select the n-th "
+                "call site using this tag, otherwise all call sites are "
+                "combined)",
+                HPX_PERFORMANCE_COUNTER_V1,
+                &performance_counters::detail::
+                    adaptive_chunk_size_counter_creator,
+                &performance_counters::locality_counter_discoverer, ""},
+            {"/runtime/adaptive-chunk-size/time-per-iteration",
+                performance_counters::counter_raw,
+                "returns the wall time per iteration measured for the "
+                "currently selected configuration of the call sites using an "
+                "adaptive_chunk_size executor parameters object "
+                "(the tag of the parameters object has to be specified as "
+                "the counter parameter, append '#<n>' to select the n-th "
+                "call site using this tag, otherwise all call sites are "
+                "combined)",
+                HPX_PERFORMANCE_COUNTER_V1,
+                &performance_counters::detail::
+                    adaptive_chunk_size_counter_creator,
+                &performance_counters::locality_counter_discoverer,
+                "ps"    // unit of measure is picoseconds
+            },
+            {"/runtime/adaptive-chunk-size/parallel-overhead",
+                performance_counters::counter_raw,
+                "returns the time spent by all used cores in the currently "
+                "selected configuration relative to the cheapest measured "
+                "configuration (the estimated sequential time) for the call "
+                "sites using an adaptive_chunk_size executor parameters "
+                "object "
+                "(the tag of the parameters object has to be specified as "
+                "the counter parameter, append '#<n>' to select the n-th "
+                "call site using this tag, otherwise all call sites are "
+                "combined)",
+                HPX_PERFORMANCE_COUNTER_V1,
+                &performance_counters::detail::
+                    adaptive_chunk_size_counter_creator,
+                &performance_counters::locality_counter_discoverer, "%"},
+            {"/runtime/adaptive-chunk-size/invocations",
+                performance_counters::counter_raw,
+                "returns the number of invocations of the call sites using an "
+                "adaptive_chunk_size executor parameters object "
+                "(the tag of the parameters object has to be specified as "
+                "the counter parameter, append '#<n>' to select the n-th "
+                "call site using this tag, otherwise all call sites are "
+                "combined)",
+                HPX_PERFORMANCE_COUNTER_V1,
+                &performance_counters::detail::
+                    adaptive_chunk_size_counter_creator,
+                &performance_counters::locality_counter_discoverer, ""},
+            {"/runtime/adaptive-chunk-size/sites",
+                performance_counters::counter_raw,
+                "returns the number of call sites using an "
+                "adaptive_chunk_size executor parameters object with the "
+                "given tag (the tag of the parameters object has to be "
+                "specified as the counter parameter)",
+                HPX_PERFORMANCE_COUNTER_V1,
+                &performance_counters::detail::
+                    adaptive_chunk_size_counter_creator,
+                &performance_counters::locality_counter_discoverer, ""},
+
             // action invocation counters
             {"/runtime/count/action-invocation",
                 performance_counters::counter_raw,
@@ -6,11 +6,18 @@
 //  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
 
 #include <hpx/config.hpp>
+#include <hpx/async_local/apply.hpp>
+#include <hpx/modules/errors.hpp>
 #include <hpx/runtime/agas/interface.hpp>
+#include <hpx/runtime_local/runtime_local_fwd.hpp>
 #include <hpx/util/generate_unique_ids.hpp>
 #include <hpx/thread_support/unlock_guard.hpp>
+#include <hpx/threading_base/thread_data.hpp>
+#include <hpx/timing/high_resolution_clock.hpp>
 
+#include <algorithm>
 #include <cstddef>
+#include <cstdint>
 #include <mutex>
 
 namespace hpx { namespace util
@@ -23,6 +30,24 @@ namespace hpx { namespace util
         // ensure next_id doesn't overflow
         while (!lower_ || (lower_ + count) > upper_)
         {
+            // switch over to the range which was reserved ahead of time
+            if (next_lower_ && (next_lower_ + count) <= next_upper_)
+            {
+                lower_ = next_lower_;
+                upper_ = next_upper_;
+                next_lower_ = naming::invalid_gid;
+                next_upper_ = naming::invalid_gid;
+                break;
+            }
+
+            // wait for the range which is being reserved, unless the
+            // calling thread can't be suspended
+            if (reserving_ && threads::get_self_ptr() != nullptr)
+            {
+                reserved_cond_.wait(l);
+                continue;
+            }
+
             lower_ = naming::invalid_gid;
 
             naming::gid_type lower;
@@ -44,7 +69,70 @@ namespace hpx { namespace util
 
         naming::gid_type result = lower_;
         lower_ += count;
+
+        reserve_next_range(l);
         return result;
     }
+
+    void unique_id_ranges::reserve_next_range(std::unique_lock<mutex_type>& l)
+    {
+        // only one thread reserves the next range, all other threads continue
+        // to draw ids from the current range in the meantime (during startup
+        // the ids are drawn from the id pool itself, nothing to reserve)
+        if (reserving_ || next_lower_ ||
+            (lower_ + std::size_t(range_low_watermark)) <= upper_ ||
+            !hpx::is_running())
+        {
+            return;
+        }
+
+        // back off after a failed reservation
+        if (retry_time_ != 0 &&
+            hpx::chrono::high_resolution_clock::now() < retry_time_)
+        {
+            return;
+        }
+
+        reserving_ = true;
+        std::size_t generation = generation_;
+
+        // the request to AGAS is made on a separate thread, the calling
+        // thread continues to use the current range
+        unlock_guard<std::unique_lock<mutex_type> > ul(l);
+        hpx::apply([this, generation]() { fetch_next_range(generation); });
+    }
+
+    void unique_id_ranges::fetch_next_range(std::size_t generation)
+    {
+        error_code ec(lightweight);
+        naming::gid_type lower =
+            hpx::agas::get_next_id(std::size_t(range_delta), ec);
+
+        std::lock_guard<mutex_type> l(mtx_);
+
+        // the ranges were reset while the request was in flight
+        if (generation != generation_)
+            return;
+
+        if (!ec && lower)
+        {
+            next_lower_ = lower;
+            next_upper_ = lower + std::size_t(range_delta);
+
+            backoff_ = 0;
+            retry_time_ = 0;
+        }
+        else
+        {
+            // on error, the range is requested again once the back-off
+            // delay has passed or the current range is exhausted
+            backoff_ = backoff_ == 0 ? std::uint64_t(min_backoff) :
+                (std::min)(2 * backoff_, std::uint64_t(max_backoff));
+            retry_time_ = hpx::chrono::high_resolution_clock::now() + backoff_;
+        }
+
+        reserving_ = false;
+        reserved_cond_.notify_all();
+    }
 }}
 
@@ -15,9 +15,10 @@
 #if defined(HPX_DEBUG)
 #include <hpx/modules/logging.hpp>
 #endif
-#include <hpx/thread_support/unlock_guard.hpp>
 #include <hpx/threading_base/register_thread.hpp>
 #include <hpx/threading_base/thread_data.hpp>
+#include <hpx/threading_base/thread_num_tss.hpp>
+#include <hpx/topology/topology.hpp>
 #include <hpx/util/wrapper_heap_base.hpp>
 
 #include <cstddef>
@@ -33,7 +34,8 @@ namespace hpx { namespace util {
         LOSH_(info) << hpx::util::format(
             "{1}::~{1}: size({2}), max_count({3}), alloc_count({4}), "
             "free_count({5})",
-            name(), heap_count_, max_alloc_count_, alloc_count_, free_count_);
+            name(), heap_count_, max_alloc_count_.load(), alloc_count_.load(),
+            free_count_.load());
 
         if (alloc_count_ > free_count_)
         {
@@ -44,102 +46,95 @@ namespace hpx { namespace util {
 #endif
     }
 
-    void* one_size_heap_list::alloc(std::size_t count)
+    std::size_t one_size_heap_list::get_num_workers()
+    {
+        std::size_t num_workers = threads::hardware_concurrency();
+        return num_workers == 0 ? 1 : num_workers;
+    }
+
+    one_size_heap_list::worker_data_type&
+    one_size_heap_list::get_worker_data() const
     {
-        unique_lock_type guard(mtx_);
+        // threads not managed by HPX share the data of the first worker
+        std::size_t worker = hpx::get_worker_thread_num();
+        if (worker == std::size_t(-1))
+            worker = 0;
+        return workers_[worker % num_workers_];
+    }
 
+    void* one_size_heap_list::alloc(std::size_t count)
+    {
         if (HPX_UNLIKELY(0 == count))
         {
-            guard.unlock();
             HPX_THROW_EXCEPTION(
                 bad_parameter, name() + "::alloc", "cannot allocate 0 objects");
         }
 
-        //std::size_t size = 0;
+        worker_data_type& data = get_worker_data();
+        unique_lock_type lk(data.mtx_);
+
+        // try to allocate from the heap currently used by this worker
         void* p = nullptr;
+        if (data.alloc_heap_ != nullptr && data.alloc_heap_->alloc(&p, count))
         {
-            if (!heap_list_.empty())
-            {
-                //size = heap_list_.size();
-                for (auto& heap : heap_list_)
-                {
-                    bool allocated = false;
-
-                    {
-                        util::unlock_guard<unique_lock_type> ul(guard);
-                        allocated = heap->alloc(&p, count);
-                    }
-
-                    if (allocated)
-                    {
-#if defined(HPX_DEBUG)
-                        // Allocation succeeded, update statistics.
-                        alloc_count_ += count;
-                        if (alloc_count_ - free_count_ > max_alloc_count_)
-                            max_alloc_count_ = alloc_count_ - free_count_;
-#endif
-                        return p;
-                    }
-
 #if defined(HPX_DEBUG)
-                    LOSH_(info) << hpx::util::format(
-                        "{1}::alloc: failed to allocate from heap[{2}] "
-                        "(heap[{2}] has allocated {3} objects and has "
-                        "space for {4} more objects)",
-                        name(), heap->heap_count(), heap->size(),
-                        heap->free_size());
-#endif
-                }
+            // Allocation succeeded, update statistics.
+            std::size_t alloc_count = (alloc_count_ += count);
+            std::size_t allocated = alloc_count - free_count_;
+            std::size_t max_alloc_count = max_alloc_count_;
+            while (allocated > max_alloc_count &&
+                !max_alloc_count_.compare_exchange_weak(
+                    max_alloc_count, allocated))
+            {
             }
+#endif
+            return p;
         }
 
-        // Create new heap.
-        bool did_create = false;
-        {
 #if defined(HPX_DEBUG)
-            heap_list_.push_front(create_heap_(
-                class_name_.c_str(), heap_count_ + 1, parameters_));
-#else
-            heap_list_.push_front(
-                create_heap_(class_name_.c_str(), 0, parameters_));
+        if (data.alloc_heap_ != nullptr)
+        {
+            LOSH_(info) << hpx::util::format(
+                "{1}::alloc: failed to allocate from heap[{2}] "
+                "(heap[{2}] has allocated {3} objects and has "
+                "space for {4} more objects)",
+                name(), data.alloc_heap_->heap_count(),
+                data.alloc_heap_->size(), data.alloc_heap_->free_size());
+        }
 #endif
 
-            iterator itnew = heap_list_.begin();
-            typename list_type::value_type heap = *itnew;
-            bool result = false;
-
-            {
-                util::unlock_guard<unique_lock_type> ul(guard);
-                result = heap->alloc((void**) &p, count);
-            }
-
-            if (HPX_UNLIKELY(!result || nullptr == p))
-            {
-                // out of memory
-                guard.unlock();
-                HPX_THROW_EXCEPTION(out_of_memory, name() + "::alloc",
-                    hpx::util::format(
-                        "new heap failed to allocate {1} objects", count));
-            }
-
+        // Create new heap, the heap is used by this worker only.
+        std::shared_ptr<util::wrapper_heap_base> heap;
+        {
+            unique_lock_type guard(mtx_);
 #if defined(HPX_DEBUG)
-            alloc_count_ += count;
+            heap = create_heap_(
+                class_name_.c_str(), heap_count_ + 1, parameters_);
             ++heap_count_;
 
             LOSH_(info) << hpx::util::format(
                 "{1}::alloc: creating new heap[{2}], size is now {3}", name(),
-                heap_count_, heap_list_.size());
+                heap_count_, heap_list_.size() + 1);
+#else
+            heap = create_heap_(class_name_.c_str(), 0, parameters_);
 #endif
-            did_create = true;
+            heap_list_.push_front(heap);
         }
 
-        if (did_create)
-            return p;
-
-        guard.unlock();
+        data.alloc_heap_ = heap.get();
+        if (HPX_UNLIKELY(!heap->alloc(&p, count) || nullptr == p))
+        {
+            // out of memory
+            lk.unlock();
+            HPX_THROW_EXCEPTION(out_of_memory, name() + "::alloc",
+                hpx::util::format(
+                    "new heap failed to allocate {1} objects", count));
+        }
 
-        // Try again, we just got a new heap, so we should be good.
-        return alloc(count);
+#if defined(HPX_DEBUG)
+        alloc_count_ += count;
+#endif
+        return p;
     }
 
     bool one_size_heap_list::reschedule(void* p, std::size_t count)
@@ -158,8 +153,6 @@ namespace hpx { namespace util {
 
     void one_size_heap_list::free(void* p, std::size_t count)
     {
-        unique_lock_type ul(mtx_);
-
         if (nullptr == p || !threads::threadmanager_is(state_running))
             return;
 
@@ -169,28 +162,16 @@ namespace hpx { namespace util {
             return;
 
         // Find the heap which allocated this pointer.
-        for (auto& heap : heap_list_)
+        util::wrapper_heap_base* heap = find_heap(p);
+        if (heap != nullptr)
         {
-            bool did_allocate = false;
-
-            {
-                util::unlock_guard<unique_lock_type> ull(ul);
-                did_allocate = heap->did_alloc(p);
-                if (did_allocate)
-                    heap->free(p, count);
-            }
-
-            if (did_allocate)
-            {
+            heap->free(p, count);
 #if defined(HPX_DEBUG)
-                free_count_ += count;
+            free_count_ += count;
 #endif
-                return;
-            }
+            return;
         }
 
-        ul.unlock();
-
         HPX_THROW_EXCEPTION(bad_parameter, name() + "::free",
             hpx::util::format(
                 "pointer {1} was not allocated by this {2}", p, name()));
@@ -198,20 +179,44 @@ namespace hpx { namespace util {
 
     bool one_size_heap_list::did_alloc(void* p) const
     {
-        unique_lock_type ul(mtx_);
-        for (typename list_type::value_type const& heap : heap_list_)
+        return find_heap(p) != nullptr;
+    }
+
+    util::wrapper_heap_base* one_size_heap_list::find_heap(void* p) const
+    {
+        worker_data_type& data = get_worker_data();
+
+        // Objects are most likely released by the worker which has allocated
+        // them or by a worker which has released objects from the same heap
+        // before, look at those heaps first.
         {
-            bool did_allocate = false;
+            std::lock_guard<mutex_type> lk(data.mtx_);
+            if (data.alloc_heap_ != nullptr && data.alloc_heap_->did_alloc(p))
+                return data.alloc_heap_;
+            if (data.free_heap_ != nullptr && data.free_heap_->did_alloc(p))
+                return data.free_heap_;
+        }
 
+        util::wrapper_heap_base* heap = nullptr;
+        {
+            std::lock_guard<mutex_type> guard(mtx_);
+            for (auto const& h : heap_list_)
             {
-                util::unlock_guard<unique_lock_type> ull(ul);
-                did_allocate = heap->did_alloc(p);
+                // did_alloc does not acquire any lock
+                if (h->did_alloc(p))
+                {
+                    heap = h.get();
+                    break;
+                }
             }
+        }
 
-            if (did_allocate)
-                return true;
+        if (heap != nullptr)
+        {
+            std::lock_guard<mutex_type> lk(data.mtx_);
+            data.free_heap_ = heap;
         }
-        return false;
+        return heap;
     }
 
     std::string one_size_heap_list::name() const
@@ -18,6 +18,7 @@
 #include <hpx/cache/local_cache.hpp>
 #include <hpx/cache/statistics/local_full_statistics.hpp>
 #include <hpx/preprocessor/stringize.hpp>
+#include <hpx/runtime/agas/detail/gva_cache.hpp>
 #include <hpx/statistics/histogram.hpp>
 #include <hpx/modules/testing.hpp>
 
@@ -30,6 +31,7 @@
 #include <iomanip>
 #include <iostream>
 #include <map>
+#include <mutex>
 #include <string>
 #include <utility>
 #include <vector>
@@ -231,6 +233,76 @@ void test_update(gva_cache_type& cache, hpx::naming::gid_type first_key)
     calculate_histogram("update", timings);
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// Measure the throughput of concurrent cache hits, one task is run on each of
+// the worker threads
+template <typename F>
+void test_concurrent_get(char const* name, F&& get, std::size_t num_lookups)
+{
+    std::size_t const num_threads = hpx::get_os_thread_count();
+
+    std::vector<hpx::future<void>> tasks;
+    tasks.reserve(num_threads);
+
+    hpx::chrono::high_resolution_timer t;
+
+    for (std::size_t i = 0; i != num_threads; ++i)
+    {
+        tasks.push_back(hpx::async([&, i]() {
+            for (std::size_t j = 0; j != num_lookups; ++j)
+            {
+                get(i + j);
+            }
+        }));
+    }
+    hpx::wait_all(tasks);
+
+    double elapsed = t.elapsed();
+    std::cout << name << ": " << num_threads << " threads, "
+              << std::setprecision(3)
+              << (num_threads * num_lookups) / elapsed / 1e6
+              << " Mlookups/s" << std::endl;
+}
+
+void test_concurrent_get(gva_cache_type& cache,
+    hpx::naming::gid_type first_key, std::size_t num_entries,
+    std::size_t num_lookups)
+{
+    hpx::lcos::local::spinlock mtx;
+    test_concurrent_get("locked lru cache",
+        [&](std::size_t i) {
+            gva_cache_key key(first_key + (i % num_entries + 1), 1);
+            gva_cache_key idbase;
+            gva_cache_type::entry_type e;
+
+            std::lock_guard<hpx::lcos::local::spinlock> l(mtx);
+            cache.get_entry(key, idbase, e);
+        },
+        num_lookups);
+}
+
+void test_concurrent_get(hpx::agas::detail::gva_cache& cache,
+    hpx::naming::gid_type first_key, std::size_t num_entries,
+    std::size_t num_lookups)
+{
+    hpx::naming::gid_type locality = hpx::get_locality();
+    std::uint32_t ct = hpx::components::component_invalid;
+
+    for (std::size_t i = 0; i != num_entries; ++i)
+    {
+        hpx::agas::gva value(locality, ct, 1, std::uint64_t(0), 0);
+        cache.update_if(first_key + (i + 1), 1, value);
+    }
+
+    test_concurrent_get("sharded gva cache",
+        [&](std::size_t i) {
+            hpx::naming::gid_type idbase;
+            hpx::agas::gva e;
+            cache.get_entry(first_key + (i % num_entries + 1), idbase, e);
+        },
+        num_lookups);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 int hpx_main(hpx::program_options::variables_map& vm)
 {
@@ -253,6 +325,16 @@ int hpx_main(hpx::program_options::variables_map& vm)
     test_get(cache, first_key);
     test_update(cache, first_key);
 
+    std::size_t num_lookups = 100000;
+    if (vm.count("num_lookups"))
+        num_lookups = vm["num_lookups"].as<std::size_t>();
+
+    std::size_t const num_cached = (std::min)(num_entries, cache_size);
+    test_concurrent_get(cache, first_key, num_cached, num_lookups);
+
+    hpx::agas::detail::gva_cache sharded_cache(cache_size);
+    test_concurrent_get(sharded_cache, first_key, num_cached, num_lookups);
+
     double elapsed = t1.elapsed();
     hpx::util::print_cdash_timing("AGASCache", elapsed);
 
@@ -271,6 +353,8 @@ int main(int argc, char* argv[])
          HPX_PP_STRINGIZE(HPX_AGAS_LOCAL_CACHE_SIZE_PER_THREAD) ")")
         ("num_entries,n", value<std::size_t>(),
          "number of items to insert into cache (default: 1000)")
+        ("num_lookups", value<std::size_t>(),
+         "number of concurrent lookups per thread (default: 100000)")
         ;
 
     // Initialize and run HPX
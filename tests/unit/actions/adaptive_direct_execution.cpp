@@ -0,0 +1,228 @@
+//  Copyright (c) 2020 STE||AR Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Remote actions which consistently finish quickly are executed directly on
+// the thread decoding the parcel. This test verifies that such actions are
+// selected for direct execution, that they fall back to being run on a new
+// thread after a slow or a suspending run, and that actions with and without
+// continuations still deliver their results when executed directly.
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/actions.hpp>
+#include <hpx/include/async.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/include/threads.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/timing/high_resolution_timer.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+int fast(int i)
+{
+    return i + 1;
+}
+HPX_PLAIN_ACTION(fast, fast_action);
+
+void maybe_slow(bool slow)
+{
+    if (slow)
+    {
+        // run for much longer than HPX_ACTION_DIRECT_EXECUTION_THRESHOLD
+        // without suspending
+        hpx::chrono::high_resolution_timer t;
+        while (t.elapsed() < 1e-3)
+            ;
+    }
+}
+HPX_PLAIN_ACTION(maybe_slow, maybe_slow_action);
+
+void maybe_suspend(bool suspend)
+{
+    if (suspend)
+    {
+        hpx::this_thread::suspend(std::chrono::milliseconds(1));
+    }
+}
+HPX_PLAIN_ACTION(maybe_suspend, maybe_suspend_action);
+
+std::atomic<std::size_t> count(0);
+
+void increment()
+{
+    ++count;
+}
+HPX_PLAIN_ACTION(increment, increment_action);
+
+std::size_t get_count()
+{
+    return count.load();
+}
+HPX_PLAIN_ACTION(get_count, get_count_action);
+
+// query the statistics of the actions on the locality executing them
+enum action_kind
+{
+    fast_kind,
+    maybe_slow_kind,
+    maybe_suspend_kind,
+    increment_kind
+};
+
+bool select_direct_execution(int kind)
+{
+    switch (kind)
+    {
+    case fast_kind:
+        return fast_action::get_execution_statistics()
+            .select_direct_execution();
+    case maybe_slow_kind:
+        return maybe_slow_action::get_execution_statistics()
+            .select_direct_execution();
+    case maybe_suspend_kind:
+        return maybe_suspend_action::get_execution_statistics()
+            .select_direct_execution();
+    case increment_kind:
+        return increment_action::get_execution_statistics()
+            .select_direct_execution();
+    default:
+        break;
+    }
+    return false;
+}
+HPX_PLAIN_ACTION(select_direct_execution, select_direct_execution_action);
+
+///////////////////////////////////////////////////////////////////////////////
+// a generous upper bound for the number of runs needed before an action is
+// selected for direct execution
+constexpr std::size_t max_runs = 100 * HPX_ACTION_DIRECT_EXECUTION_MIN_SAMPLES;
+
+bool is_selected(hpx::id_type const& id, action_kind kind)
+{
+    return select_direct_execution_action()(id, kind);
+}
+
+template <typename Action, typename... Ts>
+bool warm_up(hpx::id_type const& id, action_kind kind, Ts... vs)
+{
+    for (std::size_t i = 0; i != max_runs; ++i)
+    {
+        hpx::async<Action>(id, vs...).get();
+        if (is_selected(id, kind))
+            return true;
+    }
+    return false;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_selection(hpx::id_type const& id)
+{
+    HPX_TEST(!is_selected(id, fast_kind));
+
+    // the action is not selected before enough runs were recorded
+    for (std::size_t i = 0; i + 1 < HPX_ACTION_DIRECT_EXECUTION_MIN_SAMPLES;
+         ++i)
+    {
+        HPX_TEST_EQ(hpx::async<fast_action>(id, int(i)).get(), int(i) + 1);
+    }
+    HPX_TEST(!is_selected(id, fast_kind));
+
+    HPX_TEST(warm_up<fast_action>(id, fast_kind, 0));
+}
+
+void test_continuation(hpx::id_type const& id)
+{
+    HPX_TEST(is_selected(id, fast_kind));
+
+    // the results of directly executed actions are delivered through their
+    // continuations
+    std::vector<hpx::future<int>> results;
+    for (int i = 0; i != 100; ++i)
+    {
+        results.push_back(hpx::async<fast_action>(id, i));
+    }
+    for (int i = 0; i != 100; ++i)
+    {
+        HPX_TEST_EQ(results[i].get(), i + 1);
+    }
+
+    HPX_TEST(is_selected(id, fast_kind));
+}
+
+void test_no_continuation(hpx::id_type const& id)
+{
+    std::size_t const initial = get_count_action()(id);
+
+    // actions without a continuation are executed directly as well
+    HPX_TEST(warm_up<increment_action>(id, increment_kind));
+
+    std::size_t const expected = get_count_action()(id) + 100;
+    for (std::size_t i = 0; i != 100; ++i)
+    {
+        hpx::apply<increment_action>(id);
+    }
+
+    std::size_t current = get_count_action()(id);
+    for (int i = 0; current != expected && i != 1000; ++i)
+    {
+        hpx::this_thread::sleep_for(std::chrono::milliseconds(10));
+        current = get_count_action()(id);
+    }
+    HPX_TEST_EQ(current, expected);
+    HPX_TEST_LT(initial, current);
+}
+
+void test_fallback_after_slow_run(hpx::id_type const& id)
+{
+    HPX_TEST(warm_up<maybe_slow_action>(id, maybe_slow_kind, false));
+
+    // a single slow run disables the direct execution
+    hpx::async<maybe_slow_action>(id, true).get();
+    HPX_TEST(!is_selected(id, maybe_slow_kind));
+
+    // the action is selected again after enough short runs
+    HPX_TEST(warm_up<maybe_slow_action>(id, maybe_slow_kind, false));
+}
+
+void test_fallback_after_suspension(hpx::id_type const& id)
+{
+    HPX_TEST(warm_up<maybe_suspend_action>(id, maybe_suspend_kind, false));
+
+    // an action which has suspended once is never executed directly again
+    hpx::async<maybe_suspend_action>(id, true).get();
+    HPX_TEST(!is_selected(id, maybe_suspend_kind));
+
+    HPX_TEST(!warm_up<maybe_suspend_action>(id, maybe_suspend_kind, false));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    for (hpx::id_type const& id : hpx::find_remote_localities())
+    {
+        test_selection(id);
+        test_continuation(id);
+        test_no_continuation(id);
+        test_fallback_after_slow_run(id);
+        test_fallback_after_suspension(id);
+    }
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ_MSG(hpx::init(argc, argv), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
+#endif
@@ -0,0 +1,247 @@
+//  Copyright (c) 2020 STE||AR Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// The bulk versions of resolve_async and bind_async group the ids by the
+// AGAS service instance managing them. This test mixes ids managed by both
+// localities, some of them cached and some not, and verifies the results,
+// their order, and the state of the cache afterwards.
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/actions.hpp>
+#include <hpx/include/async.hpp>
+#include <hpx/include/components.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/include/serialization.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+struct test_server : hpx::components::component_base<test_server>
+{
+};
+
+typedef hpx::components::component<test_server> server_type;
+HPX_REGISTER_COMPONENT(server_type, test_server);
+
+///////////////////////////////////////////////////////////////////////////////
+constexpr std::size_t num_objects = 8;
+
+// the ids are resolved by the locality managing them
+hpx::naming::address resolve_locally(hpx::naming::gid_type const& gid)
+{
+    return hpx::naming::get_agas_client().resolve_async(gid).get();
+}
+HPX_PLAIN_ACTION(resolve_locally, resolve_locally_action);
+
+// a returned gid_type would be turned into an id_type, return its bits instead
+std::pair<std::uint64_t, std::uint64_t> get_next_ids(std::size_t count)
+{
+    hpx::naming::gid_type const gid = hpx::agas::get_next_id(count);
+    return std::make_pair(gid.get_msb(), gid.get_lsb());
+}
+HPX_PLAIN_ACTION(get_next_ids, get_next_ids_action);
+
+hpx::naming::gid_type next_ids_on(hpx::id_type const& id, std::size_t count)
+{
+    std::pair<std::uint64_t, std::uint64_t> const bits =
+        get_next_ids_action()(id, count);
+    return hpx::naming::gid_type(bits.first, bits.second);
+}
+
+bool is_cached(hpx::naming::gid_type const& gid, hpx::naming::address& addr)
+{
+    return hpx::naming::get_agas_client().resolve_cached(gid, addr);
+}
+
+bool equal(hpx::naming::address const& lhs, hpx::naming::address const& rhs)
+{
+    return lhs.locality_ == rhs.locality_ && lhs.type_ == rhs.type_ &&
+        lhs.address_ == rhs.address_;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_bulk_resolve(hpx::id_type const& remote)
+{
+    hpx::agas::addressing_service& agas = hpx::naming::get_agas_client();
+
+    std::vector<hpx::id_type> local_objects =
+        hpx::new_<test_server[]>(hpx::find_here(), num_objects).get();
+    std::vector<hpx::id_type> remote_objects =
+        hpx::new_<test_server[]>(remote, num_objects).get();
+
+    // half of the remote ids are cached, the other half is not
+    for (std::size_t i = 0; i != num_objects; ++i)
+    {
+        agas.remove_cache_entry(remote_objects[i].get_gid());
+    }
+    for (std::size_t i = 0; i < num_objects; i += 2)
+    {
+        agas.resolve_async(remote_objects[i].get_gid()).get();
+    }
+
+    hpx::naming::address addr;
+    for (std::size_t i = 0; i != num_objects; ++i)
+    {
+        HPX_TEST_EQ(is_cached(remote_objects[i].get_gid(), addr), i % 2 == 0);
+    }
+
+    // interleave the local and remote ids, the expected addresses are the
+    // ones known by the managing locality
+    std::vector<hpx::naming::gid_type> gids;
+    std::vector<hpx::naming::address> expected;
+    for (std::size_t i = 0; i != num_objects; ++i)
+    {
+        gids.push_back(remote_objects[num_objects - i - 1].get_gid());
+        expected.push_back(
+            hpx::async<resolve_locally_action>(remote, gids.back()).get());
+
+        gids.push_back(local_objects[i].get_gid());
+        expected.push_back(resolve_locally(gids.back()));
+    }
+
+    std::vector<hpx::naming::address> addrs = agas.resolve_async(gids).get();
+
+    // the results are returned in the order of the ids
+    HPX_TEST_EQ(addrs.size(), gids.size());
+    for (std::size_t i = 0; i != addrs.size(); ++i)
+    {
+        HPX_TEST(equal(addrs[i], expected[i]));
+        HPX_TEST(addrs[i].type_ ==
+            hpx::components::get_component_type<test_server>());
+    }
+
+    // all remote ids are cached now
+    for (std::size_t i = 0; i != num_objects; ++i)
+    {
+        HPX_TEST(is_cached(remote_objects[i].get_gid(), addr));
+        HPX_TEST(equal(addr, expected[2 * (num_objects - i - 1)]));
+    }
+
+    // an invalid id is rejected right away
+    gids.push_back(hpx::naming::invalid_gid);
+
+    bool caught_exception = false;
+    try
+    {
+        agas.resolve_async(gids).get();
+    }
+    catch (hpx::exception const& e)
+    {
+        HPX_TEST_EQ(e.get_error(), hpx::bad_parameter);
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+
+    // an id which is not bound is reported by the returned future
+    gids.back() = next_ids_on(remote, 1);
+
+    hpx::future<std::vector<hpx::naming::address>> f =
+        agas.resolve_async(gids);
+
+    caught_exception = false;
+    try
+    {
+        f.get();
+    }
+    catch (hpx::exception const&)
+    {
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_bulk_bind(hpx::id_type const& remote)
+{
+    hpx::agas::addressing_service& agas = hpx::naming::get_agas_client();
+
+    // ids managed by either of the localities
+    hpx::naming::gid_type const local_base =
+        hpx::agas::get_next_id(num_objects);
+    hpx::naming::gid_type const remote_base =
+        next_ids_on(remote, num_objects);
+
+    static int objects[2 * num_objects];
+
+    std::vector<hpx::naming::gid_type> gids;
+    std::vector<hpx::naming::address> addrs;
+    for (std::size_t i = 0; i != num_objects; ++i)
+    {
+        gids.push_back(local_base + i);
+        gids.push_back(remote_base + (num_objects - i - 1));
+    }
+    for (std::size_t i = 0; i != gids.size(); ++i)
+    {
+        addrs.emplace_back(agas.get_local_locality(),
+            hpx::components::get_component_type<test_server>(),
+            &objects[i]);
+    }
+
+    std::vector<bool> bound =
+        agas.bind_async(gids, addrs, agas.get_local_locality()).get();
+
+    HPX_TEST_EQ(bound.size(), gids.size());
+    for (std::size_t i = 0; i != bound.size(); ++i)
+    {
+        HPX_TEST(bound[i]);
+    }
+
+    // the ids managed by the remote locality are cached
+    hpx::naming::address addr;
+    for (std::size_t i = 1; i < gids.size(); i += 2)
+    {
+        HPX_TEST(is_cached(gids[i], addr));
+        HPX_TEST(equal(addr, addrs[i]));
+    }
+
+    // the managing localities know about the new bindings
+    for (std::size_t i = 0; i != gids.size(); ++i)
+    {
+        hpx::naming::address resolved = (i % 2 == 0) ?
+            resolve_locally(gids[i]) :
+            hpx::async<resolve_locally_action>(remote, gids[i]).get();
+        HPX_TEST(equal(resolved, addrs[i]));
+    }
+
+    std::vector<hpx::naming::address> resolved =
+        agas.resolve_async(gids).get();
+    HPX_TEST_EQ(resolved.size(), gids.size());
+    for (std::size_t i = 0; i != resolved.size(); ++i)
+    {
+        HPX_TEST(equal(resolved[i], addrs[i]));
+    }
+
+    for (hpx::naming::gid_type const& gid : gids)
+    {
+        agas.unbind_range_async(gid).get();
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    for (hpx::id_type const& remote : hpx::find_remote_localities())
+    {
+        test_bulk_resolve(remote);
+        test_bulk_bind(remote);
+    }
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ_MSG(hpx::init(argc, argv), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
+#endif
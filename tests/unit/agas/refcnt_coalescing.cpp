@@ -0,0 +1,245 @@
+//  Copyright (c) 2020 STE||AR Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Buffered decrements for consecutive GIDs carrying the same credit are sent
+// to AGAS as a single range. This test releases references to consecutive
+// GIDs with equal and with unequal credits and verifies that the decrements
+// are combined as expected and that the objects are freed exactly when their
+// reference count drops to zero.
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/actions.hpp>
+#include <hpx/include/components.hpp>
+#include <hpx/include/performance_counters.hpp>
+#include <hpx/include/threads.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+std::atomic<std::size_t> alive(0);
+
+struct test_server : hpx::components::managed_component_base<test_server>
+{
+    test_server()
+    {
+        ++alive;
+    }
+    ~test_server()
+    {
+        --alive;
+    }
+
+    std::size_t call() const
+    {
+        return 42;
+    }
+
+    HPX_DEFINE_COMPONENT_ACTION(test_server, call);
+};
+
+typedef hpx::components::managed_component<test_server> server_type;
+HPX_REGISTER_COMPONENT(server_type, test_server);
+
+typedef test_server::call_action call_action;
+HPX_REGISTER_ACTION(call_action);
+
+///////////////////////////////////////////////////////////////////////////////
+constexpr std::size_t num_objects = 64;
+constexpr std::size_t window = 8;
+
+hpx::id_type split_credits(hpx::id_type const& id)
+{
+    return hpx::id_type(hpx::naming::detail::split_credits_for_gid(
+                            const_cast<hpx::id_type&>(id).get_gid()),
+        hpx::id_type::managed);
+}
+
+// Objects are destroyed while the decrement requests are handled by AGAS,
+// flush all pending requests and wait for this to happen.
+void wait_for_alive(std::size_t expected)
+{
+    hpx::agas::garbage_collect();
+    for (std::size_t i = 0; i != 1000 && alive != expected; ++i)
+    {
+        hpx::this_thread::sleep_for(std::chrono::milliseconds(10));
+        hpx::agas::garbage_collect();
+    }
+    HPX_TEST_EQ(alive.load(), expected);
+}
+
+// The counters are created once, creating them later on would add their own
+// decrements to the ones under test.
+struct refcnt_counters
+{
+    refcnt_counters()
+      : coalesced_("/agas{locality#0/total}/count/refcnt/coalesced")
+      , sent_("/agas{locality#0/total}/count/refcnt/sent")
+    {
+    }
+
+    // Flush all buffered decrements and return the number of combined
+    // decrements and of messages sent since the last call
+    void flush(std::int64_t& coalesced, std::int64_t& sent)
+    {
+        hpx::agas::garbage_collect();
+        coalesced = coalesced_.get_value<std::int64_t>(hpx::launch::sync, true);
+        sent = sent_.get_value<std::int64_t>(hpx::launch::sync, true);
+    }
+
+    hpx::performance_counters::performance_counter coalesced_;
+    hpx::performance_counters::performance_counter sent_;
+};
+
+refcnt_counters* counters = nullptr;
+
+// Create objects and return references to a number of them which are bound
+// to consecutive GIDs, all other objects are released.
+std::vector<hpx::id_type> create_consecutive_objects()
+{
+    std::vector<hpx::id_type> ids =
+        hpx::new_<test_server[]>(hpx::find_here(), num_objects).get();
+
+    std::sort(ids.begin(), ids.end(),
+        [](hpx::id_type const& lhs, hpx::id_type const& rhs) {
+            return lhs.get_lsb() < rhs.get_lsb();
+        });
+
+    std::vector<hpx::id_type> result;
+    for (std::size_t i = 0; i + window <= ids.size(); ++i)
+    {
+        if (ids[i + window - 1].get_lsb() - ids[i].get_lsb() == window - 1)
+        {
+            result.assign(ids.begin() + i, ids.begin() + i + window);
+            break;
+        }
+    }
+    HPX_TEST_EQ(result.size(), window);
+
+    ids.clear();
+    wait_for_alive(result.size());
+
+    return result;
+}
+
+void test_equal_credits()
+{
+    std::vector<hpx::id_type> ids = create_consecutive_objects();
+
+    // all GIDs carry half of the initial credit, both halves are released
+    // as a single range
+    std::vector<hpx::id_type> keep;
+    for (hpx::id_type const& id : ids)
+    {
+        keep.push_back(split_credits(id));
+    }
+
+    std::int64_t coalesced = 0;
+    std::int64_t sent = 0;
+    counters->flush(coalesced, sent);
+
+    ids.clear();
+
+    // the decrements went out as a single range in a single message
+    counters->flush(coalesced, sent);
+    HPX_TEST_EQ(coalesced, std::int64_t(window - 1));
+    HPX_TEST_EQ(sent, std::int64_t(1));
+
+    wait_for_alive(keep.size());
+
+    for (hpx::id_type const& id : keep)
+    {
+        HPX_TEST_EQ(hpx::async<call_action>(id).get(), std::size_t(42));
+    }
+
+    keep.clear();
+    wait_for_alive(0);
+}
+
+void test_unequal_credits()
+{
+    std::vector<hpx::id_type> ids = create_consecutive_objects();
+
+    // every other GID carries half of the initial credit, the others carry
+    // all of it
+    std::vector<hpx::id_type> keep;
+    for (std::size_t i = 0; i < ids.size(); i += 2)
+    {
+        keep.push_back(split_credits(ids[i]));
+    }
+
+    std::int64_t coalesced = 0;
+    std::int64_t sent = 0;
+    counters->flush(coalesced, sent);
+
+    // only the objects without a remaining reference are freed
+    ids.clear();
+
+    // neighboring decrements differ, they are sent as separate ranges in a
+    // single message
+    counters->flush(coalesced, sent);
+    HPX_TEST_EQ(coalesced, std::int64_t(0));
+    HPX_TEST_EQ(sent, std::int64_t(1));
+
+    wait_for_alive(keep.size());
+
+    for (hpx::id_type const& id : keep)
+    {
+        HPX_TEST_EQ(hpx::async<call_action>(id).get(), std::size_t(42));
+    }
+
+    // split the remaining references once more, the objects have to stay
+    // alive until the last part is released
+    std::vector<hpx::id_type> keep_more;
+    for (std::size_t i = 0; i < keep.size(); i += 2)
+    {
+        keep_more.push_back(split_credits(keep[i]));
+    }
+
+    keep.clear();
+    wait_for_alive(keep_more.size());
+
+    keep_more.clear();
+    wait_for_alive(0);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    {
+        refcnt_counters c;
+        counters = &c;
+
+        test_equal_credits();
+        test_unequal_credits();
+
+        counters = nullptr;
+    }
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // buffered decrements are sent only when the test flushes them
+    std::vector<std::string> const cfg = {
+        "hpx.agas.max_pending_refcnt_requests=100000",
+        "hpx.agas.max_pending_refcnt_delay=100000000"};
+
+    hpx::init_params init_args;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ(hpx::init(argc, argv, init_args), 0);
+    return hpx::util::report_errors();
+}
+#endif
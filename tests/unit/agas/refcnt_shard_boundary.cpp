@@ -0,0 +1,155 @@
+//  Copyright (c) 2020 STE||AR Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// The primary namespace partitions its tables into shards, consecutive
+// blocks of 1024 GIDs are assigned to consecutive shards. This test binds
+// components to a range of GIDs crossing such a block boundary and releases
+// references to them such that the decrements span both shards.
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/actions.hpp>
+#include <hpx/include/components.hpp>
+#include <hpx/include/threads.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+std::atomic<std::size_t> alive(0);
+
+struct test_server : hpx::components::managed_component_base<test_server>
+{
+    test_server()
+    {
+        ++alive;
+    }
+    ~test_server()
+    {
+        --alive;
+    }
+
+    std::size_t call() const
+    {
+        return 42;
+    }
+
+    HPX_DEFINE_COMPONENT_ACTION(test_server, call);
+};
+
+typedef hpx::components::managed_component<test_server> server_type;
+HPX_REGISTER_COMPONENT(server_type, test_server);
+
+typedef test_server::call_action call_action;
+HPX_REGISTER_ACTION(call_action);
+
+///////////////////////////////////////////////////////////////////////////////
+constexpr std::size_t num_objects = 4096;
+constexpr std::size_t window = 32;
+constexpr std::uint64_t shard_block_size = 1024;
+
+std::uint64_t get_lsb(hpx::id_type const& id)
+{
+    return id.get_lsb();
+}
+
+hpx::id_type split_credits(hpx::id_type const& id)
+{
+    return hpx::id_type(hpx::naming::detail::split_credits_for_gid(
+                            const_cast<hpx::id_type&>(id).get_gid()),
+        hpx::id_type::managed);
+}
+
+// Objects are destroyed while the decrement requests are handled by AGAS,
+// flush all pending requests and wait for this to happen.
+void wait_for_alive(std::size_t expected)
+{
+    hpx::agas::garbage_collect();
+    for (std::size_t i = 0; i != 1000 && alive != expected; ++i)
+    {
+        hpx::this_thread::sleep_for(std::chrono::milliseconds(10));
+        hpx::agas::garbage_collect();
+    }
+    HPX_TEST_EQ(alive.load(), expected);
+}
+
+void test_shard_boundary()
+{
+    std::vector<hpx::id_type> ids =
+        hpx::new_<test_server[]>(hpx::find_here(), num_objects).get();
+    HPX_TEST_EQ(alive.load(), num_objects);
+
+    std::sort(ids.begin(), ids.end(),
+        [](hpx::id_type const& lhs, hpx::id_type const& rhs) {
+            return get_lsb(lhs) < get_lsb(rhs);
+        });
+
+    // find a range of consecutive GIDs crossing a shard boundary
+    std::size_t boundary = 0;
+    for (std::size_t i = window / 2; i + window / 2 < ids.size(); ++i)
+    {
+        std::uint64_t first = get_lsb(ids[i - window / 2]);
+        std::uint64_t last = get_lsb(ids[i + window / 2 - 1]);
+        if (last - first == window - 1 &&
+            get_lsb(ids[i]) % shard_block_size == 0)
+        {
+            boundary = i;
+            break;
+        }
+    }
+    HPX_TEST_NEQ(boundary, std::size_t(0));
+    if (boundary == 0)
+        return;
+
+    // keep a second reference to the objects around the boundary
+    std::vector<hpx::id_type> keep;
+    keep.reserve(window);
+    for (std::size_t i = boundary - window / 2; i != boundary + window / 2;
+         ++i)
+    {
+        keep.push_back(split_credits(ids[i]));
+    }
+
+    // the objects on both sides of the boundary can be resolved
+    for (hpx::id_type const& id : keep)
+    {
+        HPX_TEST_EQ(hpx::async<call_action>(id).get(), std::size_t(42));
+    }
+
+    // releasing the original references must not free the objects which
+    // are still referenced
+    ids.clear();
+    wait_for_alive(window);
+
+    for (hpx::id_type const& id : keep)
+    {
+        HPX_TEST_EQ(hpx::async<call_action>(id).get(), std::size_t(42));
+    }
+
+    // releasing the remaining references frees the objects in both shards
+    keep.clear();
+    wait_for_alive(0);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    test_shard_boundary();
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ(hpx::init(argc, argv), 0);
+    return hpx::util::report_errors();
+}
+#endif
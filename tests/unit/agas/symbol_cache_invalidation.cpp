@@ -0,0 +1,139 @@
+//  Copyright (c) 2020 STE||AR Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Names resolved from the symbol namespace of another locality are cached.
+// This test resolves names from a remote locality, unregisters them, and
+// verifies that the remote locality does not resolve them from its cache
+// anymore.
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/actions.hpp>
+#include <hpx/include/async.hpp>
+#include <hpx/include/components.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// The names are spread over the symbol namespace instances of all
+// localities, some of them are cached by the resolving locality.
+constexpr std::size_t num_names = 32;
+
+std::vector<std::string> get_names(char const* basename)
+{
+    std::vector<std::string> names;
+    names.reserve(num_names);
+    for (std::size_t i = 0; i != num_names; ++i)
+    {
+        names.push_back(basename + std::to_string(i));
+    }
+    return names;
+}
+
+hpx::id_type resolve_name(std::string const& name)
+{
+    return hpx::agas::resolve_name(name).get();
+}
+HPX_PLAIN_ACTION(resolve_name, resolve_name_action);
+
+std::vector<hpx::id_type> resolve_names(std::vector<std::string> const& names)
+{
+    return hpx::naming::get_agas_client().resolve_names_async(names).get();
+}
+HPX_PLAIN_ACTION(resolve_names, resolve_names_action);
+
+///////////////////////////////////////////////////////////////////////////////
+void test_resolve(hpx::id_type const& remote)
+{
+    std::vector<std::string> names =
+        get_names("/symbol_cache_invalidation/resolve/");
+
+    for (std::string const& name : names)
+    {
+        HPX_TEST(hpx::agas::register_name(name, hpx::find_here()).get());
+    }
+
+    // resolve the names twice, the second time they are served from the
+    // cache of the remote locality (if they are held by another locality)
+    for (int i = 0; i != 2; ++i)
+    {
+        for (std::string const& name : names)
+        {
+            HPX_TEST_EQ(resolve_name_action()(remote, name), hpx::find_here());
+        }
+    }
+
+    for (std::string const& name : names)
+    {
+        HPX_TEST_EQ(hpx::agas::unregister_name(name).get(), hpx::find_here());
+    }
+
+    // unregistering a name invalidates all cached copies
+    for (std::string const& name : names)
+    {
+        HPX_TEST(!resolve_name_action()(remote, name));
+    }
+}
+
+void test_resolve_names(hpx::id_type const& remote)
+{
+    std::vector<std::string> names =
+        get_names("/symbol_cache_invalidation/resolve_names/");
+
+    for (std::string const& name : names)
+    {
+        HPX_TEST(hpx::agas::register_name(name, hpx::find_here()).get());
+    }
+
+    for (int i = 0; i != 2; ++i)
+    {
+        std::vector<hpx::id_type> ids = resolve_names_action()(remote, names);
+        HPX_TEST_EQ(ids.size(), names.size());
+        for (hpx::id_type const& id : ids)
+        {
+            HPX_TEST_EQ(id, hpx::find_here());
+        }
+    }
+
+    for (std::string const& name : names)
+    {
+        HPX_TEST_EQ(hpx::agas::unregister_name(name).get(), hpx::find_here());
+    }
+
+    std::vector<hpx::id_type> ids = resolve_names_action()(remote, names);
+    HPX_TEST_EQ(ids.size(), names.size());
+    for (hpx::id_type const& id : ids)
+    {
+        HPX_TEST(!id);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    std::vector<hpx::id_type> localities = hpx::find_remote_localities();
+    HPX_TEST(!localities.empty());
+
+    if (!localities.empty())
+    {
+        test_resolve(localities[0]);
+        test_resolve_names(localities[0]);
+    }
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ(hpx::init(argc, argv), 0);
+    return hpx::util::report_errors();
+}
+#endif
@@ -0,0 +1,107 @@
+//  Copyright (c) 2020 STE||AR Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Draw ids from several threads concurrently, crossing the boundaries of the
+// ranges reserved from AGAS several times, and verify that no id is handed
+// out twice.
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/async.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/util/generate_unique_ids.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// the size of the ranges reserved from AGAS
+constexpr std::size_t range_delta = 0x100000;
+
+// each thread draws a large part of a range, all threads together draw more
+// than two ranges
+constexpr std::size_t ids_per_thread = 3 * range_delta / 4 + 17;
+
+using id_range = std::pair<hpx::naming::gid_type, std::size_t>;
+
+std::vector<id_range> draw_ids(hpx::util::unique_id_ranges& ids)
+{
+    std::vector<id_range> result;
+
+    std::size_t drawn = 0;
+    for (std::size_t i = 0; drawn < ids_per_thread; ++i)
+    {
+        // single ids and blocks of ids
+        std::size_t count = (i % 5) + 1;
+        result.emplace_back(ids.get_id(count), count);
+        drawn += count;
+    }
+    return result;
+}
+
+void test_unique_ids()
+{
+    hpx::util::unique_id_ranges ids;
+
+    std::size_t const num_threads = hpx::get_os_thread_count() + 3;
+
+    std::vector<hpx::future<std::vector<id_range>>> futures;
+    for (std::size_t i = 0; i != num_threads; ++i)
+    {
+        futures.push_back(hpx::async(&draw_ids, std::ref(ids)));
+    }
+
+    std::vector<id_range> ranges;
+    std::size_t drawn = 0;
+    for (auto& f : futures)
+    {
+        for (id_range const& r : f.get())
+        {
+            ranges.push_back(r);
+            drawn += r.second;
+        }
+    }
+    HPX_TEST_LT(2 * range_delta, drawn);
+
+    // the blocks of ids must not overlap
+    std::sort(ranges.begin(), ranges.end(),
+        [](id_range const& lhs, id_range const& rhs) {
+            return lhs.first < rhs.first;
+        });
+
+    std::size_t overlaps = 0;
+    for (std::size_t i = 0; i != ranges.size(); ++i)
+    {
+        HPX_TEST(ranges[i].first);
+        if (i != 0 && ranges[i - 1].first + ranges[i - 1].second >
+                ranges[i].first)
+        {
+            ++overlaps;
+        }
+    }
+    HPX_TEST_EQ(overlaps, std::size_t(0));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    test_unique_ids();
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ_MSG(hpx::init(argc, argv), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
+#endif
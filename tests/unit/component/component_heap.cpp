@@ -0,0 +1,215 @@
+//  Copyright (c) 2020 STE||AR Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Managed components are allocated from per-worker heaps. This test allocates
+// elements on several workers concurrently, frees them on other workers, and
+// verifies the ids assigned to the elements and the release of the heaps once
+// all of their elements have been freed.
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/actions.hpp>
+#include <hpx/include/async.hpp>
+#include <hpx/include/components.hpp>
+#include <hpx/include/parallel_executors.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/util/wrapper_heap_base.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+struct test_server : hpx::components::managed_component_base<test_server>
+{
+};
+
+typedef hpx::components::managed_component<test_server> server_type;
+HPX_REGISTER_COMPONENT(server_type, test_server);
+
+// expose the heap owning a given element
+struct test_heap : server_type::heap_type
+{
+    using server_type::heap_type::find_heap;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+constexpr std::size_t num_tasks = 16;
+constexpr std::size_t num_elements = 1000;
+
+struct allocation
+{
+    void* p;
+    std::size_t worker;
+};
+
+hpx::parallel::execution::parallel_executor executor_for(std::size_t worker)
+{
+    return hpx::parallel::execution::parallel_executor(
+        hpx::threads::thread_schedule_hint(
+            static_cast<std::int16_t>(worker % hpx::get_os_thread_count())));
+}
+
+std::vector<allocation> allocate(test_heap& heap)
+{
+    std::vector<allocation> result;
+    for (std::size_t i = 0; i != num_elements; ++i)
+    {
+        void* p = heap.alloc();
+        HPX_TEST(p != nullptr);
+        result.push_back(allocation{p, hpx::get_worker_thread_num()});
+    }
+    return result;
+}
+
+std::size_t free_elements(
+    test_heap& heap, std::vector<allocation> const& elements)
+{
+    std::size_t non_owning = 0;
+    for (allocation const& a : elements)
+    {
+        if (a.worker != hpx::get_worker_thread_num())
+            ++non_owning;
+        heap.free(a.p);
+    }
+    return non_owning;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_concurrent_alloc_free()
+{
+    test_heap heap;
+
+    std::vector<hpx::future<std::vector<allocation>>> allocated;
+    for (std::size_t i = 0; i != num_tasks; ++i)
+    {
+        allocated.push_back(
+            hpx::async(executor_for(i), &allocate, std::ref(heap)));
+    }
+
+    std::vector<std::vector<allocation>> elements;
+    std::vector<void*> pointers;
+    std::vector<hpx::naming::gid_type> gids;
+    for (auto& f : allocated)
+    {
+        elements.push_back(f.get());
+        for (allocation const& a : elements.back())
+        {
+            HPX_TEST(heap.did_alloc(a.p));
+            pointers.push_back(a.p);
+
+            hpx::naming::gid_type gid = heap.get_gid(a.p);
+            HPX_TEST(gid);
+            HPX_TEST_EQ(gid, heap.get_gid(a.p));
+            gids.push_back(gid);
+        }
+    }
+
+    // no element is handed out twice, and each one has its own id
+    std::sort(pointers.begin(), pointers.end());
+    HPX_TEST(
+        std::adjacent_find(pointers.begin(), pointers.end()) == pointers.end());
+
+    std::sort(gids.begin(), gids.end());
+    HPX_TEST(std::adjacent_find(gids.begin(), gids.end()) == gids.end());
+
+    // the elements are freed on a different worker than the one which has
+    // allocated them
+    std::vector<hpx::future<std::size_t>> freed;
+    for (std::size_t i = 0; i != elements.size(); ++i)
+    {
+        std::size_t worker = elements[i].empty() ? i : elements[i][0].worker;
+        freed.push_back(hpx::async(executor_for(worker + 1), &free_elements,
+            std::ref(heap), std::cref(elements[i])));
+    }
+
+    std::size_t non_owning = 0;
+    for (auto& f : freed)
+    {
+        non_owning += f.get();
+    }
+
+    if (hpx::get_os_thread_count() > 1)
+    {
+        HPX_TEST_LT(std::size_t(0), non_owning);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_release_empty_heap()
+{
+    test_heap heap;
+
+    // fill a heap completely
+    void* first = heap.alloc();
+    hpx::util::wrapper_heap_base* h = heap.find_heap(first);
+    HPX_TEST(h != nullptr);
+    if (h == nullptr)
+        return;
+
+    std::vector<void*> elements(1, first);
+    while (h->free_size() != 0)
+    {
+        void* p = heap.alloc();
+        HPX_TEST(heap.find_heap(p) == h);
+        elements.push_back(p);
+    }
+    HPX_TEST_EQ(h->size(), elements.size());
+
+    // the elements of a heap are bound to consecutive ids
+    hpx::naming::gid_type const base_gid = heap.get_gid(first);
+    for (std::size_t i = 0; i != elements.size(); ++i)
+    {
+        HPX_TEST_EQ(heap.get_gid(elements[i]), base_gid + i);
+    }
+
+    // the heap stays alive as long as any of its elements is in use
+    void* last = elements.back();
+    elements.pop_back();
+
+    std::vector<allocation> to_free;
+    for (void* p : elements)
+    {
+        to_free.push_back(allocation{p, hpx::get_worker_thread_num()});
+    }
+    hpx::async(executor_for(hpx::get_worker_thread_num() + 1),
+        &free_elements, std::ref(heap), std::cref(to_free))
+        .get();
+
+    HPX_TEST(heap.did_alloc(first));
+    HPX_TEST(heap.did_alloc(last));
+    HPX_TEST_EQ(h->size(), std::size_t(1));
+
+    // freeing the last element releases the memory of the heap
+    heap.free(last);
+
+    HPX_TEST(!heap.did_alloc(first));
+    HPX_TEST(!heap.did_alloc(last));
+    HPX_TEST(heap.find_heap(last) == nullptr);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    test_concurrent_alloc_free();
+    test_release_empty_heap();
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ_MSG(hpx::init(argc, argv), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
+#endif
@@ -0,0 +1,172 @@
+//  Copyright (c) 2020 STE||AR Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Round trip data through the LZ4, Zstandard, and automatically selecting
+// binary filters, using the serialization archives directly.
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/serialization/binary_filter.hpp>
+#include <hpx/serialization/input_archive.hpp>
+#include <hpx/serialization/output_archive.hpp>
+#include <hpx/serialization/vector.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// The codec selected by the automatically selecting filter is stored in the
+// first byte of the filtered data.
+enum auto_codec : std::uint8_t
+{
+    codec_none = 0,
+    codec_lz4 = 1,
+    codec_zstd = 2
+};
+
+// the block size of the automatically selecting filter (see main)
+std::size_t const block_size = 65536;
+
+std::vector<char> compressible_data(std::size_t size)
+{
+    std::vector<char> data(size);
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        data[i] = static_cast<char>("abcdefgh"[(i / 16) % 8]);
+    }
+    return data;
+}
+
+std::vector<char> incompressible_data(std::size_t size)
+{
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<int> dist(0, 255);
+
+    std::vector<char> data(size);
+    for (char& c : data)
+    {
+        c = static_cast<char>(dist(gen));
+    }
+    return data;
+}
+
+// Serialize the data using the given filter and deserialize it again, returns
+// the first byte of the filtered data.
+std::uint8_t round_trip(char const* name, std::vector<char> const& data)
+{
+    std::unique_ptr<hpx::serialization::binary_filter> filter(
+        hpx::create_binary_filter(name, true));
+    HPX_TEST(filter != nullptr);
+    if (filter == nullptr)
+        return 0;
+
+    std::vector<char> buffer;
+    std::size_t filtered_at = 0;
+    std::size_t size = 0;
+    {
+        filter->set_max_length(data.size());
+        hpx::serialization::output_archive archive(buffer,
+            hpx::serialization::enable_compression, nullptr, filter.get());
+
+        filtered_at = archive.current_pos();
+        archive << data;
+        archive.flush();
+
+        size = archive.bytes_written();
+    }
+    HPX_TEST(buffer.size() > filtered_at);
+
+    std::vector<char> result;
+    {
+        hpx::serialization::input_archive archive(buffer, size);
+        archive >> result;
+    }
+    HPX_TEST(result == data);
+
+    return static_cast<std::uint8_t>(buffer[filtered_at]);
+}
+
+void test_filter(char const* name)
+{
+    // empty buffer
+    round_trip(name, std::vector<char>());
+
+    // small buffer
+    round_trip(name, compressible_data(100));
+
+    // larger than a block of the automatically selecting filter
+    round_trip(name, compressible_data(4 * block_size + 17));
+
+    // incompressible data
+    round_trip(name, incompressible_data(2 * block_size));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_auto_filter()
+{
+    char const* name = "auto_serialization_filter";
+
+    test_filter(name);
+
+    // small messages are not compressed
+    HPX_TEST_EQ(round_trip(name, std::vector<char>()), codec_none);
+    HPX_TEST_EQ(round_trip(name, compressible_data(100)), codec_none);
+
+    // incompressible messages are sent as they are
+    HPX_TEST_EQ(
+        round_trip(name, incompressible_data(2 * block_size)), codec_none);
+
+    // the low bandwidth configured below makes compression worthwhile,
+    // selecting Zstandard, this spans several blocks
+    HPX_TEST_EQ(
+        round_trip(name, compressible_data(4 * block_size + 17)), codec_zstd);
+
+    // a single block
+    HPX_TEST_EQ(
+        round_trip(name, compressible_data(block_size / 2)), codec_zstd);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+#if defined(HPX_HAVE_COMPRESSION_LZ4)
+    test_filter("lz4_serialization_filter");
+#endif
+#if defined(HPX_HAVE_COMPRESSION_ZSTD)
+    test_filter("zstd_serialization_filter");
+#endif
+#if defined(HPX_HAVE_COMPRESSION_LZ4) && defined(HPX_HAVE_COMPRESSION_ZSTD)
+    test_auto_filter();
+#endif
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // the automatically selecting filter compresses whenever possible if the
+    // network bandwidth is very low (1MB/s)
+    std::vector<std::string> const cfg = {
+        "hpx.plugins.auto_serialization_filter.bandwidth=1",
+        "hpx.plugins.auto_serialization_filter.block_size=" +
+            std::to_string(block_size)};
+
+    hpx::init_params init_args;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::init(argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
+#endif
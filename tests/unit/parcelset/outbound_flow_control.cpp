@@ -0,0 +1,133 @@
+//  Copyright (c) 2020 STE||AR Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This test limits the amount of outbound data pending for a destination to
+// a few parcels and sends many more parcels than that from several threads.
+// The senders have to be held back and have to resume once the pending data
+// was sent.
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/actions.hpp>
+#include <hpx/include/performance_counters.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+std::size_t const max_pending_outbound_size = 65536;
+std::size_t const parcel_data_size = 32768;
+
+std::size_t const num_senders = 4;
+std::size_t const num_parcels = 32;
+
+std::size_t receive_data(std::vector<char> const& data)
+{
+    return data.size();
+}
+HPX_PLAIN_ACTION(receive_data);
+
+///////////////////////////////////////////////////////////////////////////////
+std::vector<hpx::future<std::size_t>> send_parcels(hpx::id_type const& id)
+{
+    std::vector<hpx::future<std::size_t>> results;
+    results.reserve(num_parcels);
+
+    // each call to async suspends as long as too much data is pending
+    for (std::size_t i = 0; i != num_parcels; ++i)
+    {
+        results.push_back(hpx::async(receive_data_action(), id,
+            std::vector<char>(parcel_data_size, static_cast<char>(i))));
+    }
+    return results;
+}
+
+std::int64_t query_counter(std::string const& name)
+{
+    hpx::performance_counters::performance_counter counter(name);
+    return counter.get_value<std::int64_t>(hpx::launch::sync);
+}
+
+void test_outbound_flow_control(hpx::id_type const& id)
+{
+    std::string const pp_type = hpx::get_runtime_distributed()
+                                    .get_parcel_handler()
+                                    .get_bootstrap_parcelport()
+                                    ->type();
+
+    std::string const stall_counter =
+        "/parcelport{locality#0/total}/time/" + pp_type + "/outbound-stall";
+    std::string const pending_counter = "/parcelport{locality#0/total}/count/" +
+        pp_type + "/pending-outbound-data";
+
+    std::int64_t const stall_before = query_counter(stall_counter);
+
+    std::vector<hpx::future<std::vector<hpx::future<std::size_t>>>> senders;
+    for (std::size_t i = 0; i != num_senders; ++i)
+    {
+        senders.push_back(hpx::async(&send_parcels, id));
+    }
+
+    // all senders resume, and all of their parcels are delivered
+    std::size_t delivered = 0;
+    for (auto& sender : senders)
+    {
+        for (hpx::future<std::size_t>& f : sender.get())
+        {
+            HPX_TEST_EQ(f.get(), parcel_data_size);
+            ++delivered;
+        }
+    }
+    HPX_TEST_EQ(delivered, num_senders * num_parcels);
+
+    // the senders were held back while the destination was over budget
+    HPX_TEST_LT(stall_before, query_counter(stall_counter));
+
+    // all credits are given back, the replies may arrive before the writes
+    // of the corresponding parcels are reported as complete
+    std::int64_t pending = query_counter(pending_counter);
+    for (int i = 0; pending != 0 && i != 1000; ++i)
+    {
+        hpx::this_thread::sleep_for(std::chrono::milliseconds(10));
+        pending = query_counter(pending_counter);
+    }
+    HPX_TEST_EQ(pending, std::int64_t(0));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    for (hpx::id_type const& id : hpx::find_remote_localities())
+    {
+        test_outbound_flow_control(id);
+    }
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> const cfg = {
+        "hpx.parcel.max_pending_outbound_size=" +
+            std::to_string(max_pending_outbound_size)};
+
+    hpx::init_params init_args;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::init(argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
+#endif
@@ -0,0 +1,137 @@
+//  Copyright (c) 2020 STE||AR Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/runtime/parcelset/parcel_buffer_pool.hpp>
+
+#include <cstddef>
+#include <vector>
+
+using hpx::parcelset::parcel_buffer_pool;
+
+///////////////////////////////////////////////////////////////////////////////
+void test_disabled()
+{
+    parcel_buffer_pool pool;
+
+    std::vector<char> buffer;
+    pool.acquire(buffer, 10000);
+    HPX_TEST_LTE(std::size_t(10000), buffer.capacity());
+
+    pool.release(buffer);
+    HPX_TEST_EQ(buffer.capacity(), std::size_t(0));
+    HPX_TEST_EQ(pool.cached_size(), std::size_t(0));
+}
+
+void test_reuse()
+{
+    parcel_buffer_pool pool(1024 * 1024);
+
+    // requests are rounded up to the capacity of their size class
+    std::vector<char> buffer;
+    pool.acquire(buffer, 5000);
+    HPX_TEST_EQ(buffer.capacity(), std::size_t(8192));
+    char const* data = buffer.data();
+
+    pool.release(buffer);
+    HPX_TEST_EQ(buffer.capacity(), std::size_t(0));
+    HPX_TEST_EQ(pool.cached_size(), std::size_t(8192));
+
+    // a different size class does not reuse the cached buffer
+    std::vector<char> larger;
+    pool.acquire(larger, 9000);
+    HPX_TEST_EQ(larger.capacity(), std::size_t(16384));
+    HPX_TEST_EQ(pool.cached_size(), std::size_t(8192));
+
+    // any request of the same size class reuses the cached buffer
+    std::vector<char> reused;
+    pool.acquire(reused, 8000);
+    HPX_TEST(reused.data() == data);
+    HPX_TEST_EQ(reused.capacity(), std::size_t(8192));
+    HPX_TEST(reused.empty());
+    HPX_TEST_EQ(pool.cached_size(), std::size_t(0));
+
+    // buffers are sorted into the largest size class they can serve
+    std::vector<char> odd;
+    odd.reserve(12000);
+    std::size_t const odd_capacity = odd.capacity();
+    data = odd.data();
+    pool.release(odd);
+    HPX_TEST_EQ(pool.cached_size(), odd_capacity);
+
+    pool.acquire(odd, 8192);
+    HPX_TEST(odd.data() == data);
+    HPX_TEST_EQ(odd.capacity(), odd_capacity);
+    HPX_TEST_EQ(pool.cached_size(), std::size_t(0));
+
+    // small buffers are neither rounded up nor cached
+    std::vector<char> small;
+    pool.acquire(small, 100);
+    HPX_TEST_LT(small.capacity(), std::size_t(4096));
+    pool.release(small);
+    HPX_TEST_EQ(pool.cached_size(), std::size_t(0));
+
+    pool.release(larger);
+    pool.release(reused);
+    HPX_TEST_EQ(pool.cached_size(), std::size_t(16384 + 8192));
+}
+
+void test_limits()
+{
+    std::size_t const max_size = 4 * 8192;
+    parcel_buffer_pool pool(max_size);
+
+    // buffers larger than the high watermark are not cached
+    std::vector<char> oversized;
+    pool.acquire(oversized, 2 * max_size);
+    HPX_TEST_LTE(2 * max_size, oversized.capacity());
+    pool.release(oversized);
+    HPX_TEST_EQ(oversized.capacity(), std::size_t(0));
+    HPX_TEST_EQ(pool.cached_size(), std::size_t(0));
+
+    // the pool holds at most max_size bytes
+    std::vector<std::vector<char>> buffers(5);
+    for (std::vector<char>& buffer : buffers)
+    {
+        pool.acquire(buffer, 8192);
+        HPX_TEST_EQ(buffer.capacity(), std::size_t(8192));
+    }
+    for (std::vector<char>& buffer : buffers)
+    {
+        pool.release(buffer);
+        HPX_TEST_EQ(buffer.capacity(), std::size_t(0));
+    }
+    HPX_TEST_EQ(pool.cached_size(), max_size);
+
+    // trimming frees buffers down to half of the high watermark
+    pool.trim();
+    HPX_TEST_EQ(pool.cached_size(), max_size / 2);
+
+    pool.trim();
+    HPX_TEST_EQ(pool.cached_size(), max_size / 2);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    test_disabled();
+    test_reuse();
+    test_limits();
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ_MSG(hpx::init(argc, argv), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
+#endif
@@ -0,0 +1,146 @@
+//  Copyright (c) 2020 STE||AR Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This test sends messages which are much larger than the buffers used by the
+// parcelports for a single transfer (for instance the ring buffers of the
+// shmem parcelport, which are configured to their minimal size below), both
+// as part of the serialized data and as zero-copy chunks.
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/actions.hpp>
+#include <hpx/include/serialization.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+using buffer_type = hpx::serialization::serialize_buffer<char>;
+
+char expected_value(std::size_t i, std::size_t seed)
+{
+    return static_cast<char>((i * 31 + seed) % 251);
+}
+
+bool verify(char const* data, std::size_t size, std::size_t seed)
+{
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        if (data[i] != expected_value(i, seed))
+            return false;
+    }
+    return true;
+}
+
+buffer_type make_buffer(std::size_t size, std::size_t seed)
+{
+    buffer_type buffer(size);
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        buffer[i] = expected_value(i, seed);
+    }
+    return buffer;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// the zero-copy chunk is sent back with a different pattern
+buffer_type echo_chunk(buffer_type const& buffer, std::size_t seed)
+{
+    HPX_TEST(verify(buffer.data(), buffer.size(), seed));
+    return make_buffer(buffer.size(), seed + 1);
+}
+HPX_PLAIN_ACTION(echo_chunk);
+
+// the vector is part of the serialized data
+std::vector<char> echo_data(std::vector<char> const& data, std::size_t seed)
+{
+    HPX_TEST(verify(data.data(), data.size(), seed));
+
+    std::vector<char> result(data.size());
+    for (std::size_t i = 0; i != result.size(); ++i)
+    {
+        result[i] = expected_value(i, seed + 1);
+    }
+    return result;
+}
+HPX_PLAIN_ACTION(echo_data);
+
+///////////////////////////////////////////////////////////////////////////////
+void test_large_chunks(hpx::id_type const& id)
+{
+    std::size_t const sizes[] = {4096, 65537, 1048576, 4 * 1048576};
+
+    // several large messages are in flight at the same time
+    std::vector<hpx::future<buffer_type>> results;
+    for (std::size_t i = 0; i != sizeof(sizes) / sizeof(sizes[0]); ++i)
+    {
+        results.push_back(hpx::async(
+            echo_chunk_action(), id, make_buffer(sizes[i], i), i));
+    }
+
+    for (std::size_t i = 0; i != results.size(); ++i)
+    {
+        buffer_type result = results[i].get();
+        HPX_TEST_EQ(result.size(), sizes[i]);
+        HPX_TEST(verify(result.data(), result.size(), i + 1));
+    }
+}
+
+void test_large_data(hpx::id_type const& id)
+{
+    std::size_t const sizes[] = {4096, 65537, 1048576};
+
+    std::vector<hpx::future<std::vector<char>>> results;
+    for (std::size_t i = 0; i != sizeof(sizes) / sizeof(sizes[0]); ++i)
+    {
+        buffer_type buffer = make_buffer(sizes[i], i);
+        results.push_back(hpx::async(echo_data_action(), id,
+            std::vector<char>(buffer.data(), buffer.data() + buffer.size()),
+            i));
+    }
+
+    for (std::size_t i = 0; i != results.size(); ++i)
+    {
+        std::vector<char> result = results[i].get();
+        HPX_TEST_EQ(result.size(), sizes[i]);
+        HPX_TEST(verify(result.data(), result.size(), i + 1));
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    for (hpx::id_type const& id : hpx::find_remote_localities())
+    {
+        test_large_chunks(id);
+        test_large_data(id);
+    }
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> const cfg = {
+#if defined(HPX_HAVE_PARCELPORT_SHMEM)
+        "hpx.parcel.shmem.ring_size=4096"
+#endif
+    };
+
+    hpx::init_params init_args;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::init(argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
+#endif